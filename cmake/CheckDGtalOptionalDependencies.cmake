@@ -16,6 +16,7 @@ OPTION(WITH_C11 "With C++ compiler C11 features." OFF)
 OPTION(WITH_OPENMP "With OpenMP (compiler multithread programming) features." OFF)
 OPTION(WITH_GMP "With Gnu Multiprecision Library (GMP)." OFF)
 OPTION(WITH_EIGEN "With Eigen3 Linear Algebra Library." OFF)
+OPTION(WITH_FFTW3 "With FFTW3 discrete Fourier transform library." OFF)
 OPTION(WITH_CGAL "With CGAL." OFF)
 OPTION(WITH_MAGICK "With GraphicsMagick++." OFF)
 OPTION(WITH_ITK "With Insight Toolkit ITK." OFF)
@@ -73,6 +74,13 @@ ELSE(WITH_EIGEN)
 message(STATUS "      WITH_EIGEN        false   (Eigen3)")
 ENDIF(WITH_EIGEN)
 
+IF(WITH_FFTW3)
+SET (LIST_OPTION ${LIST_OPTION} [FFTW3]\ )
+message(STATUS "      WITH_FFTW3        true    (FFTW3 discrete Fourier transform)")
+ELSE(WITH_FFTW3)
+message(STATUS "      WITH_FFTW3        false   (FFTW3 discrete Fourier transform)")
+ENDIF(WITH_FFTW3)
+
 
 IF(WITH_CGAL)
 SET (LIST_OPTION ${LIST_OPTION} [CGAL]\ )
@@ -413,6 +421,25 @@ IF(WITH_EIGEN)
   ENDIF(EIGEN3_FOUND)
 ENDIF(WITH_EIGEN)
 
+# -----------------------------------------------------------------------------
+# Look for FFTW3
+# (They are not compulsory).
+# -----------------------------------------------------------------------------
+SET(FFTW3_FOUND_DGTAL 0)
+IF(WITH_FFTW3)
+  FIND_PACKAGE(FFTW3 REQUIRED)
+  IF(FFTW3_FOUND)
+    SET(FFTW3_FOUND_DGTAL 1)
+    INCLUDE_DIRECTORIES(${FFTW3_INCLUDE_DIR})
+    SET(DGtalLibDependencies ${DGtalLibDependencies} ${FFTW3_LIBRARIES})
+    SET(DGtalLibInc ${DGtalLibInc} ${FFTW3_INCLUDE_DIR})
+    ADD_DEFINITIONS("-DWITH_FFTW3 ")
+    message(STATUS "FFTW3 found.")
+  ELSE(FFTW3_FOUND)
+    message(FATAL_ERROR "FFTW3 not found. Check the cmake variables associated to this package or disable it." )
+  ENDIF(FFTW3_FOUND)
+ENDIF(WITH_FFTW3)
+
 # -----------------------------------------------------------------------------
 # Look for CGAL
 # (They are not compulsory).
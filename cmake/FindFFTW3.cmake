@@ -0,0 +1,17 @@
+# Try to find the FFTW3 librairies (double precision)
+#  FFTW3_FOUND - system has FFTW3 lib
+#  FFTW3_INCLUDE_DIR - the FFTW3 include directory
+#  FFTW3_LIBRARIES - Libraries needed to use FFTW3
+
+if (FFTW3_INCLUDE_DIR AND FFTW3_LIBRARIES)
+  # Already in cache, be silent
+  set(FFTW3_FIND_QUIETLY TRUE)
+endif (FFTW3_INCLUDE_DIR AND FFTW3_LIBRARIES)
+
+find_path(FFTW3_INCLUDE_DIR NAMES fftw3.h )
+find_library(FFTW3_LIBRARIES NAMES fftw3 libfftw3 libfftw3-3 )
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(FFTW3 DEFAULT_MSG FFTW3_INCLUDE_DIR FFTW3_LIBRARIES)
+
+mark_as_advanced(FFTW3_INCLUDE_DIR FFTW3_LIBRARIES)
@@ -76,7 +76,10 @@ It is a backport of <a
 href="https://gforge.liris.cnrs.fr/projects/imagene">ImaGene</a>.
 
 @tparam TInteger any model of integer (CInteger), like \c int, \c long int,
-\c int64_t, \c BigInteger (when GMP is installed).
+\c int64_t, \c int128_t (when WITH_INT128 is defined, i.e. the
+compiler supports native 128-bit integers), \c BigInteger (when GMP
+is installed). With \c int128_t, gcds switch to 64-bit divisions as
+soon as the remainders fit in 64 bits.
    
    */
   template <typename TInteger>
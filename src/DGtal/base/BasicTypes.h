@@ -51,6 +51,10 @@
 #endif
 //////////////////////////////////////////////////////////////////////////////
 
+#if defined(__SIZEOF_INT128__) && !defined(DGTAL_NO_INT128)
+/** Native 128-bit integers are available (DGtal::int128_t). */
+#define WITH_INT128
+#endif
 
 
 namespace DGtal
@@ -79,6 +83,52 @@ namespace DGtal
   typedef mpz_class BigInteger;
 #endif
 
+#ifdef WITH_INT128
+  ///signed 128-bit integer (native compiler extension).
+  __extension__ typedef __int128 int128_t;
+  ///unsigned 128-bit integer (native compiler extension).
+  __extension__ typedef unsigned __int128 uint128_t;
+
+  /**
+   * Overloads 'operator<<' for unsigned 128-bit integers, which the
+   * standard streams do not support (only the decimal base is
+   * implemented).
+   * @param out the output stream where the integer is written.
+   * @param x the integer to write.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, uint128_t x )
+  {
+    char digits[ 40 ];
+    char * d = digits + sizeof( digits );
+    *--d = '\0';
+    do
+      {
+        *--d = (char) ( '0' + (int) ( x % 10 ) );
+        x /= 10;
+      }
+    while ( x != 0 );
+    return out << d;
+  }
+
+  /**
+   * Overloads 'operator<<' for signed 128-bit integers.
+   * @param out the output stream where the integer is written.
+   * @param x the integer to write.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out, int128_t x )
+  {
+    if ( x < 0 )
+      return out << '-' << ( uint128_t(0) - (uint128_t) x );
+    return out << (uint128_t) x;
+  }
+#endif
+
 } // namespace DGtal
 
 
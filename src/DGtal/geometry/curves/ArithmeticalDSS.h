@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <iterator>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
 
@@ -557,6 +558,45 @@ namespace DGtal
      */
     bool extendBack( const Point& aNewPoint );
 
+    /**
+     * Counts how many consecutive points of the range
+     * [@a aItb, @a aIte), which is located at the front of
+     * the DSS, can be added to the DSS.
+     *
+     * @param aItb begin iterator of the upcoming points
+     * @param aIte end iterator of the upcoming points
+     * @tparam TIterator a model of forward iterator on points
+     *
+     * @return the number of points that can be added,
+     * from 0 to the size of the range.
+     * @see extendFront(TIterator,const TIterator&)
+     */
+    template <typename TIterator>
+    unsigned int isExtendableFront( const TIterator& aItb, const TIterator& aIte ) const;
+
+    /**
+     * Adds to the DSS as many consecutive points of the range
+     * [@a aItb, @a aIte) as possible, ie. until a point breaks
+     * the digital straightness or the end of the range is reached.
+     * The result is the same as calling extendFront(const Point&)
+     * on each point until it fails, but the points that are
+     * added without changing the slope of the DSS
+     * (cases 5, 6 and 9 of isExtendableFront(const Point&))
+     * are processed by batches: their remainders are computed
+     * in a loop without branch, then the leaning points are updated
+     * once per batch.
+     *
+     * @param aItb begin iterator of the upcoming points
+     * @param aIte end iterator of the upcoming points
+     * @tparam TIterator a model of forward iterator on points
+     *
+     * @return the number of points that have been added,
+     * from 0 to the size of the range.
+     * @see extendFront(const Point&)
+     */
+    template <typename TIterator>
+    unsigned int extendFront( TIterator aItb, const TIterator& aIte );
+
     /**
      * Removes the front point of the DSS 
      * if it remains strictly more than one point
@@ -52,6 +52,7 @@
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/base/ReverseIterator.h"
 #include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtal/geometry/curves/SegmentComputerUtils.h"
 //////////////////////////////////////////////////////////////////////////////
 
 
@@ -232,6 +233,29 @@ namespace DGtal
      */
     bool extendBack();
 
+    /**
+     * Counts how many consecutive points, from the
+     * end of the DSS to @a anEnd, can be added at the front.
+     * @param anEnd end iterator of the upcoming points
+     * @return the number of points that can be added.
+     * @see ArithmeticalDSS::isExtendableFront(const TIterator&,const TIterator&)
+     */
+    unsigned int isExtendableFront( const ConstIterator& anEnd ) const;
+
+    /**
+     * Extends the DSS at the front with as many consecutive points,
+     * from the end of the DSS to @a anEnd, as possible.
+     * Equivalent to the loop
+     * @code
+     * while ( (c.end() != anEnd) && (c.extendFront()) ) {}
+     * @endcode
+     * but faster, especially for random access iterators.
+     * @param anEnd end iterator of the upcoming points
+     * @return the number of points that have been added.
+     * @see ArithmeticalDSS::extendFront(TIterator,const TIterator&)
+     */
+    unsigned int extendFront( const ConstIterator& anEnd );
+
     /**
      * Removes the front point of the DSS 
      * if it has more than two points
@@ -557,6 +581,31 @@ namespace DGtal
 
   }; 
 
+  /**
+   * DSS computers provide a batch extension, 
+   * see ArithmeticalDSSComputer::extendFront(const ConstIterator&). 
+   */
+  template <typename TIterator, typename TInteger, unsigned short adjacency>
+  struct SegmentComputerTraits< ArithmeticalDSSComputer<TIterator, TInteger, adjacency> >
+  {
+    typedef ForwardSegmentComputer Category;
+    typedef TagTrue BatchExtension; 
+  };
+
+  template <typename TIterator, typename TInteger>
+  struct SegmentComputerTraits< StandardDSS4Computer<TIterator, TInteger> >
+  {
+    typedef ForwardSegmentComputer Category;
+    typedef TagTrue BatchExtension; 
+  };
+
+  template <typename TIterator, typename TInteger>
+  struct SegmentComputerTraits< NaiveDSS8Computer<TIterator, TInteger> >
+  {
+    typedef ForwardSegmentComputer Category;
+    typedef TagTrue BatchExtension; 
+  };
+
 } // namespace DGtal
 
 
@@ -43,6 +43,7 @@
 
 
 #include "DGtal/base/Circulator.h"
+#include "DGtal/base/ConceptUtils.h"
 
 namespace DGtal
 {
@@ -62,6 +63,9 @@ namespace DGtal
  *  Provides the category of the segment computer  
  * {ForwardSegmentComputer,BidirectionalSegmentComputer,
  * DynamicSegmentComputer, DynamicBidirectionalSegmentComputer}
+ * and tells whether it provides a batch extension, 
+ * ie. a method extendFront(end) that adds as many 
+ * points as possible in one call (TagTrue) or not (TagFalse). 
  * 
  * @tparam SC any segment computer
  */
@@ -70,6 +74,7 @@ namespace DGtal
 template <typename SC>
 struct SegmentComputerTraits {
     typedef  ForwardSegmentComputer Category;
+    typedef TagFalse BatchExtension; 
 //    typedef DynamicBidirectionalSegmentComputer Category; 
 //    typedef BidirectionalSegmentComputer Category;   
 };
@@ -158,26 +163,76 @@ IC getMiddleIterator(const IC& itb, const IC& ite) {
 
 
 /**
- * Specialization for Iterator type
+ * Specialization for Iterator type, 
+ * which calls s.extendFront() point by point
  */
-template <typename SC>
-void maximalExtension(SC& s, const typename SC::ConstIterator& end, IteratorType ) {
+template <typename SC, typename BatchExtension>
+void maximalExtension(SC& s, const typename SC::ConstIterator& end, IteratorType, 
+                      ForwardCategory, BatchExtension ) {
   //stop if s.end() == end
   while ( (s.end() != end)
        && (s.extendFront()) ) {}
 }
 
 /**
- * Specialization for Circulator type
+ * Specialization for Iterator type, random access 
+ * category and segment computers providing a batch extension
+ */
+template <typename SC>
+void maximalExtension(SC& s, const typename SC::ConstIterator& end, IteratorType, 
+                      RandomAccessCategory, TagTrue ) {
+  //stop if s.end() == end
+  s.extendFront( end ); 
+}
+
+/**
+ * Specialization for Iterator type
  */
 template <typename SC>
-void maximalExtension(SC& s, const typename SC::ConstIterator& /*end*/, CirculatorType ) 
+void maximalExtension(SC& s, const typename SC::ConstIterator& end, IteratorType ) {
+  typedef typename IteratorCirculatorTraits<typename SC::ConstIterator>::Category Category; 
+  typedef typename SegmentComputerTraits<SC>::BatchExtension BatchExtension; 
+  maximalExtension( s, end, IteratorType(), Category(), BatchExtension() ); 
+}
+
+/**
+ * Specialization for Circulator type, 
+ * which calls s.extendFront() point by point
+ */
+template <typename SC, typename BatchExtension>
+void maximalExtension(SC& s, const typename SC::ConstIterator& /*end*/, CirculatorType, 
+                      ForwardCategory, BatchExtension ) 
 {
   //stop if the segment is the whole range
   const typename SC::ConstIterator newEnd( s.begin() ); 
   while ( (s.extendFront())
     && (s.end() != newEnd) ) {}
 }
+
+/**
+ * Specialization for Circulator type, random access 
+ * category and segment computers providing a batch extension
+ */
+template <typename SC>
+void maximalExtension(SC& s, const typename SC::ConstIterator& /*end*/, CirculatorType, 
+                      RandomAccessCategory, TagTrue ) 
+{
+  //stop if the segment is the whole range
+  const typename SC::ConstIterator newEnd( s.begin() ); 
+  s.extendFront( newEnd ); 
+}
+
+/**
+ * Specialization for Circulator type
+ */
+template <typename SC>
+void maximalExtension(SC& s, const typename SC::ConstIterator& end, CirculatorType ) 
+{
+  typedef typename IteratorCirculatorTraits<typename SC::ConstIterator>::Category Category; 
+  typedef typename SegmentComputerTraits<SC>::BatchExtension BatchExtension; 
+  maximalExtension( s, end, CirculatorType(), Category(), BatchExtension() ); 
+}
+
 /**
  * Calls s.extendFront() while possible
  * @param s any instance of segment computer 
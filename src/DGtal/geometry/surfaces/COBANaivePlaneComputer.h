@@ -103,7 +103,8 @@ namespace DGtal
    * internal computations. The type should be able to hold integers
    * of order (2*D^3)^2 if D is the diameter of the set of digital
    * points. In practice, diameter is limited to 20 for int32_t,
-   * diameter is approximately 500 for int64_t, and whatever with
+   * diameter is approximately 500 for int64_t, approximately 10^6
+   * for int128_t (when WITH_INT128 is defined), and whatever with
    * BigInteger/GMP integers. For huge diameters, the slow-down is
    * polylogarithmic with respect to the diameter.
    *
@@ -89,8 +89,9 @@ namespace DGtal
    *  int64_t instead of BigInteger whenever possible. When the point
    *  components are smaller than 14000, int32_t are sufficient. For
    *  point components smaller than 440000000, int64_t are
-   *  sufficient. For greater diameters, it is necessary to use
-   *  BigInteger.
+   *  sufficient, and int128_t (when WITH_INT128 is defined) for
+   *  components smaller than 2^60. For greater diameters, it is
+   *  necessary to use BigInteger (see also PromotingPlaneComputer).
 
    * \par What is the best algorithm to check if a set of digital points is some (naive) plane ?
 
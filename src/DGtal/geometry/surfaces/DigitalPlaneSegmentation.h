@@ -0,0 +1,335 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalPlaneSegmentation.h
+ *
+ * Header file for module DigitalPlaneSegmentation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalPlaneSegmentation_RECURSES)
+#error Recursive header files inclusion detected in DigitalPlaneSegmentation.h
+#else // defined(DigitalPlaneSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalPlaneSegmentation_RECURSES
+
+#if !defined DigitalPlaneSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalPlaneSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalPlaneSegmentation
+  /**
+   * Description of template class 'DigitalPlaneSegmentation' <p>
+   * \brief Aim: Segments a whole 3D digital surface into pieces of
+   * naive digital planes, with a plane computer such as
+   * COBAGenericNaivePlaneComputer or ChordGenericNaivePlaneComputer.
+   *
+   * Each surfel is represented by its direct incident spel (the inner
+   * voxel for the surfaces built by Surfaces or DigitalSetBoundary),
+   * as in the greedy-plane-segmentation example. The adjacency of the
+   * surfels is computed once, in parallel (OpenMP, if DGtal is
+   * compiled WITH_OPENMP), each thread with its own tracker on the
+   * surface.
+   *
+   * Two segmentations are available:
+   *
+   * - greedySegmentation() partitions the surface into planes by
+   *   region growing: a plane is grown from an unassigned seed, in
+   *   breadth-first order, with any unassigned neighbour that keeps
+   *   the set of points a naive plane. Seeds are grown by rounds, in
+   *   parallel: the seeds of a round are spread over the unassigned
+   *   surfels, their regions are grown independently against the
+   *   assignment of the previous rounds, then accepted in the order of
+   *   the seeds when they do not overlap an already accepted region of
+   *   the round (the other seeds are grown again at the next
+   *   rounds). The first region of a round is always accepted, hence
+   *   the result does not depend on the number of threads.
+   *
+   * - maximalPlanes() computes, for each surfel, the largest
+   *   breadth-first ball of surfels around it that is a naive plane,
+   *   layer by layer, i.e. a normal vector estimator. Surfels are
+   *   processed by chunks of consecutive surfels: when a surfel is
+   *   adjacent to the previous one, whose ball has radius r, the
+   *   ball of radius r-1 around it is contained in the previous ball,
+   *   hence it is added in one extension instead of r-1 ones.
+   *
+   * Both compute a normal vector per surfel, which is the normal of
+   * its recognized plane (i.e. not averaged), given by
+   * PlaneComputer::getUnitNormal and oriented outward (i.e. away from
+   * the direct incident spels of the surfels of the plane). When this
+   * normal is orthogonal to the sum of the outward vectors of the
+   * surfels (e.g. for a plane of one point), the normalized sum is
+   * used instead.
+   *
+   * Example of typical use:
+   * @code
+   * typedef COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> PlaneComputer;
+   * PlaneComputer prototype;
+   * prototype.init( 2 * diameter, 1, 1 );
+   * DigitalPlaneSegmentation<MyDigitalSurface, PlaneComputer> segmentation( digSurf, prototype );
+   * unsigned int nbPlanes = segmentation.greedySegmentation();
+   * @endcode
+   *
+   * @tparam TDigitalSurface any DigitalSurface of dimension 3, whose
+   * container can be read by several threads.
+   *
+   * @tparam TPlaneComputer any model of CAdditivePrimitiveComputer
+   * whose points are the points of the surface, with methods
+   * extend( it, itE ) and getUnitNormal( v ) (e.g.
+   * COBAGenericNaivePlaneComputer or ChordGenericNaivePlaneComputer).
+   *
+   * @see testDigitalPlaneSegmentation.cpp
+   */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  class DigitalPlaneSegmentation
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TDigitalSurface Surface;
+    typedef TPlaneComputer PlaneComputer;
+    typedef typename Surface::KSpace KSpace;
+    typedef typename Surface::Surfel Surfel;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Vector Vector;
+    typedef typename KSpace::Space::RealVector RealVector;
+    typedef typename KSpace::Size Size;
+
+    BOOST_STATIC_ASSERT(( KSpace::dimension == 3 ));
+    BOOST_CONCEPT_ASSERT(( CAdditivePrimitiveComputer< TPlaneComputer > ));
+
+    /// The plane index of the surfels that belong to no plane.
+    static const unsigned int NO_PLANE = (unsigned int) -1;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Computes the surfels of the surface and their
+     * adjacencies.
+     *
+     * @param aSurface the digital surface (referenced).
+     * @param aPrototype an initialized plane computer (copied), whose
+     * copies recognize each plane (e.g. a
+     * COBAGenericNaivePlaneComputer whose diameter is the one of the
+     * surface, with the width of the planes).
+     */
+    DigitalPlaneSegmentation( const Surface & aSurface,
+                              const PlaneComputer & aPrototype );
+
+    /**
+     * Destructor.
+     */
+    ~DigitalPlaneSegmentation();
+
+    // ----------------------- Segmentation services ------------------------------
+  public:
+
+    /**
+     * Partitions the surface into planes by greedy region growing.
+     *
+     * @param nbSeeds the maximal number of seeds grown in parallel at
+     * each round (at least 1).
+     *
+     * @return the number of planes.
+     */
+    unsigned int greedySegmentation( unsigned int nbSeeds = 64 );
+
+    /**
+     * Computes the maximal plane around each surfel, as a ball of
+     * surfels for the breadth-first distance.
+     *
+     * @param maxRadius the maximal radius of the balls, or 0 for no
+     * limit.
+     */
+    void maximalPlanes( unsigned int maxRadius = 0 );
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /**
+     * @return the number of surfels of the surface.
+     */
+    Size size() const;
+
+    /**
+     * @return the surfels of the surface, in the order of the surface.
+     */
+    const std::vector<Surfel> & surfels() const;
+
+    /**
+     * @param aSurfel any surfel.
+     * @return the index of aSurfel in surfels(), or size() if it does
+     * not belong to the surface.
+     */
+    Size index( const Surfel & aSurfel ) const;
+
+    /**
+     * @param i the index of a surfel.
+     * @return the point of the surfel (its direct incident spel).
+     */
+    const Point & point( Size i ) const;
+
+    /**
+     * @return the number of planes computed by the last
+     * greedySegmentation() (0 after maximalPlanes()).
+     */
+    unsigned int nbPlanes() const;
+
+    /**
+     * @return the plane index of each surfel, computed by the last
+     * greedySegmentation() (NO_PLANE after maximalPlanes()).
+     */
+    const std::vector<unsigned int> & planes() const;
+
+    /**
+     * @return the normal vector of each plane computed by the last
+     * greedySegmentation().
+     */
+    const std::vector<RealVector> & planeNormals() const;
+
+    /**
+     * @return the normal vector of each surfel, i.e. the normal of its
+     * plane (greedySegmentation()) or of its maximal plane
+     * (maximalPlanes()).
+     */
+    const std::vector<RealVector> & normals() const;
+
+    /**
+     * @return the radius of the maximal plane of each surfel, computed
+     * by the last maximalPlanes() (empty after greedySegmentation()).
+     */
+    const std::vector<unsigned int> & radii() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The digital surface.
+    const Surface & mySurface;
+    /// The plane computer copied for each plane.
+    PlaneComputer myPrototype;
+    /// The surfels, in the order of the surface.
+    std::vector<Surfel> mySurfels;
+    /// The surfels sorted, with their indices.
+    std::vector< std::pair<Surfel, unsigned int> > myIndex;
+    /// The points of the surfels.
+    std::vector<Point> myPoints;
+    /// The outward unit vector of the surfels, along their orthogonal direction.
+    std::vector<Vector> myOutwards;
+    /// The indices of the 4 adjacent surfels of each surfel (NO_PLANE if none).
+    std::vector<unsigned int> myNeighbours;
+    /// The plane index of each surfel.
+    std::vector<unsigned int> myPlanes;
+    /// The normal of each plane.
+    std::vector<RealVector> myPlaneNormals;
+    /// The normal of each surfel.
+    std::vector<RealVector> myNormals;
+    /// The radius of the maximal plane of each surfel.
+    std::vector<unsigned int> myRadii;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    DigitalPlaneSegmentation( const DigitalPlaneSegmentation & other );
+    DigitalPlaneSegmentation & operator=( const DigitalPlaneSegmentation & other );
+
+    /**
+     * Computes the surfels, their points and their adjacencies.
+     */
+    void computeAdjacencies();
+
+    /**
+     * Grows a plane from a seed, with the surfels that belong to no plane.
+     *
+     * @param aSeed the index of the seed surfel.
+     * @param aStamps the stamps of the surfels visited (one per surfel).
+     * @param aStamp the stamp of this growth, not yet in aStamps.
+     * @param aRegion (returns) the indices of the surfels of the plane.
+     * @param aNormal (returns) the oriented normal of the plane.
+     */
+    void growPlane( unsigned int aSeed, std::vector<unsigned int> & aStamps,
+                    unsigned int aStamp, std::vector<unsigned int> & aRegion,
+                    RealVector & aNormal ) const;
+
+    /**
+     * @param aComputer a non-empty plane computer.
+     * @param anOutward the sum of the outward vectors of its surfels.
+     * @return the unit normal of the plane, oriented along anOutward
+     * (or anOutward normalized if they are orthogonal).
+     */
+    static RealVector orientedNormal( const PlaneComputer & aComputer,
+                                      const Vector & anOutward );
+
+  }; // end of class DigitalPlaneSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalPlaneSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalPlaneSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalPlaneSegmentation<TDigitalSurface, TPlaneComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalPlaneSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalPlaneSegmentation_h
+
+#undef DigitalPlaneSegmentation_RECURSES
+#endif // else defined(DigitalPlaneSegmentation_RECURSES)
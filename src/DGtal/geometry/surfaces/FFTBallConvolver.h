@@ -0,0 +1,565 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FFTBallConvolver.h
+ * @brief Compute the volume and the covariance matrix of the
+ * intersection between a 3D shape and a ball centered on surface
+ * spels, from convolutions computed once on the whole characteristic
+ * image of the shape with fast Fourier transforms.
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see SummedVolumeBallConvolver.h RealFFT3D.h
+ * IntegralInvariantVolumeMeanCurvatureEstimator.h
+ * IntegralInvariantVolumeGaussianCurvatureEstimator.h
+ */
+
+#if defined(FFTBallConvolver_RECURSES)
+#error Recursive header files inclusion detected in FFTBallConvolver.h
+#else // defined(FFTBallConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FFTBallConvolver_RECURSES
+
+#if !defined FFTBallConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define FFTBallConvolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/SimpleMatrix.h"
+#include "DGtal/kernel/CCellFunctor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/math/RealFFT3D.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class FFTBallConvolver
+/**
+   * Description of template class 'FFTBallConvolver' <p>
+   *
+   * \brief Aim: Convolve the characteristic function of a 3D shape
+   * with a digital ball, on every spel of the space at once, with fast
+   * Fourier transforms.
+   *
+   * At init(), the characteristic function of the shape is evaluated
+   * on every spel of the Khalimsky space bounding box and transformed
+   * with RealFFT3D (the transform is kept and reused as long as the
+   * size of the kernel does not require a larger padding). The kernel
+   * (one indicator function for the volume, nine monomials x, y, z,
+   * yz, xz, xy, zz, yy, xx restricted to the kernel for the moments)
+   * is transformed in turn, multiplied with the shape spectrum, and the
+   * inverse transform gives the volume (or moment) of the kernel
+   * centered on each spel. Images are zero-padded so that the
+   * convolution is not circular. Since all these quantities are
+   * integers, results are rounded and are then exactly the ones of
+   * DigitalSurfaceConvolver and SummedVolumeBallConvolver, for
+   * the sizes met in practice.
+   *
+   * The cost of init() is @f$ O(n \log n) @f$ for an image of @f$ n
+   * @f$ spels (the bounding box padded by the kernel radius), and
+   * each evaluation is then a lookup. This backend is therefore the
+   * fastest one for large radii (in spels) and dense evaluations. It
+   * uses 8 bytes per spel and per field (1 field for the volume, 10
+   * with moments), plus the transient FFT buffers.
+   *
+   * Several radii can be processed at once with initScales(): the
+   * largest ball is digitized once and the shape transform is shared,
+   * one correlation being computed per scale (and per moment), and
+   * each surfel is then visited once (see evalScales()).
+   *
+   * Centers must lie in the bounding box of the Khalimsky space,
+   * possibly enlarged by one spel (outer spels of boundary surfels).
+   *
+   * Transforms use FFTW if DGtal has been built with it (WITH_FFTW3
+   * flag set to "true"), and an in-tree radix-2 implementation
+   * otherwise.
+   *
+   * @tparam TFunctor a model of CCellFunctor, the characteristic
+   * function of the shape ( f(x) ).
+   * @tparam TKSpace a 3D Khalimsky space in which the shape is defined.
+   */
+template< typename TFunctor, typename TKSpace >
+class FFTBallConvolver
+{
+  // ----------------------- Types ------------------------------------------
+public:
+
+  typedef TFunctor Functor;
+  typedef TKSpace KSpace;
+
+  typedef double Quantity;
+  typedef SimpleMatrix< double, 3, 3 > CovarianceMatrix;
+
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Integer Integer;
+  typedef typename KSpace::Space::RealPoint RealPoint;
+
+  typedef ImplicitBall< Z3i::Space > KernelSupport;
+  typedef GaussDigitizer< Z3i::Space, KernelSupport > DigitalKernel;
+
+  BOOST_CONCEPT_ASSERT (( CCellFunctor< Functor > ));
+  BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+  * Constructor.
+  *
+  * @param[in] f a functor f(x) on spels, the characteristic function of the shape.
+  * @param[in] space space in which the shape is defined.
+  */
+  FFTBallConvolver ( ConstAlias< Functor > f,
+                     ConstAlias< KSpace > space );
+
+  /**
+  * Destructor.
+  */
+  ~FFTBallConvolver() {}
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+  * Initialize the convolver with the digitization of an Euclidean
+  * ball of radius @a re at grid step @a h, and computes the
+  * convolutions.
+  *
+  * @param[in] h precision of the grid.
+  * @param[in] re Euclidean radius of the kernel support.
+  * @param[in] withMoments when 'true', the first and second order
+  * moments are computed as well so that evalCovarianceMatrix() can
+  * be used.
+  */
+  void init ( const double h, const double re, bool withMoments = true );
+
+  /**
+  * Initialize the convolver with an arbitrary digital kernel, given
+  * as a set of digital points centered on the origin, and computes
+  * the convolutions.
+  *
+  * @tparam PointIterator a model of forward iterator on Point.
+  * @param[in] itb first point of the kernel.
+  * @param[in] ite end of the range of points of the kernel.
+  * @param[in] withMoments when 'true', first and second order
+  * moments are computed.
+  */
+  template< typename PointIterator >
+  void init ( PointIterator itb, PointIterator ite, bool withMoments = true );
+
+  /**
+  * Initialize the convolver with the digitizations of several
+  * Euclidean balls at grid step @a h, for multi-scale evaluations.
+  * The ball of largest radius is also the kernel of single-scale
+  * evaluations.
+  *
+  * @param[in] h precision of the grid.
+  * @param[in] radii Euclidean radii of the kernel supports, in
+  * increasing order (otherwise nbScales() is 0 and the convolver is
+  * not valid).
+  * @param[in] withMoments when 'true', tables for first and second
+  * order moments are computed so that covariance matrices can be
+  * evaluated.
+  */
+  void initScales ( const double h, const std::vector< double > & radii, bool withMoments = true );
+
+  /**
+  * @return the number of scales (1 after init(), the number of radii after initScales()).
+  */
+  std::size_t nbScales() const;
+
+  /**
+  * Convolve the kernel at a position \a it.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the convolution is computed.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  *
+  * @return the estimated quantity at *it : (f*g)(t)
+  */
+  template< typename SurfelIterator >
+  Quantity eval ( const SurfelIterator & it ) const;
+
+  /**
+  * Convolve the kernel at a position \a it and applies the functor \a functor on the result.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the convolution is computed.
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam EvalFunctor type of functor on Quantity.
+  *
+  * @return the return quantity of functor after giving in parameter the result of the convolution at *it
+  */
+  template< typename SurfelIterator, typename EvalFunctor >
+  typename EvalFunctor::Value eval ( const SurfelIterator & it,
+                                     EvalFunctor functor ) const;
+
+  /**
+  * Convolve the kernel at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void eval ( const SurfelIterator & itbegin,
+              const SurfelIterator & itend,
+              OutputIterator & result ) const;
+
+  /**
+  * Convolve the kernel at all positions of the range [itBegin, itEnd[ and applies the functor \a functor on results outputed sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  * @tparam EvalFunctor type of functor on Quantity.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void eval ( const SurfelIterator & itbegin,
+              const SurfelIterator & itend,
+              OutputIterator & result,
+              EvalFunctor functor ) const;
+
+  /**
+  * Compute the covariance matrix of the kernel at a position \a it.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the covariance matrix is computed.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  *
+  * @return the covariance matrix at *it
+  */
+  template< typename SurfelIterator >
+  CovarianceMatrix evalCovarianceMatrix ( const SurfelIterator & it ) const;
+
+  /**
+  * Compute the covariance matrix of the kernel at a position \a it and applies the functor \a functor on the result.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the covariance matrix is computed.
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  *
+  * @return the result of the functor with the covariance matrix.
+  */
+  template< typename SurfelIterator, typename EvalFunctor >
+  typename EvalFunctor::Value evalCovarianceMatrix ( const SurfelIterator & it,
+                                                     EvalFunctor functor ) const;
+
+  /**
+  * Compute the covariance matrix at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
+  * @param[out] result iterator of an array where estimates covariance matrix are set.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when CovarianceMatrix are stored.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalCovarianceMatrix ( const SurfelIterator & itbegin,
+                              const SurfelIterator & itend,
+                              OutputIterator & result ) const;
+
+  /**
+  * Compute the covariance matrix at all positions of the range [itBegin, itEnd[ and applies the functor \a functor on results outputed sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
+  * @param[out] result iterator of an array where results of functor are set.
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when results are stored.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrix ( const SurfelIterator & itbegin,
+                              const SurfelIterator & itend,
+                              OutputIterator & result,
+                              EvalFunctor functor ) const;
+
+  /**
+  * Volume (number of spels of the shape) of the kernel centered on
+  * a given spel. Can be used to compute dense fields on any set of
+  * voxels, not only on surface spels.
+  *
+  * @param[in] aSpel any spel of the bounding box of the space, enlarged by one.
+  * @return the volume of the intersection between the shape and the kernel centered on @a aSpel.
+  */
+  Quantity volume ( const Spel & aSpel ) const;
+
+  /**
+  * Covariance matrix of the intersection between the shape and the
+  * kernel centered on a given spel.
+  *
+  * @param[in] aSpel any spel of the bounding box of the space, enlarged by one.
+  * @return the covariance matrix.
+  */
+  CovarianceMatrix covarianceMatrix ( const Spel & aSpel ) const;
+
+  /**
+  * Volumes of the kernels of all scales centered on a given spel.
+  *
+  * @param[in] aSpel any spel of the bounding box of the space, enlarged by one.
+  * @param[out] result the volumes, one per scale (resized to nbScales()).
+  */
+  void volumes ( const Spel & aSpel, std::vector< Quantity > & result ) const;
+
+  /**
+  * Covariance matrices of the kernels of all scales centered on a given spel.
+  *
+  * @param[in] aSpel any spel of the bounding box of the space, enlarged by one.
+  * @param[out] result the covariance matrices, one per scale (resized to nbScales()).
+  */
+  void covarianceMatrices ( const Spel & aSpel, std::vector< CovarianceMatrix > & result ) const;
+
+  /**
+  * Convolve the kernels of all scales at all positions of the range
+  * [itBegin, itEnd[ and outputs, for each surfel, the vector of
+  * quantities (one per scale) with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array of std::vector<Quantity>.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of output iterator on std::vector<Quantity>.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalScales ( const SurfelIterator & itbegin,
+                    const SurfelIterator & itend,
+                    OutputIterator & result ) const;
+
+  /**
+  * Compute the covariance matrices of the kernels of all scales at
+  * all positions of the range [itBegin, itEnd[ and outputs, for each
+  * surfel, the vector of matrices (one per scale) with \a result
+  * iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrices are computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrices are computed.
+  * @param[out] result iterator of an array of std::vector<CovarianceMatrix>.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of output iterator on std::vector<CovarianceMatrix>.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalCovarianceMatrixScales ( const SurfelIterator & itbegin,
+                                    const SurfelIterator & itend,
+                                    OutputIterator & result ) const;
+
+  /**
+  * Convolve the kernels of all scales at all positions of the range
+  * [itBegin, itEnd[ and outputs, for each surfel, the vector of the
+  * results of the functor of each scale with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array of std::vector<Quantity>.
+  * @param[in] functors one functor per scale, called with the result of the convolution at this scale.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of output iterator on std::vector<Quantity>.
+  * @tparam EvalFunctor type of functor from Quantity to Quantity.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalScales ( const SurfelIterator & itbegin,
+                    const SurfelIterator & itend,
+                    OutputIterator & result,
+                    const std::vector< EvalFunctor > & functors ) const;
+
+  /**
+  * Compute the covariance matrices of the kernels of all scales at
+  * all positions of the range [itBegin, itEnd[ and outputs, for each
+  * surfel, the vector of the results of the functor of each scale
+  * with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrices are computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrices are computed.
+  * @param[out] result iterator of an array of std::vector<EvalFunctor::Value>.
+  * @param[in] functors one functor per scale, called with the covariance matrix at this scale.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of output iterator on std::vector<EvalFunctor::Value>.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrixScales ( const SurfelIterator & itbegin,
+                                    const SurfelIterator & itend,
+                                    OutputIterator & result,
+                                    std::vector< EvalFunctor > & functors ) const;
+
+  /**
+   * Writes/Displays the object on an output stream.
+   * @param out the output stream where the object is written.
+   */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+   * Checks the validity/consistency of the object.
+   * @return 'true' if the object is valid, 'false' otherwise.
+   */
+  bool isValid() const;
+
+  // ------------------------- Internals ------------------------------------
+protected:
+
+  /**
+   * Computes the fields of volumes (and moments) for a list of kernels.
+   *
+   * @param[in] kernels the digital points of each kernel (one kernel per scale).
+   * @param[in] withMoments when 'true', first and second order moments are computed.
+   */
+  void computeFields ( const std::vector< std::vector< Point > > & kernels, bool withMoments );
+
+  /**
+   * Computes the transform of the characteristic function of the
+   * shape, zero-padded to the current FFT sizes.
+   *
+   * @param[in] fft the transform of the current sizes.
+   */
+  void computeShapeSpectrum ( const RealFFT3D & fft );
+
+  /**
+   * Correlates the shape with a kernel and stores the rounded result
+   * on the enlarged bounding box.
+   *
+   * @param[in] fft the transform of the current sizes.
+   * @param[in] kernel the kernel image, a kernel point q being stored at (q mod size).
+   * @param[out] field the values at each spel of the enlarged bounding box.
+   */
+  void correlate ( const RealFFT3D & fft,
+                   const std::vector< double > & kernel,
+                   std::vector< Quantity > & field ) const;
+
+  /**
+   * @param[in] aCenter any point of the bounding box enlarged by one.
+   * @return the index of @a aCenter in the fields.
+   */
+  std::size_t fieldIndex ( const Point & aCenter ) const;
+
+  /**
+   * @brief computeCovarianceMatrix compute the covariance matrix from matrix of moments.
+   *
+   * @param[in] aMomentMatrix a matrix of digital moments
+   * [ sum(1)
+   *   sum(z) sum(y) sum (x)
+   *   sum(y*z) sum(x*z) sum(x*y)
+   *   sum(z*z) sum(y*y) sum(x*x)
+   * ]
+   * @param[out] aCovarianceMatrix the result covariance matrix
+   */
+  void computeCovarianceMatrix ( const Quantity * aMomentMatrix,
+                                 CovarianceMatrix & aCovarianceMatrix ) const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  const Functor & myFFunctor; ///< Const ref of the shape functor
+
+  const KSpace & myKSpace; ///< Const ref of the shape Kspace
+
+  Point myLowerBound; ///< Lower bound of the shape image (digital point)
+
+  Point myUpperBound; ///< Upper bound of the shape image (digital point)
+
+  std::size_t mySizes[ 3 ]; ///< Padded sizes of the transforms.
+
+  std::vector< RealFFT3D::Complex > myShapeSpectrum; ///< Transform of the padded shape image.
+
+  std::vector< std::vector< Quantity > > myFields; ///< For each scale, the moments of the kernel centered on each spel of the enlarged box, in the order of computeCovarianceMatrix().
+
+  std::size_t myKernelSize; ///< Number of points of the (largest) kernel.
+
+  std::size_t myNbScales; ///< Number of scales.
+
+  unsigned int myNbMoments; ///< Number of fields per scale (1, or 10 with moments).
+
+  // ------------------------- Hidden services ------------------------------
+protected:
+  /**
+  * Constructor.
+  * Forbidden by default (protected to avoid g++ warnings).
+  */
+  FFTBallConvolver ();
+
+private:
+
+  /**
+  * Copy constructor.
+  * @param other the object to clone.
+  * Forbidden by default.
+  */
+  FFTBallConvolver ( const FFTBallConvolver & other );
+
+  /**
+  * Assignment.
+  * @param other the object to copy.
+  * @return a reference on 'this'.
+  * Forbidden by default.
+  */
+  FFTBallConvolver & operator= ( const FFTBallConvolver & other );
+
+}; // end of class FFTBallConvolver
+
+
+/**
+   * Overloads 'operator<<' for displaying objects of class 'FFTBallConvolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FFTBallConvolver' to write.
+   * @return the output stream after the writing.
+   */
+template< typename TF, typename TKS >
+std::ostream&
+operator<< ( std::ostream & out, const FFTBallConvolver< TF, TKS > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/FFTBallConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FFTBallConvolver_h
+
+#undef FFTBallConvolver_RECURSES
+#endif // else defined(FFTBallConvolver_RECURSES)
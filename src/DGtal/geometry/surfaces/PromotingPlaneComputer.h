@@ -0,0 +1,358 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PromotingPlaneComputer.h
+ *
+ * Header file for module PromotingPlaneComputer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PromotingPlaneComputer_RECURSES)
+#error Recursive header files inclusion detected in PromotingPlaneComputer.h
+#else // defined(PromotingPlaneComputer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PromotingPlaneComputer_RECURSES
+
+#if !defined PromotingPlaneComputer_h
+/** Prevents repeated inclusion of headers. */
+#define PromotingPlaneComputer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PromotingPlaneComputer
+  /**
+   * Description of template class 'PromotingPlaneComputer' <p>
+   * \brief Aim: A plane computer that works with fast internal
+   * integers (e.g. int64_t or int128_t) as long as the input points
+   * are small enough for them, and is automatically promoted to a
+   * computer with bigger integers (e.g. BigInteger) as soon as some
+   * input point is too big.
+   *
+   * The bound on the absolute value of the point components depends
+   * on the algorithm and on the integer type (see the notes on
+   * execution times of ChordNaivePlaneComputer and
+   * COBANaivePlaneComputer). For instance, ChordGenericNaivePlaneComputer
+   * is exact for components up to 440000000 with int64_t, and up to
+   * 2^60 with int128_t (when WITH_INT128 is defined).
+   *
+   * On promotion, the points of the fast computer are given to the
+   * promoted one, which is used from then on, until clear() is
+   * called. The overflow is thus detected on the input points, before
+   * any internal computation, and has no cost on the fast path except
+   * one comparison per component.
+   *
+   * @code
+   * typedef ChordGenericNaivePlaneComputer<Z3, Z3::Point, int128_t> FastComputer;
+   * typedef ChordGenericNaivePlaneComputer<Z3, Z3::Point, BigInteger> SafeComputer;
+   * FastComputer fast; fast.init( 1, 1 );
+   * SafeComputer safe; safe.init( 1, 1 );
+   * PromotingPlaneComputer<FastComputer, SafeComputer> plane( fast, safe, 1152921504606846976LL );
+   * plane.extend( Point( 10, 0, 0 ) ); // return 'true', with int128_t
+   * @endcode
+   *
+   * Model of boost::DefaultConstructible, boost::CopyConstructible,
+   * boost::Assignable, CAdditivePrimitiveComputer.
+   *
+   * @tparam TComputer the fast plane computer, a model of
+   * CAdditivePrimitiveComputer storing its input points (e.g.
+   * COBAGenericNaivePlaneComputer or ChordGenericNaivePlaneComputer).
+   *
+   * @tparam TPromotedComputer the same plane computer with bigger
+   * integers, with the same types of primitive and input points.
+   *
+   * @see testPromotingPlaneComputer.cpp
+   */
+  template <typename TComputer, typename TPromotedComputer>
+  class PromotingPlaneComputer
+  {
+    BOOST_CONCEPT_ASSERT(( CAdditivePrimitiveComputer< TComputer > ));
+    BOOST_CONCEPT_ASSERT(( CAdditivePrimitiveComputer< TPromotedComputer > ));
+
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TComputer Computer;
+    typedef TPromotedComputer PromotedComputer;
+    typedef typename Computer::value_type InputPoint;
+    typedef typename InputPoint::Component Component;
+    typedef typename Computer::Point Point;
+    typedef typename Computer::Primitive Primitive;
+    typedef typename Computer::Size Size;
+    typedef typename Computer::ConstIterator ConstIterator;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Primitive, typename PromotedComputer::Primitive >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< ConstIterator, typename PromotedComputer::ConstIterator >::value ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aComputer an initialized fast plane computer (copied and
+     * cleared).
+     * @param aPromotedComputer the same plane computer with bigger
+     * integers, initialized with the same parameters (copied and
+     * cleared).
+     * @param aBound the greatest absolute value of the point
+     * components for which the fast computer is exact.
+     */
+    PromotingPlaneComputer( const Computer & aComputer = Computer(),
+                            const PromotedComputer & aPromotedComputer = PromotedComputer(),
+                            Component aBound = NumberTraits<Component>::max() );
+
+    /**
+     * Destructor.
+     */
+    ~PromotingPlaneComputer();
+
+    /**
+     * Clears the object: it contains no point and uses the fast
+     * computer again. Its parameters are unchanged.
+     */
+    void clear();
+
+    /**
+     * @return 'true' if the points are given to the promoted computer.
+     */
+    bool isPromoted() const;
+
+    /**
+     * @return the greatest absolute value of the point components for
+     * which the fast computer is used.
+     */
+    Component bound() const;
+
+    /**
+     * @return the fast plane computer (empty once promoted).
+     */
+    const Computer & computer() const;
+
+    /**
+     * @return the promoted plane computer (empty until promoted).
+     */
+    const PromotedComputer & promotedComputer() const;
+
+    // ----------------------- Container services ------------------------------
+  public:
+
+    /**
+     * @return the number of distinct points in the current plane.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' if and only if this object contains no point.
+     */
+    bool empty() const;
+
+    /**
+     * @return a const iterator pointing on the first point stored in the current plane.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator pointing after the last point stored in the current plane.
+     */
+    ConstIterator end() const;
+
+    // ----------------------- Primitive services --------------------------------
+  public:
+
+    /**
+     * @param p any point.
+     * @return 'true' if it is in the current plane, false otherwise.
+     */
+    bool operator()( const Point & p ) const;
+
+    /**
+     * Adds the point \a p to this plane if it is within the current
+     * bounds, promoting the object if \a p is too big.
+     *
+     * @param p any input point.
+     * @return 'true' if \a p is compatible with the current plane.
+     */
+    bool extendAsIs( const InputPoint & p );
+
+    /**
+     * Adds the point \a p and checks if we have still a digital plane,
+     * promoting the object if \a p is too big.
+     *
+     * @param p any input point.
+     * @return 'true' if it is still a plane, 'false' if the object
+     * was unchanged (apart from its promotion).
+     */
+    bool extend( const InputPoint & p );
+
+    /**
+     * Checks if we have still a digital plane by adding point \a p.
+     * The object is left unchanged. When \a p is too big for the fast
+     * computer, this check is done on a promoted copy.
+     *
+     * @param p any input point.
+     * @return 'true' if it is still a plane, false otherwise.
+     */
+    bool isExtendable( const InputPoint & p ) const;
+
+    /**
+     * Adds the range of points [\a it, \a itE) and checks if we have
+     * still a digital plane, promoting the object if one of them is
+     * too big.
+     *
+     * @tparam TInputIterator any model of ForwardIterator on InputPoint.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     * @return 'true' if it is still a plane, 'false' if the object
+     * was unchanged (apart from its promotion).
+     */
+    template <typename TInputIterator>
+    bool extend( TInputIterator it, TInputIterator itE );
+
+    /**
+     * Checks if we have still a digital plane by adding the range of
+     * points [\a it, \a itE). The object is left unchanged.
+     *
+     * @tparam TInputIterator any model of ForwardIterator on InputPoint.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     * @return 'true' if it is still a plane, false otherwise.
+     */
+    template <typename TInputIterator>
+    bool isExtendable( TInputIterator it, TInputIterator itE ) const;
+
+    /**
+     * @return the current primitive recognized by this computer.
+     */
+    Primitive primitive() const;
+
+    /**
+     * Gets the normal of the current plane.
+     * @tparam Vector3D any type T such that T.operator[](int i) returns a reference to a double. i ranges in 0,1,2.
+     * @param (updates) the current normal vector
+     */
+    template <typename Vector3D>
+    void getNormal( Vector3D & normal ) const;
+
+    /**
+     * Gets the unit normal of the current plane.
+     * @tparam Vector3D any type T such that T.operator[](int i) returns a reference to a double. i ranges in 0,1,2.
+     * @param (updates) the current unit normal vector
+     */
+    template <typename Vector3D>
+    void getUnitNormal( Vector3D & normal ) const;
+
+    /**
+     * If n is the unit normal to the current plane, then n.x >= min
+     * and n.x <= max are the two half-planes defining it.
+     *
+     * @param min the lower bound (corresponding to the unit vector).
+     * @param max the upper bound (corresponding to the unit vector).
+     */
+    void getBounds( double & min, double & max ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The fast plane computer.
+    Computer myComputer;
+    /// The plane computer with bigger integers.
+    PromotedComputer myPromotedComputer;
+    /// The greatest absolute value of the components for the fast computer.
+    Component myBound;
+    /// 'true' if the points are given to the promoted computer.
+    bool myIsPromoted;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * @param p any input point.
+     * @return 'true' if the fast computer is exact for \a p.
+     */
+    bool isSmall( const InputPoint & p ) const;
+
+    /**
+     * @tparam TInputIterator any model of ForwardIterator on InputPoint.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     * @return 'true' if the fast computer is exact for all the points.
+     */
+    template <typename TInputIterator>
+    bool isSmall( TInputIterator it, TInputIterator itE ) const;
+
+    /**
+     * Gives the points of the fast computer to the promoted computer.
+     */
+    void promote();
+
+  }; // end of class PromotingPlaneComputer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PromotingPlaneComputer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PromotingPlaneComputer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TComputer, typename TPromotedComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const PromotingPlaneComputer<TComputer, TPromotedComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/PromotingPlaneComputer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PromotingPlaneComputer_h
+
+#undef PromotingPlaneComputer_RECURSES
+#endif // else defined(PromotingPlaneComputer_RECURSES)
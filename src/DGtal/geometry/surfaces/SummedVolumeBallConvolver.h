@@ -0,0 +1,640 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SummedVolumeBallConvolver.h
+ * @brief Compute the volume and the covariance matrix of the
+ * intersection between a 3D shape and a ball centered on surface
+ * spels, using summed tables along the rows of the characteristic
+ * image of the shape.
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see DigitalSurfaceConvolver.h IntegralInvariantVolumeMeanCurvatureEstimator.h
+ * IntegralInvariantVolumeGaussianCurvatureEstimator.h
+ */
+
+#if defined(SummedVolumeBallConvolver_RECURSES)
+#error Recursive header files inclusion detected in SummedVolumeBallConvolver.h
+#else // defined(SummedVolumeBallConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SummedVolumeBallConvolver_RECURSES
+
+#if !defined SummedVolumeBallConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define SummedVolumeBallConvolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/SimpleMatrix.h"
+#include "DGtal/kernel/CCellFunctor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class SummedVolumeBallConvolver
+/**
+   * Description of template class 'SummedVolumeBallConvolver' <p>
+   *
+   * \brief Aim: Convolve the characteristic function of a 3D shape
+   * with a digital ball, on every spel adjacent to a surfel, in time
+   * proportional to the ball cross-section instead of its volume.
+   *
+   * At the first call to init(), the characteristic function of the
+   * shape is evaluated once on every spel of the Khalimsky space
+   * bounding box, and three prefix sums are stored along each x-row:
+   * @f$ \sum 1 @f$, @f$ \sum x @f$ and @f$ \sum x^2 @f$ over the
+   * spels lying inside the shape. The digital ball is then stored as a
+   * list of x-runs (one per (y,z) line crossing the ball). The volume
+   * of the ball centered on a spel is obtained by adding one table
+   * difference per run, and the ten moments of order 0 to 2 with a
+   * constant number of operations per run, i.e. in @f$ O(r^2) @f$
+   * instead of @f$ O(r^3) @f$ for DigitalSurfaceConvolver, whatever the
+   * order in which surfels are visited.
+   *
+   * Since the tables only depend on the shape, calling init() again
+   * with another radius (or grid step) only recomputes the list of
+   * runs.
+   *
+   * Several radii can also be processed at once with initScales():
+   * the nested digital balls are stored as incremental shells (the
+   * runs of each ball minus the previous one), so that volumes and
+   * covariance matrices at all scales are obtained for the cost of
+   * the largest ball only (see volumes(), covarianceMatrices() and
+   * evalScales()).
+   *
+   * Results are exactly the ones of DigitalSurfaceConvolver with the
+   * same digital ball: for a surfel, the quantity is the mean of the
+   * quantities computed on its inner and outer spels.
+   *
+   * The tables cover the whole Khalimsky space bounding box. The
+   * table of @f$ \sum 1 @f$ uses 4 bytes per spel. The moment tables
+   * are only allocated when init() is called with @a withMoments set
+   * to true: they use 8 more bytes per spel when the x-rows are at
+   * most 2344 spels wide (the sums of @f$ x^2 @f$ then fit in 32
+   * bits), 16 more bytes otherwise. For instance, a 1000^3 space
+   * needs 4 GB without moments and 12 GB with moments.
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the tables are computed in parallel. The functor @a
+   * f must then be safe to call concurrently.
+   *
+   * @tparam TFunctor a model of CCellFunctor, the characteristic
+   * function of the shape ( f(x) ).
+   * @tparam TKSpace a 3D Khalimsky space in which the shape is defined.
+   */
+template< typename TFunctor, typename TKSpace >
+class SummedVolumeBallConvolver
+{
+  // ----------------------- Types ------------------------------------------
+public:
+
+  typedef TFunctor Functor;
+  typedef TKSpace KSpace;
+
+  typedef double Quantity;
+  typedef SimpleMatrix< double, 3, 3 > CovarianceMatrix;
+
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Integer Integer;
+  typedef typename KSpace::Space::RealPoint RealPoint;
+
+  typedef ImplicitBall< Z3i::Space > KernelSupport;
+  typedef GaussDigitizer< Z3i::Space, KernelSupport > DigitalKernel;
+
+  /// Type used to store the prefix sums of the shape along rows.
+  typedef DGtal::uint32_t CountType;
+  /// Type used to store the prefix sums of the first and second order moments along rows.
+  typedef DGtal::int64_t MomentType;
+  /// Type used to store the same prefix sums along rows of at most 2344 spels.
+  typedef DGtal::uint32_t SmallMomentType;
+
+  BOOST_CONCEPT_ASSERT (( CCellFunctor< Functor > ));
+  BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+
+  /**
+   * A run of the digital ball: all points (x, dy, dz) with
+   * xMin <= x <= xMax belong to the ball centered on the origin.
+   */
+  struct Run
+  {
+    Integer dy;
+    Integer dz;
+    Integer xMin;
+    Integer xMax;
+  };
+  typedef typename std::vector< Run >::const_iterator RunConstIterator;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+  * Constructor.
+  *
+  * @param[in] f a functor f(x) on spels, the characteristic function of the shape.
+  * @param[in] space space in which the shape is defined.
+  */
+  SummedVolumeBallConvolver ( ConstAlias< Functor > f,
+                              ConstAlias< KSpace > space );
+
+  /**
+  * Destructor.
+  */
+  ~SummedVolumeBallConvolver() {}
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+  * Initialize the convolver with the digitization of an Euclidean
+  * ball of radius @a re at grid step @a h.
+  *
+  * Summed tables are computed on the first call only (or if moments
+  * are requested and were not computed before).
+  *
+  * @param[in] h precision of the grid.
+  * @param[in] re Euclidean radius of the kernel support.
+  * @param[in] withMoments when 'true', tables for first and second
+  * order moments are computed so that evalCovarianceMatrix() can be
+  * used.
+  */
+  void init ( const double h, const double re, bool withMoments = true );
+
+  /**
+  * Initialize the convolver with an arbitrary digital kernel, given
+  * as a set of digital points centered on the origin. Each
+  * (y,z)-line of the kernel must be a single run of points
+  * (e.g. the kernel is a digital convex set).
+  *
+  * @tparam PointIterator a model of forward iterator on Point.
+  * @param[in] itb first point of the kernel.
+  * @param[in] ite end of the range of points of the kernel.
+  * @param[in] withMoments when 'true', tables for first and second
+  * order moments are computed.
+  */
+  template< typename PointIterator >
+  void init ( PointIterator itb, PointIterator ite, bool withMoments = true );
+
+  /**
+  * Initialize the convolver with the digitizations of several
+  * Euclidean balls at grid step @a h, for multi-scale evaluations.
+  * The ball of largest radius is also the kernel of single-scale
+  * evaluations.
+  *
+  * @param[in] h precision of the grid.
+  * @param[in] radii Euclidean radii of the kernel supports, in
+  * increasing order (otherwise the convolver has no kernel and is not
+  * valid).
+  * @param[in] withMoments when 'true', tables for first and second
+  * order moments are computed so that covariance matrices can be
+  * evaluated.
+  */
+  void initScales ( const double h, const std::vector< double > & radii, bool withMoments = true );
+
+  /**
+  * @return the number of scales (1 after init(), the number of radii after initScales()).
+  */
+  std::size_t nbScales() const;
+
+  /**
+  * Convolve the kernel at a position \a it.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the convolution is computed.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  *
+  * @return the estimated quantity at *it : (f*g)(t)
+  */
+  template< typename SurfelIterator >
+  Quantity eval ( const SurfelIterator & it ) const;
+
+  /**
+  * Convolve the kernel at a position \a it and applies the functor \a functor on the result.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the convolution is computed.
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam EvalFunctor type of functor on Quantity.
+  *
+  * @return the return quantity of functor after giving in parameter the result of the convolution at *it
+  */
+  template< typename SurfelIterator, typename EvalFunctor >
+  typename EvalFunctor::Value eval ( const SurfelIterator & it,
+                                     EvalFunctor functor ) const;
+
+  /**
+  * Convolve the kernel at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void eval ( const SurfelIterator & itbegin,
+              const SurfelIterator & itend,
+              OutputIterator & result ) const;
+
+  /**
+  * Convolve the kernel at all positions of the range [itBegin, itEnd[ and applies the functor \a functor on results outputed sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  * @tparam EvalFunctor type of functor on Quantity.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void eval ( const SurfelIterator & itbegin,
+              const SurfelIterator & itend,
+              OutputIterator & result,
+              EvalFunctor functor ) const;
+
+  /**
+  * Compute the covariance matrix of the kernel at a position \a it.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the covariance matrix is computed.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  *
+  * @return the covariance matrix at *it
+  */
+  template< typename SurfelIterator >
+  CovarianceMatrix evalCovarianceMatrix ( const SurfelIterator & it ) const;
+
+  /**
+  * Compute the covariance matrix of the kernel at a position \a it and applies the functor \a functor on the result.
+  *
+  * @param[in] it (iterator of a) surfel of the shape where the covariance matrix is computed.
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  *
+  * @return the result of the functor with the covariance matrix.
+  */
+  template< typename SurfelIterator, typename EvalFunctor >
+  typename EvalFunctor::Value evalCovarianceMatrix ( const SurfelIterator & it,
+                                                     EvalFunctor functor ) const;
+
+  /**
+  * Compute the covariance matrix at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
+  * @param[out] result iterator of an array where estimates covariance matrix are set.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when CovarianceMatrix are stored.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalCovarianceMatrix ( const SurfelIterator & itbegin,
+                              const SurfelIterator & itend,
+                              OutputIterator & result ) const;
+
+  /**
+  * Compute the covariance matrix at all positions of the range [itBegin, itEnd[ and applies the functor \a functor on results outputed sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
+  * @param[out] result iterator of an array where results of functor are set.
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when results are stored.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrix ( const SurfelIterator & itbegin,
+                              const SurfelIterator & itend,
+                              OutputIterator & result,
+                              EvalFunctor functor ) const;
+
+  /**
+  * Volume (number of spels of the shape) of the kernel centered on
+  * a given spel. Can be used to compute dense fields on any set of
+  * voxels, not only on surface spels.
+  *
+  * @param[in] aSpel any spel of the space.
+  * @return the volume of the intersection between the shape and the kernel centered on @a aSpel.
+  */
+  Quantity volume ( const Spel & aSpel ) const;
+
+  /**
+  * Covariance matrix of the intersection between the shape and the
+  * kernel centered on a given spel.
+  *
+  * @param[in] aSpel any spel of the space.
+  * @return the covariance matrix.
+  */
+  CovarianceMatrix covarianceMatrix ( const Spel & aSpel ) const;
+
+  /**
+  * Volumes of the kernels of all scales centered on a given spel.
+  *
+  * @param[in] aSpel any spel of the space.
+  * @param[out] result the volumes, one per scale (resized to nbScales()).
+  */
+  void volumes ( const Spel & aSpel, std::vector< Quantity > & result ) const;
+
+  /**
+  * Covariance matrices of the kernels of all scales centered on a given spel.
+  *
+  * @param[in] aSpel any spel of the space.
+  * @param[out] result the covariance matrices, one per scale (resized to nbScales()).
+  */
+  void covarianceMatrices ( const Spel & aSpel, std::vector< CovarianceMatrix > & result ) const;
+
+  /**
+  * Convolve the kernels of all scales at all positions of the range
+  * [itBegin, itEnd[ and outputs, for each surfel, the vector of
+  * quantities (one per scale) with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array of std::vector<Quantity>.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of output iterator on std::vector<Quantity>.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalScales ( const SurfelIterator & itbegin,
+                    const SurfelIterator & itend,
+                    OutputIterator & result ) const;
+
+  /**
+  * Compute the covariance matrices of the kernels of all scales at
+  * all positions of the range [itBegin, itEnd[ and outputs, for each
+  * surfel, the vector of matrices (one per scale) with \a result
+  * iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrices are computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrices are computed.
+  * @param[out] result iterator of an array of std::vector<CovarianceMatrix>.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of output iterator on std::vector<CovarianceMatrix>.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalCovarianceMatrixScales ( const SurfelIterator & itbegin,
+                                    const SurfelIterator & itend,
+                                    OutputIterator & result ) const;
+
+  /**
+  * Convolve the kernels of all scales at all positions of the range
+  * [itBegin, itEnd[ and outputs, for each surfel, the vector of the
+  * results of the functor of each scale with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array of std::vector<Quantity>.
+  * @param[in] functors one functor per scale, called with the result of the convolution at this scale.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of output iterator on std::vector<Quantity>.
+  * @tparam EvalFunctor type of functor from Quantity to Quantity.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalScales ( const SurfelIterator & itbegin,
+                    const SurfelIterator & itend,
+                    OutputIterator & result,
+                    const std::vector< EvalFunctor > & functors ) const;
+
+  /**
+  * Compute the covariance matrices of the kernels of all scales at
+  * all positions of the range [itBegin, itEnd[ and outputs, for each
+  * surfel, the vector of the results of the functor of each scale
+  * with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrices are computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrices are computed.
+  * @param[out] result iterator of an array of std::vector<EvalFunctor::Value>.
+  * @param[in] functors one functor per scale, called with the covariance matrix at this scale.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of output iterator on std::vector<EvalFunctor::Value>.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrixScales ( const SurfelIterator & itbegin,
+                                    const SurfelIterator & itend,
+                                    OutputIterator & result,
+                                    std::vector< EvalFunctor > & functors ) const;
+
+  /**
+  * @return the runs of the current kernel.
+  */
+  const std::vector< Run > & runs() const;
+
+  /**
+   * Writes/Displays the object on an output stream.
+   * @param out the output stream where the object is written.
+   */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+   * Checks the validity/consistency of the object.
+   * @return 'true' if the object is valid, 'false' otherwise.
+   */
+  bool isValid() const;
+
+  // ------------------------- Internals ------------------------------------
+protected:
+
+  /**
+   * Computes the summed tables along x-rows of the characteristic
+   * function of the shape.
+   *
+   * @param[in] withMoments if 'true', tables of moments are computed as well.
+   */
+  void computeTables ( bool withMoments );
+
+  /**
+   * Builds the runs of a kernel from a range of digital points.
+   *
+   * @tparam PointIterator a model of forward iterator on Point.
+   * @param[in] itb first point of the kernel.
+   * @param[in] ite end of the range of points of the kernel.
+   * @param[out] runs the runs of the kernel, one per (y,z)-line.
+   * @return 'false' (and no runs) if some line of the kernel is not
+   * a single run of points.
+   */
+  template< typename PointIterator >
+  bool computeRuns ( PointIterator itb, PointIterator ite, std::vector< Run > & runs ) const;
+
+  /**
+   * Removes the kernel after a failed initialization: nbScales() is
+   * then 0 and isValid() is 'false' until the next init().
+   */
+  void clearKernel ();
+
+  /**
+   * Number of spels of the shape in a range of runs translated by @a aCenter.
+   *
+   * @param[in] aCenter the center of the kernel.
+   * @param[in] itb first run.
+   * @param[in] ite end of the range of runs.
+   * @return the number of spels.
+   */
+  DGtal::int64_t countRuns ( const Point & aCenter, RunConstIterator itb, RunConstIterator ite ) const;
+
+  /**
+   * Adds the moments of order 0 to 2 of the intersection between
+   * the shape and a range of runs translated by @a aCenter, relative
+   * to @a aCenter.
+   *
+   * @param[in] aCenter the center of the kernel.
+   * @param[in] itb first run.
+   * @param[in] ite end of the range of runs.
+   * @param[in,out] aMomentMatrix a matrix of digital moments
+   * [ sum(1)
+   *   sum(z) sum(y) sum (x)
+   *   sum(y*z) sum(x*z) sum(x*y)
+   *   sum(z*z) sum(y*y) sum(x*x)
+   * ]
+   */
+  void addMoments ( const Point & aCenter, RunConstIterator itb, RunConstIterator ite,
+                    Quantity * aMomentMatrix ) const;
+
+  /**
+   * Computes the moments of order 0 to 2 of the intersection
+   * between the shape and the kernel centered on @a aCenter, relative
+   * to @a aCenter.
+   *
+   * @param[in] aCenter the center of the kernel.
+   * @param[out] aMomentMatrix a matrix of digital moments (see addMoments()).
+   */
+  void computeMoments ( const Point & aCenter, Quantity * aMomentMatrix ) const;
+
+  /**
+   * @brief computeCovarianceMatrix compute the covariance matrix from matrix of moments.
+   *
+   * @param[in] aMomentMatrix a matrix of digital moments (see computeMoments()).
+   * @param[out] aCovarianceMatrix the result covariance matrix
+   */
+  void computeCovarianceMatrix ( const Quantity * aMomentMatrix,
+                                 CovarianceMatrix & aCovarianceMatrix ) const;
+
+  /**
+   * @param[in] y the y coordinate of a row.
+   * @param[in] z the z coordinate of a row.
+   * @return the index of the first element of the row (y,z) in the tables.
+   */
+  std::size_t rowOffset ( const Integer y, const Integer z ) const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  const Functor & myFFunctor; ///< Const ref of the shape functor
+
+  const KSpace & myKSpace; ///< Const ref of the shape Kspace
+
+  Point myLowerBound; ///< Lower bound of the tables (digital point)
+
+  Point myUpperBound; ///< Upper bound of the tables (digital point)
+
+  std::vector< CountType > myCounts; ///< Prefix sums of f along x-rows, each row having (width + 1) entries.
+
+  std::vector< MomentType > myFirstMoments; ///< Prefix sums of i.f(i) along x-rows (i is the local abscissa).
+
+  std::vector< MomentType > mySecondMoments; ///< Prefix sums of i^2.f(i) along x-rows (i is the local abscissa).
+
+  std::vector< SmallMomentType > myFirstSmallMoments; ///< Same as myFirstMoments, used instead of it for rows of at most 2344 spels.
+
+  std::vector< SmallMomentType > mySecondSmallMoments; ///< Same as mySecondMoments, used instead of it for rows of at most 2344 spels.
+
+  std::vector< Run > myRuns; ///< Runs of the kernel.
+
+  std::vector< Run > myShellRuns; ///< Runs of the shells of the nested kernels, scale after scale.
+
+  std::vector< std::size_t > myShellOffsets; ///< Index of the first run of each shell in myShellRuns (nbScales()+1 values).
+
+  bool myHasTables; ///< 'true' if the table of counts has been computed.
+
+  bool myHasMoments; ///< 'true' if the tables of moments have been computed.
+
+  bool myHasSmallMoments; ///< 'true' if the tables of moments are myFirstSmallMoments and mySecondSmallMoments.
+
+  // ------------------------- Hidden services ------------------------------
+protected:
+  /**
+  * Constructor.
+  * Forbidden by default (protected to avoid g++ warnings).
+  */
+  SummedVolumeBallConvolver ();
+
+private:
+
+  /**
+  * Copy constructor.
+  * @param other the object to clone.
+  * Forbidden by default.
+  */
+  SummedVolumeBallConvolver ( const SummedVolumeBallConvolver & other );
+
+  /**
+  * Assignment.
+  * @param other the object to copy.
+  * @return a reference on 'this'.
+  * Forbidden by default.
+  */
+  SummedVolumeBallConvolver & operator= ( const SummedVolumeBallConvolver & other );
+
+}; // end of class SummedVolumeBallConvolver
+
+
+/**
+   * Overloads 'operator<<' for displaying objects of class 'SummedVolumeBallConvolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SummedVolumeBallConvolver' to write.
+   * @return the output stream after the writing.
+   */
+template< typename TF, typename TKS >
+std::ostream&
+operator<< ( std::ostream & out, const SummedVolumeBallConvolver< TF, TKS > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/SummedVolumeBallConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SummedVolumeBallConvolver_h
+
+#undef SummedVolumeBallConvolver_RECURSES
+#endif // else defined(SummedVolumeBallConvolver_RECURSES)
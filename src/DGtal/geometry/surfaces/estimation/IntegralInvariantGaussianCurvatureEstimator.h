@@ -49,6 +49,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <iterator>
+#include <vector>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/shapes/GaussDigitizer.h"
@@ -246,6 +248,70 @@ public:
     return result;
   }
 
+  /**
+  * Applies the functor on each covariance matrix of the range [itb,
+  * ite[ and outputs the results sequentially with \a result. Eigen
+  * decompositions are computed by blocks with
+  * EigenValues3D::getEigenDecompositions (eigen vectors are defined up
+  * to their sign, as with the single matrix version).
+  *
+  * @param[in] itb iterator on the first covariance matrix.
+  * @param[in] ite iterator after the last covariance matrix.
+  * @param[out] result iterator where the results are set.
+  *
+  * @tparam ConstIterator type of iterator on Matrix3x3.
+  * @tparam OutputIterator type of output iterator on Value.
+  */
+  template< typename ConstIterator, typename OutputIterator >
+  void evalRange( ConstIterator itb, const ConstIterator & ite, OutputIterator & result )
+  {
+    const std::size_t blockSize = 4096;
+    std::vector< Quantity > coefficients( 18 * blockSize );
+    const Quantity * const matrices[ 6 ] = { &coefficients[ 0 ], &coefficients[ blockSize ],
+                                             &coefficients[ 2 * blockSize ], &coefficients[ 3 * blockSize ],
+                                             &coefficients[ 4 * blockSize ], &coefficients[ 5 * blockSize ] };
+    Quantity * const eigenValues[ 3 ] = { &coefficients[ 6 * blockSize ], &coefficients[ 7 * blockSize ],
+                                          &coefficients[ 8 * blockSize ] };
+    Quantity * eigenVectors[ 9 ];
+    for ( Dimension k = 0; k < 9; ++k )
+    {
+      eigenVectors[ k ] = &coefficients[ ( 9 + k ) * blockSize ];
+    }
+    static const Dimension rows[ 6 ] = { 0, 0, 0, 1, 1, 2 };
+    static const Dimension cols[ 6 ] = { 0, 1, 2, 1, 2, 2 };
+
+    while ( itb != ite )
+    {
+      std::size_t n = 0;
+      for ( ; itb != ite && n < blockSize; ++itb, ++n )
+      {
+        for ( Dimension k = 0; k < 6; ++k )
+        {
+          coefficients[ k * blockSize + n ] = dh5 * (*itb)( rows[ k ], cols[ k ] );
+        }
+      }
+
+      EigenValues3D< Quantity >::getEigenDecompositions( n, matrices, eigenVectors, eigenValues );
+
+      for ( std::size_t i = 0; i < n; ++i )
+      {
+        Value res;
+        for ( Dimension r = 0; r < 3; ++r )
+        {
+          res.values[ r ] = eigenValues[ r ][ i ];
+          for ( Dimension c = 0; c < 3; ++c )
+          {
+            res.vectors.setComponent( r, c, eigenVectors[ 3 * r + c ][ i ] );
+          }
+        }
+        ASSERT ( (res.values[ 0 ] <= res.values[ 1 ]) && (res.values[ 1 ] <= res.values[ 2 ]) );
+        res.k1 = d6_PIr6 * ( res.values[ 1 ] - ( 3.0 * res.values[ 2 ] )) + d8_5r;
+        res.k2 = d6_PIr6 * ( res.values[ 2 ] - ( 3.0 * res.values[ 1 ] )) + d8_5r;
+        *result++ = res;
+      }
+    }
+  }
+
 protected:
   void evalk1k2(
       Matrix3x3 & matrix,
@@ -270,6 +336,65 @@ private:
 
 };
 
+/**
+* Output iterator on covariance matrices which stores them by blocks of
+* \a blockSize and applies Functor::evalRange on each full block (and
+* on the last one with flush()), so that a range of surfels is
+* processed in one pass with a bounded memory.
+*
+* @tparam Matrix3x3 type of the covariance matrices.
+* @tparam Functor type of functor providing evalRange (e.g. PrincipalCurvatureFunctor3).
+* @tparam OutputIterator type of output iterator on Functor::Value.
+*/
+template< typename Matrix3x3, typename Functor, typename OutputIterator >
+class BlockEvalRangeOutputIterator
+{
+public:
+  typedef BlockEvalRangeOutputIterator< Matrix3x3, Functor, OutputIterator > Self;
+  typedef std::output_iterator_tag iterator_category;
+  typedef void value_type;
+  typedef void difference_type;
+  typedef void pointer;
+  typedef void reference;
+
+  BlockEvalRangeOutputIterator( Functor & functor, OutputIterator & result,
+                                const std::size_t blockSize = 4096 )
+    : myFunctor( &functor ), myResult( &result ), myBlockSize( blockSize )
+  {
+    myMatrices.reserve( blockSize );
+  }
+
+  Self & operator=( const Matrix3x3 & aMatrix )
+  {
+    myMatrices.push_back( aMatrix );
+    if ( myMatrices.size() == myBlockSize )
+    {
+      flush();
+    }
+    return *this;
+  }
+
+  Self & operator*() { return *this; }
+  Self & operator++() { return *this; }
+  Self & operator++( int ) { return *this; }
+
+  /// Applies the functor on the stored matrices.
+  void flush()
+  {
+    if ( ! myMatrices.empty() )
+    {
+      myFunctor->evalRange( myMatrices.begin(), myMatrices.end(), *myResult );
+      myMatrices.clear();
+    }
+  }
+
+private:
+  Functor * myFunctor;
+  OutputIterator * myResult;
+  std::size_t myBlockSize;
+  std::vector< Matrix3x3 > myMatrices;
+};
+
 /////////////////////////////////////////////////////////////////////////////
 // template class IntegralInvariantGaussianCurvatureEstimator
 /**
@@ -0,0 +1,328 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IntegralInvariantVolumeGaussianCurvatureEstimator.h
+ *
+ * Header file for module IntegralInvariantVolumeGaussianCurvatureEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IntegralInvariantVolumeGaussianCurvatureEstimator_RECURSES)
+#error Recursive header files inclusion detected in IntegralInvariantVolumeGaussianCurvatureEstimator.h
+#else // defined(IntegralInvariantVolumeGaussianCurvatureEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IntegralInvariantVolumeGaussianCurvatureEstimator_RECURSES
+
+#if !defined IntegralInvariantVolumeGaussianCurvatureEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define IntegralInvariantVolumeGaussianCurvatureEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CCellFunctor.h"
+#include "DGtal/geometry/surfaces/SummedVolumeBallConvolver.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantGaussianCurvatureEstimator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class IntegralInvariantVolumeGaussianCurvatureEstimator
+/**
+* Description of template class 'IntegralInvariantVolumeGaussianCurvatureEstimator' <p>
+* \brief Aim: Integral Invariant Gaussian and principal curvatures
+* estimation on 3D shapes, where the covariance matrix of the ball is
+* computed by a ball convolver working on the whole characteristic
+* image of the shape.
+*
+* This estimator computes the same quantities as
+* IntegralInvariantGaussianCurvatureEstimator (same digital ball, same
+* functors from covariance matrix to curvatures) but does not rely on the
+* 1-step masks of DigitalSurfaceConvolver: the cost of an evaluation
+* does not depend on the order of surfels, and is much lower for
+* large radii. It is therefore suited for dense curvature fields
+* (e.g. on all boundary voxels of a large volume).
+*
+* Note that the convolver must provide evalCovarianceMatrix(...)
+* methods.
+*
+* For scale-space analysis, init() also accepts a list of radii:
+* evalScales() and evalPrincipalCurvaturesScales() then give, for each
+* surfel, the curvatures at all radii, with a single traversal of the
+* surfels and kernels shared between scales (the convolver must
+* provide initScales() and evalCovarianceMatrixScales(), as
+* SummedVolumeBallConvolver and FFTBallConvolver do).
+*
+* @tparam TKSpace 3D space in which the shape is defined.
+* @tparam TShapeFunctor a model of CCellFunctor, the characteristic function of the shape ( f(x) ).
+* @tparam TBallConvolver the ball convolver, constructible from the
+* functor and the space, with methods init( h, radius, withMoments )
+* and evalCovarianceMatrix(...) (default: SummedVolumeBallConvolver).
+*
+* @see IntegralInvariantGaussianCurvatureEstimator SummedVolumeBallConvolver testIntegralInvariantVolumeCurvatureEstimator3D.cpp
+*/
+template < typename TKSpace, typename TShapeFunctor,
+           typename TBallConvolver = SummedVolumeBallConvolver< TShapeFunctor, TKSpace > >
+class IntegralInvariantVolumeGaussianCurvatureEstimator
+{
+public:
+  typedef TKSpace KSpace;
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Space::RealPoint RealPoint;
+
+  typedef TShapeFunctor ShapeSpelFunctor;
+  typedef TBallConvolver Convolver;
+
+  typedef typename Convolver::CovarianceMatrix Matrix3x3;
+
+  typedef GaussianCurvatureFunctor3< Matrix3x3 > ValuesFunctor;
+  typedef PrincipalCurvatureFunctor3< Matrix3x3 > PrincipalCurvatureFunctor;
+
+  typedef typename ValuesFunctor::Value Quantity;
+  typedef typename PrincipalCurvatureFunctor::Value PrincipalCurvatures;
+
+  BOOST_CONCEPT_ASSERT (( CCellFunctor< ShapeSpelFunctor > ));
+  BOOST_STATIC_ASSERT (( KSpace::dimension == 3 ));
+
+  // ----------------------- Standard services ------------------------------
+public:
+  /**
+  * Constructor.
+  *
+  * @param[in] space space in which the shape is defined.
+  * @param[in] f functor on spel of the shape.
+  */
+  IntegralInvariantVolumeGaussianCurvatureEstimator ( ConstAlias< KSpace > space,
+                                                      ConstAlias< ShapeSpelFunctor > f );
+
+  /**
+  * Destructor.
+  */
+  ~IntegralInvariantVolumeGaussianCurvatureEstimator() {}
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+  * Initialise the estimator with a specific Euclidean kernel radius re, and grid step _h.
+  *
+  * @param[in] _h precision of the grid
+  * @param[in] re Euclidean radius of the kernel support
+  */
+  void init ( const double _h, const double re );
+
+  /**
+  * Initialise the estimator for multi-scale evaluations, with
+  * several Euclidean kernel radii and grid step _h. Single-scale
+  * evaluations then use the largest radius.
+  *
+  * @param[in] _h precision of the grid
+  * @param[in] radii Euclidean radii of the kernel supports, in increasing order.
+  */
+  void init ( const double _h, const std::vector< double > & radii );
+
+  /**
+  * -- Gaussian curvature --
+  * Compute the integral invariant Gaussian curvature at surfel *it of a shape.
+  *
+  * @tparam SurfelIterator type of Iterator on a Surfel
+  *
+  * @param[in] it iterator of a surfel (from a shape) we want compute the integral invariant Gaussian curvature.
+  *
+  * @return quantity (Gaussian curvature) at surfel *it
+  */
+  template< typename SurfelIterator >
+  Quantity eval ( const SurfelIterator & it );
+
+  /**
+  * -- Gaussian curvature --
+  * Compute the integral invariant Gaussian curvature from two surfels (from *itb to *ite (exclude) ) of a shape.
+  * Return the result on an OutputIterator (param).
+  *
+  * @tparam SurfelIterator type of Iterator on a Surfel
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  *
+  * @param[in] itb iterator of the begin surfel on the shape we want compute the integral invariant Gaussian curvature.
+  * @param[in] ite iterator of the end surfel (excluded) on the shape we want compute the integral invariant Gaussian curvature.
+  * @param[out] result iterator of results of the computation.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void eval ( const SurfelIterator & itb,
+              const SurfelIterator & ite,
+              OutputIterator & result );
+
+  /**
+  * -- Principal curvatures --
+  * Compute the integral invariant principal curvatures on surfel *it of a shape.
+  *
+  * @tparam SurfelIterator iterator on a Surfel
+  *
+  * @param[in] it iterator of a surfel (from a shape) we want compute the integral invariant principal curvatures.
+  *
+  * @return a struct with principal curvatures value of Integral Invariant estimator at surfel *it, and eigenVectors
+  * and eigenValues resulting of the covariance matrix (see struct CurvatureInformations )
+  */
+  template< typename SurfelIterator >
+  PrincipalCurvatures evalPrincipalCurvatures ( const SurfelIterator & it );
+
+  /**
+  * -- Principal curvatures --
+  * Compute the integral invariant principal curvatures from two surfels (from *itb to *ite (exclude) ) of a shape.
+  * Return the result on an OutputIterator (param).
+  *
+  * @tparam SurfelIterator iterator on a Surfel
+  * @tparam OutputIterator iterator of array of PrincipalCurvatures
+  *
+  * @param[in] itb iterator of the begin surfel on the shape where we compute the integral invariant principal curvatures.
+  * @param[in] ite iterator of the end surfel (excluded) on the shape where we compute the integral invariant principal curvatures.
+  * @param[out] result iterator of structs with principal curvatures value of Integral Invariant estimator.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalPrincipalCurvatures ( const SurfelIterator & itb,
+                                 const SurfelIterator & ite,
+                                 OutputIterator & result );
+
+  /**
+  * -- Gaussian curvature, multi-scale --
+  * Compute the integral invariant Gaussian curvatures at all radii
+  * given to init(), from two surfels (from *itb to *ite (exclude) ) of
+  * a shape. For each surfel, a std::vector<Quantity> (one value per
+  * radius) is written on the OutputIterator (param).
+  *
+  * @tparam SurfelIterator type of Iterator on a Surfel
+  * @tparam OutputIterator type of Iterator of an array of std::vector<Quantity>
+  *
+  * @param[in] itb iterator of the begin surfel on the shape we want compute the integral invariant Gaussian curvature.
+  * @param[in] ite iterator of the end surfel (excluded) on the shape we want compute the integral invariant Gaussian curvature.
+  * @param[out] result iterator of results of the computation.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalScales ( const SurfelIterator & itb,
+                    const SurfelIterator & ite,
+                    OutputIterator & result );
+
+  /**
+  * -- Principal curvatures, multi-scale --
+  * Compute the integral invariant principal curvatures at all radii
+  * given to init(), from two surfels (from *itb to *ite (exclude) ) of
+  * a shape. For each surfel, a std::vector<PrincipalCurvatures> (one
+  * value per radius) is written on the OutputIterator (param).
+  *
+  * @tparam SurfelIterator iterator on a Surfel
+  * @tparam OutputIterator iterator of array of std::vector<PrincipalCurvatures>
+  *
+  * @param[in] itb iterator of the begin surfel on the shape where we compute the integral invariant principal curvatures.
+  * @param[in] ite iterator of the end surfel (excluded) on the shape where we compute the integral invariant principal curvatures.
+  * @param[out] result iterator of results of the computation.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalPrincipalCurvaturesScales ( const SurfelIterator & itb,
+                                       const SurfelIterator & ite,
+                                       OutputIterator & result );
+
+  /**
+  * @return the radii of the scales (a single radius after init( h, re )).
+  */
+  const std::vector< double > & radii() const;
+
+  /**
+  * @return a const reference to the ball convolver.
+  */
+  const Convolver & convolver() const;
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  Convolver myConvolver; ///< Convolver
+
+  double h; ///< precision of the grid
+
+  double radius; ///< Euclidean radius of the kernel
+
+  ValuesFunctor gaussFunctor; ///< Functor to transform covarianceMatrix to Quantity
+  PrincipalCurvatureFunctor princCurvFunctor; ///< Functor to transform covarianceMatrix to PrincipalCurvatures
+
+  std::vector< double > myRadii; ///< Euclidean radii of the kernels of each scale
+
+  std::vector< ValuesFunctor > myScaleGaussFunctors; ///< Functors to transform covarianceMatrix to Quantity at each scale
+  std::vector< PrincipalCurvatureFunctor > myScalePrincCurvFunctors; ///< Functors to transform covarianceMatrix to PrincipalCurvatures at each scale
+
+private:
+
+  /**
+  * Copy constructor.
+  * @param other the object to clone.
+  * Forbidden by default.
+  */
+  IntegralInvariantVolumeGaussianCurvatureEstimator ( const IntegralInvariantVolumeGaussianCurvatureEstimator & other );
+
+  /**
+  * Assignment.
+  * @param other the object to copy.
+  * @return a reference on 'this'.
+  * Forbidden by default.
+  */
+  IntegralInvariantVolumeGaussianCurvatureEstimator & operator= ( const IntegralInvariantVolumeGaussianCurvatureEstimator & other );
+
+}; // end of class IntegralInvariantVolumeGaussianCurvatureEstimator
+
+
+/**
+* Overloads 'operator<<' for displaying objects of class 'IntegralInvariantVolumeGaussianCurvatureEstimator'.
+* @param out the output stream where the object is written.
+* @param object the object of class 'IntegralInvariantVolumeGaussianCurvatureEstimator' to write.
+* @return the output stream after the writing.
+*/
+template <typename TKS, typename TSF, typename TBC>
+std::ostream&
+operator<< ( std::ostream & out, const IntegralInvariantVolumeGaussianCurvatureEstimator<TKS, TSF, TBC> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeGaussianCurvatureEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IntegralInvariantVolumeGaussianCurvatureEstimator_h
+
+#undef IntegralInvariantVolumeGaussianCurvatureEstimator_RECURSES
+#endif // else defined(IntegralInvariantVolumeGaussianCurvatureEstimator_RECURSES)
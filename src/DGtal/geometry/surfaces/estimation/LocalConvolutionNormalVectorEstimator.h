@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/base/CountedPtr.h"
@@ -72,6 +74,10 @@ namespace DGtal
    * The weight kernel function maps displacment vectors  to a
    * continuous weights.
    *
+   * Several radii may be given to init() for multi-scale analysis: a
+   * single breadth-first propagation up to the largest radius then
+   * gives the normal vectors at all radii (see evalScales()).
+   *
    * @warning moved to deprecated since 0.7. Please consider using
    * LocalEstimatorFromFunctorAdapter.
    *
@@ -127,6 +133,16 @@ namespace DGtal
     void init(const double h,
               const unsigned int radius);
 
+    /**
+     * Initialisation for multi-scale evaluations.
+     * @param h grid size (must be >0).
+     * @param radii topological radii (all > 0) used to specify the
+     * sizes of the convolution. Single-scale evaluations use the
+     * largest one.
+     */
+    void init(const double h,
+              const std::vector<unsigned int> & radii);
+
     /**
        @param scell any signed cell.
        @return the estimated quantity at cell \e scell.
@@ -155,6 +171,33 @@ namespace DGtal
     template <typename OutputIterator>
     OutputIterator evalAll( OutputIterator result ) const;
 
+    /**
+       Writes on \e result the estimated quantities at cell \e scell,
+       one for each radius given to init(), with a single
+       breadth-first propagation. The quantity is the null vector when
+       the weighted sum of the elementary normals is null.
+       @param scell any signed cell.
+       @param result any model of boost::OutputIterator on Quantity.
+       @return the output iterator after the last write.
+     */
+    template <typename OutputIterator>
+    OutputIterator evalScales(const SCell & scell,
+                              OutputIterator result) const;
+
+    /**
+       Writes on \e result, for each surfel from itb till ite
+       (excluded), the std::vector of its estimated quantities (one
+       for each radius given to init()).
+       @param itb the first surfel.
+       @param ite the end of the range of surfels.
+       @param result any model of boost::OutputIterator on std::vector<Quantity>.
+       @return the output iterator after the last write.
+     */
+    template <typename OutputIterator>
+    OutputIterator evalScales(const ConstIterator& itb,
+                              const ConstIterator& ite,
+                              OutputIterator result) const;
+
 
     /**
      * Checks the validity/consistency of the object.
@@ -185,6 +228,9 @@ namespace DGtal
     /// Radius of the convolution.
     unsigned int myRadius;
 
+    /// Radii of the convolution for multi-scale evaluations.
+    std::vector<unsigned int> myRadii;
+
     /// Reference to the digital surface
     const DigitalSurface & mySurface;
 
@@ -42,6 +42,8 @@
 // Inclusions
 #include <iostream>
 #include <algorithm>
+#include <iterator>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -79,6 +81,20 @@ namespace DGtal
    * @snippet testSphericalAccumulator.cpp SphericalAccum-init
    * @snippet testSphericalAccumulator.cpp SphericalAccum-add
    *
+   * Large sets of directions are better added with addDirections,
+   * which distributes the samples among per-thread accumulators
+   * (when compiled with OpenMP and given random access iterators)
+   * and merges them at the end:
+   * @snippet testSphericalAccumulator.cpp SphericalAccum-addDirections
+   * Accumulators with the same number of slices can also be
+   * filled independently and then merged (see merge).
+   *
+   * The bin lookup does not use trigonometric functions: the bounds
+   * of the phi slices and the bounds of the theta bins of each slice
+   * are precomputed as pseudo-angles (see pseudoAngle), together
+   * with lookup tables that give the bin coordinates in almost
+   * constant time.
+   *
    * Once the accumulator is filled up with directions, you can get
    * the representative direction for each bin and the bin with
    * maximal number of samples.
@@ -148,6 +164,40 @@ namespace DGtal
      */
     void addDirection(const Vector &aDir);
 
+    /**
+     * Adds the directions of the range [@a itb, @a ite) into the
+     * accumulator. If DGtal is compiled with OpenMP and the
+     * iterators are random access, the directions are
+     * accumulated in parallel into per-thread accumulators, which
+     * are then merged. Otherwise, addDirection is called on each
+     * direction.
+     *
+     * @param itb begin iterator on directions.
+     * @param ite end iterator on directions.
+     * @tparam TConstIterator a model of forward iterator whose
+     * value type is Vector.
+     *
+     * @note In the parallel case, the maximal bin is updated as in
+     * merge, hence it may differ from the serial case when several
+     * bins have the maximal count.
+     */
+    template <typename TConstIterator>
+    void addDirections(const TConstIterator &itb,
+                       const TConstIterator &ite);
+
+    /**
+     * Adds the bin counts, the representative directions and the
+     * number of samples of @a other to this accumulator. The
+     * maximal bin becomes the bin with the greatest count (the
+     * current one if it is still maximal).
+     *
+     * @pre @a other has the same number of slices as this
+     * accumulator.
+     *
+     * @param other any other accumulator.
+     */
+    void merge(const SphericalAccumulator &other);
+
     /**
      * Given a normalized direction, this method computes the bin
      * coordinates.
@@ -359,6 +409,26 @@ namespace DGtal
     ///Theta coordinate of the max bin
     Size myMaxBinTheta;
 
+    ///Pseudo-angles of the bounds between consecutive phi slices
+    ///(myNphi-1 increasing values, see pseudoAngle)
+    std::vector<double> myPhiBounds;
+
+    ///Lookup cells of myPhiBounds (see locate)
+    std::vector<Size> myPhiCells;
+
+    ///Pseudo-angles of the bounds between consecutive theta bins,
+    ///slice by slice
+    std::vector<double> myThetaBounds;
+
+    ///Index in myThetaBounds of the first bound of each slice
+    ///(myNphi+1 values, the number of bins of slice i is
+    ///myThetaOffsets[i+1]-myThetaOffsets[i])
+    std::vector<Size> myThetaOffsets;
+
+    ///Lookup cells of myThetaBounds, slice by slice (twice as many
+    ///cells as bounds)
+    std::vector<Size> myThetaCells;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -389,6 +459,90 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Returns a pseudo-angle of the 2D vector (@a x, @a y), ie. a
+     * value in [0,4) that increases with the angle between the x
+     * axis and (@a x, @a y) in [0,2pi), computed without
+     * trigonometric functions.
+     *
+     * @param x first coordinate.
+     * @param y second coordinate.
+     * @return the pseudo-angle of (@a x, @a y).
+     */
+    static double pseudoAngle(const double x, const double y);
+
+    /**
+     * @param i index of a bound.
+     * @param n number of bins over a whole turn.
+     * @return the pseudo-angle of the bound between the bins @a i
+     * and @a i+1, ie. of the angle (@a i+1/2) 2pi / @a n.
+     */
+    static double boundPseudoAngle(const Size i, const Size n);
+
+    /**
+     * Computes the lookup cells of a sorted range of bounds: the
+     * range [0, @a aRange) is split into 2 @a aNb cells of equal
+     * length, and each cell stores the number of bounds that lie in
+     * the previous cells.
+     *
+     * @param aBounds the sorted bounds.
+     * @param aCells the 2 @a aNb cells to compute.
+     * @param aNb the number of bounds.
+     * @param aRange the upper bound of the values.
+     */
+    static void initCells(const double* aBounds, Size* aCells,
+                          const Size aNb, const double aRange);
+
+    /**
+     * Returns the number of bounds lower or equal to @a aValue. The
+     * cell of @a aValue gives a first guess, which is refined by a
+     * linear scan (of a few bounds, since the pseudo-angles are
+     * almost uniform).
+     *
+     * @param aBounds the sorted bounds.
+     * @param aCells the lookup cells computed by initCells.
+     * @param aNb the number of bounds.
+     * @param aRange the upper bound of the values.
+     * @param aValue any value in [0, @a aRange].
+     * @return the number of bounds lower or equal to @a aValue.
+     */
+    static Size locate(const double* aBounds, const Size* aCells,
+                       const Size aNb, const double aRange,
+                       const double aValue);
+
+    /**
+     * @param aDir a direction.
+     * @return the index of the bin containing @a aDir in
+     * myAccumulator.
+     */
+    Size binIndex(const Vector &aDir) const;
+
+    /**
+     * Adds a direction to its bin, without updating the maximal bin.
+     * @param aDir a direction.
+     */
+    void accumulate(const Vector &aDir);
+
+    /**
+     * Adds directions given by a random access range, in parallel.
+     * @param itb begin iterator on directions.
+     * @param ite end iterator on directions.
+     */
+    template <typename TConstIterator>
+    void addDirections(const TConstIterator &itb,
+                       const TConstIterator &ite,
+                       std::random_access_iterator_tag);
+
+    /**
+     * Adds directions given by a forward range, one by one.
+     * @param itb begin iterator on directions.
+     * @param ite end iterator on directions.
+     */
+    template <typename TConstIterator>
+    void addDirections(const TConstIterator &itb,
+                       const TConstIterator &ite,
+                       std::input_iterator_tag);
+
   }; // end of class SphericalAccumulator
 
 
@@ -46,8 +46,8 @@
 #include "DGtal/base/Clone.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
-#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
-#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
 #include "DGtal/kernel/CPointPredicate.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -69,10 +69,21 @@ namespace DGtal
    * @f[ \alpha^d @f]
    * for @f$ 0< \alpha < 1@f$ specified at construction step.
    *
+   * Random values are given by a counter-based generator: the value
+   * drawn at a point only depends on a seed and on the point
+   * coordinates (see uniformRandom()). There is no global state, the
+   * noisy value of any point can be computed independently, and the
+   * result for a given seed does not depend on the number of threads.
+   * The constructor without seed draws the seed with rand().
+   *
+   * Noisy objects can be computed straight into a dense bit image
+   * (see computeNoisyImage()), in parallel if DGtal has been built
+   * with OpenMP support.
+   *
    * @note This class explicitely stores the noisy point predicate in a digital set container
-   * model. Furthermore, the distance is given by the DistanceTransformation class with the
+   * model. Furthermore, the distance is given by the OutOfCoreDistanceTransformation class with the
    * Eucliean metric (the distance is computed on both true and false points from the point
-   * predicate in the given domain).
+   * predicate in the given domain). The domain must be an HyperRectDomain.
    *
    * @tparam TPointPredicate any model of point predicate concept (CPointPredicate)
    * @tparam TDomain any model of CDomain
@@ -102,6 +113,9 @@ namespace DGtal
     
     ///DigitalSet type
     typedef TDigitalSetContainer DigitalSet;
+
+    ///Dense bit image type (one bit per point of the domain)
+    typedef ImageContainerBySTLVector<Domain, bool> BitImage;
    
     /**
      * Constructor.
@@ -115,6 +129,20 @@ namespace DGtal
     KanungoNoise(ConstAlias<PointPredicate> aPredicate,
                  ConstAlias<Domain> aDomain,
                  const double anAlpha);
+
+    /**
+     * Constructor with a seed: two instances with the same parameters
+     * define the same noisy object.
+     *
+     * @param aPredicate input point predicate defining the input objects.
+     * @param aDomain domain used for the distance transformation computation.
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed seed of the random values.
+     */
+    KanungoNoise(ConstAlias<PointPredicate> aPredicate,
+                 ConstAlias<Domain> aDomain,
+                 const double anAlpha,
+                 const DGtal::uint64_t aSeed);
      
     /**
      * Destructor.
@@ -140,6 +168,39 @@ namespace DGtal
      *
      **/
     bool operator()(const Point &aPoint) const;
+
+    /**
+     * @return the seed of the random values.
+     */
+    DGtal::uint64_t seed() const;
+
+    /**
+     * Counter-based random generator.
+     *
+     * @param aPoint a point.
+     * @param aSeed a seed.
+     * @return a uniform random value in [0,1) which only depends on
+     * @a aPoint and @a aSeed.
+     */
+    static double uniformRandom(const Point &aPoint, const DGtal::uint64_t aSeed);
+
+    /**
+     * Computes a noisy version of a point predicate into a dense bit
+     * image, without any intermediate digital set. Points are
+     * processed in parallel (OpenMP), by blocks of whole words of the
+     * bit image.
+     *
+     * @param aPredicate input point predicate defining the input objects.
+     * @param aDomain domain used for the distance transformation computation.
+     * @param anAlpha noise parameter between ]0,1[.
+     * @param aSeed seed of the random values.
+     * @param [out] anImage the noisy object (its domain must be @a aDomain).
+     */
+    static void computeNoisyImage(const PointPredicate &aPredicate,
+                                  const Domain &aDomain,
+                                  const double anAlpha,
+                                  const DGtal::uint64_t aSeed,
+                                  BitImage &anImage);
     
     
     /**
@@ -174,6 +235,19 @@ namespace DGtal
 
        // ------------------------- Internals ------------------------------------
   private:
+
+    /**
+     * Fills the digital set from the noisy bit image.
+     */
+    void init();
+
+    /**
+     * Mixing function of the counter-based generator (SplitMix64).
+     * @param h a 64 bits value.
+     * @return the mixed value.
+     */
+    static DGtal::uint64_t mix(DGtal::uint64_t h);
+
     ///Pointeur to the object
     const PointPredicate &myPredicate;
     
@@ -185,6 +259,9 @@ namespace DGtal
     
     ///Noise parameter
     double myAlpha;
+
+    ///Seed of the random values
+    DGtal::uint64_t mySeed;
     
   }; // end of class KanungoNoise
 
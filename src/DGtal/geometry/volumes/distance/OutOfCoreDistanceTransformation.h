@@ -0,0 +1,302 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreDistanceTransformation.h
+ * @brief Squared Euclidean distance transformation computed slab by slab
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testOutOfCoreDistanceTransformation.cpp
+ */
+
+#if defined(OutOfCoreDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreDistanceTransformation.h
+#else // defined(OutOfCoreDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreDistanceTransformation_RECURSES
+
+#if !defined OutOfCoreDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreDistanceTransformation
+  /**
+   * Description of template class 'OutOfCoreDistanceTransformation' <p>
+   * \brief Aim: Implementation of the separable squared Euclidean
+   * distance transformation for images that do not fit in memory.
+   *
+   * Given a domain and a point predicate, the squared @f$ l_2@f$
+   * distance from each point of the domain to the closest point for
+   * which the predicate is false is written in an output image. The
+   * separable algorithm is the one of VoronoiMap / DistanceTransformation
+   * (lower envelope of parabolas along each dimension,
+   * @cite Maurer2003PAMI), but:
+   *
+   * - no Voronoi map is built: between two passes, each point only
+   *   stores its partial squared distance (one integer of type
+   *   TImage::Value instead of a full point);
+   * - the passes are done in place in the output image, slab by
+   *   slab: a slab is a range of @a slabWidth hyperplanes orthogonal
+   *   to a dimension different from the one of the current pass, so
+   *   that only one slab is held in memory at once.
+   *
+   * The output image can then be any model of CImage, for instance a
+   * TiledImage whose tiles are backed by an HDF5 file (see
+   * ImageFactoryFromHDF5). For such images, choose @a slabWidth as a
+   * multiple of the tile width so that each tile is read and written
+   * once per pass. The point predicate is only evaluated during the
+   * first pass, slab by slab too.
+   *
+   * Points with no background point in the whole domain get the value
+   * infinity() (the largest TImage::Value).
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), the 1D problems of a slab are solved in parallel. Image
+   * accesses are sequential and done row by row (see rowFromImage and
+   * imageFromRow), so that tiled or hashed images are only looked up
+   * once per row.
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace).
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of CPointPredicate)
+   * @tparam TImage the output image (model of CImage) whose values are
+   * integers large enough to store squared distances (e.g.
+   * DGtal::uint32_t for 2048^3 domains). Its domain must be
+   * HyperRectDomain<TSpace>.
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TImage >
+  class OutOfCoreDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( CImage<TImage> ));
+
+    ///Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Point,
+                          typename TPointPredicate::Point >::value ));
+
+    //ImageContainer::Domain::Space must match with TSpace
+    BOOST_STATIC_ASSERT ((boost::is_same< TSpace,
+                          typename TImage::Domain::Space >::value ));
+
+    //ImageContainer domain type must be  HyperRectangular
+    BOOST_STATIC_ASSERT ((boost::is_same< HyperRectDomain<TSpace>,
+                          typename TImage::Domain >::value ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Definition of the underlying domain type.
+    typedef typename TImage::Domain Domain;
+
+    ///Type of the output image.
+    typedef TImage OutputImage;
+
+    ///Squared distance type.
+    typedef typename TImage::Value Value;
+
+    ///Type used for the computations on squared distances.
+    typedef DGtal::int64_t Promoted;
+
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Point::Coordinate Abscissa;
+
+    ///Self type
+    typedef OutOfCoreDistanceTransformation<TSpace, TPointPredicate, TImage> Self;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * This constructor computes the squared distance transformation
+     * of @a aPredicate on @a aDomain into @a anImage.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed (must be included in the
+     * domain of @a anImage).
+     * @param predicate a pointer to the point predicate to define the
+     * Voronoi sites (false points).
+     * @param anImage the output image.
+     * @param slabWidth the number of hyperplanes of a slab.
+     */
+    OutOfCoreDistanceTransformation( ConstAlias<Domain> aDomain,
+                                     ConstAlias<PointPredicate> predicate,
+                                     Alias<OutputImage> anImage,
+                                     const Size slabWidth = 1 );
+
+    /**
+     * Default destructor
+     */
+    ~OutOfCoreDistanceTransformation();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the value given to points which have no background point
+     * in the domain.
+     */
+    static Value infinity();
+
+    /**
+     * @return the domain of the computation.
+     */
+    const Domain & domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * @return the number of hyperplanes of a slab.
+     */
+    Size slabWidth() const
+    {
+      return mySlabWidth;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return mySlabWidth > 0;
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Compute the distance transformation: one pass per dimension.
+     */
+    void compute ( ) ;
+
+    /**
+     * Process the 1D problems along dimension @a dim, slab by slab.
+     *
+     * @param dim the dimension of the pass.
+     */
+    void computePass( const Dimension dim );
+
+    /**
+     * Solve a 1D problem: lower envelope of the parabolas
+     * @f$ f(i) + (x-i)^2 @f$ along a line of a slab buffer.
+     *
+     * @param line the first value of the line (replaced by the result).
+     * @param n the number of values of the line.
+     * @param stride the distance between consecutive values.
+     * @param sites a work buffer for site abscissas.
+     * @param values a work buffer for site values.
+     */
+    void computeLine( Value * line, const Size n, const Size stride,
+                      std::vector<Promoted> & sites,
+                      std::vector<Promoted> & values ) const;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    OutOfCoreDistanceTransformation( const OutOfCoreDistanceTransformation & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    OutOfCoreDistanceTransformation & operator=( const OutOfCoreDistanceTransformation & other );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the output image
+    OutputImage * myImagePtr;
+
+    ///Number of hyperplanes of a slab
+    Size mySlabWidth;
+
+  }; // end of class OutOfCoreDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename I>
+  std::ostream&
+  operator<< ( std::ostream & out, const OutOfCoreDistanceTransformation<S,P,I> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreDistanceTransformation_h
+
+#undef OutOfCoreDistanceTransformation_RECURSES
+#endif // else defined(OutOfCoreDistanceTransformation_RECURSES)
@@ -45,6 +45,7 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -81,7 +82,9 @@ namespace DGtal
    * The output is an image associating ball radii (weight of the
    * power map site) to maximal ball centers. Most methods output a
    * lightweight proxy to an image container (of type ImageContainer,
-   * see below).
+   * see below). For large volumes, the balls can also be extracted
+   * (in parallel with OpenMP) into a compact array of (center,
+   * weight) pairs (see BallVector).
    *
    * @note Following ReverseDistanceTransformation, the input shape is
    * defined as points with negative power distance.
@@ -100,6 +103,13 @@ namespace DGtal
     //MA Container
     typedef Image<TImageContainer> Type;
 
+    typedef typename TPowerMap::Point Point;
+    typedef typename TPowerMap::Weight Weight;
+    typedef typename TPowerMap::Domain Domain;
+
+    ///Compact medial axis: (center, weight) of each maximal ball
+    typedef std::vector< std::pair<Point, Weight> > BallVector;
+
     /** 
      * Extract reduced medial axis from a power map.
      * This methods is in @f$ O(|powerMap|)@f$. 
@@ -112,22 +122,106 @@ namespace DGtal
     static 
     Type getReducedMedialAxisFromPowerMap(const TPowerMap &aPowerMap) 
     {
-      typename TPowerMap::Value v;
+      BallVector balls;
+      getReducedMedialAxisFromPowerMap( aPowerMap, balls );
+
       TImageContainer *computedMA = new TImageContainer( aPowerMap.domain() );
-      for (typename TPowerMap::Domain::ConstIterator it = aPowerMap.domain().begin(), 
-             itend = aPowerMap.domain().end(); it != itend; ++it)
+      for (typename BallVector::const_iterator it = balls.begin(), itend = balls.end();
+           it != itend; ++it)
+        computedMA->setValue( it->first, it->second );
+      return Type( computedMA );
+    }
+
+    /** 
+     * Extract reduced medial axis from a power map into a compact
+     * array of (center, weight) pairs, sorted in the domain scanning
+     * order (first coordinate varying first). This methods is in
+     * @f$ O(|powerMap|)@f$, the rows of the domain being scanned in
+     * parallel when DGtal is built with OpenMP. Only one flag per
+     * domain point is used as temporary storage, which makes this
+     * method much lighter than the image based one on large volumes.
+     *
+     * @param aPowerMap the input powerMap
+     * @param [out] balls the maximal balls (previous content is erased).
+     */
+    static 
+    void getReducedMedialAxisFromPowerMap(const TPowerMap &aPowerMap,
+                                          BallVector &balls) 
+    {
+      const Domain &domain = aPowerMap.domain();
+      const Point lower = domain.lowerBound();
+      const Point extent = domain.upperBound() - lower + Point::diagonal(1);
+
+      //Strides of the domain linearization
+      Point stride;
+      DGtal::int64_t size = 1;
+      for (Dimension d = 0; d < Point::dimension; ++d)
+        {
+          stride[d] = static_cast<typename Point::Coordinate>( size );
+          size *= extent[d];
+        }
+      
+      //Flags of the sites defining a maximal ball
+      std::vector<unsigned char> isMaximal( size, 0 );
+      const DGtal::int64_t nbRows = size / extent[0];
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+      for (DGtal::int64_t r = 0; r < nbRows; ++r)
         {
-          v =  aPowerMap(*it);
-          if  (aPowerMap.metricPtr()->powerDistance(*it, 
-                                                    v,
-                                                    aPowerMap.weightImagePtr()->operator()( v )) 
-               < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
-            
-            computedMA->setValue( v,
-                                  aPowerMap.weightImagePtr()->operator()( v ));
+          //First point of the row
+          Point p = lower;
+          DGtal::int64_t q = r;
+          for (Dimension d = 1; d < Point::dimension; ++d)
+            {
+              p[d] += static_cast<typename Point::Coordinate>( q % extent[d] );
+              q /= extent[d];
+            }
+
+          for (typename Point::Coordinate i = 0; i < extent[0]; ++i, ++p[0])
+            {
+              const typename TPowerMap::Value v = aPowerMap( p );
+              if ( ! domain.isInside( v ) )
+                continue;
+
+              DGtal::int64_t index = 0;
+              for (Dimension d = 0; d < Point::dimension; ++d)
+                index += static_cast<DGtal::int64_t>( v[d] - lower[d] ) * stride[d];
+              unsigned char flag;
+#ifdef WITH_OPENMP
+#pragma omp atomic read
+#endif
+              flag = isMaximal[ index ];
+              if ( flag )
+                continue;
 
+              if ( aPowerMap.metricPtr()->powerDistance( p, v,
+                                                         aPowerMap.weightImagePtr()->operator()( v ) )
+                   < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
+                {
+#ifdef WITH_OPENMP
+#pragma omp atomic write
+#endif
+                  isMaximal[ index ] = 1;
+                }
+            }
         }
-      return Type( computedMA );
+
+      //Compaction, in the domain order
+      balls.clear();
+      for (DGtal::int64_t index = 0; index < size; ++index)
+        if ( isMaximal[ index ] )
+          {
+            Point v = lower;
+            DGtal::int64_t q = index;
+            for (Dimension d = 0; d < Point::dimension; ++d)
+              {
+                v[d] += static_cast<typename Point::Coordinate>( q % extent[d] );
+                q /= extent[d];
+              }
+            balls.push_back( std::make_pair( v, aPowerMap.weightImagePtr()->operator()( v ) ) );
+          }
     }
   }; // end of class ReducedMedialAxis
 
@@ -79,7 +79,7 @@ Description of \b concept '\b CImageFactory' <p>
 ### Invariants
 
 ### Models
-ImageFactoryFromImage ImageFactoryFromHDF5
+ImageFactoryFromImage ImageFactoryFromHDF5 ImageFactoryFromBlockVol
 
 ### Notes
 
@@ -244,6 +244,24 @@ public:
         return myImagePtr;
     }
 
+    /**
+     * Returns the pointer on the domain functor.
+     * @return a const pointer on the domain functor.
+     */
+    const TFunctorD * getDomainFunctorPointer() const
+    {
+        return myFD;
+    }
+
+    /**
+     * Returns the pointer on the value functor.
+     * @return a const pointer on the value functor.
+     */
+    const TFunctorV * getValueFunctorPointer() const
+    {
+        return myFV;
+    }
+
     // ------------------------- Protected Datas ------------------------------
 private:
     /**
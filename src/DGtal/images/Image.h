@@ -46,6 +46,7 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/base/CowPtr.h"
+#include "DGtal/images/ImageHelper.h"
 #include "DGtal/graph/CVertexMap.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -249,6 +250,50 @@ trace.warning() << "Image copy Ctor  "<<std::endl;
       myImagePointer->setValue(aPoint,aValue);
     }
 
+    /////////////////// Row access //////////////////
+
+    /**
+     * Copies the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[, to
+     * an output iterator (the underlying container row access is used,
+     * see rowFromImage).
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is read.
+     * @param aSize the number of values of the row.
+     * @param anOutput an output iterator on the values.
+     * @return the output iterator after the last value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator getRow(const Point &aPoint, const Dimension aDimension,
+                           const typename Domain::Size aSize, TOutputIterator anOutput) const
+    {
+      return rowFromImage(*myImagePointer, aPoint, aDimension, aSize, anOutput);
+    }
+
+    /**
+     * Sets the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[, from
+     * an input iterator (the underlying container row access is used,
+     * see imageFromRow).
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is written.
+     * @param aSize the number of values of the row.
+     * @param anInput an input iterator on the values.
+     * @return the input iterator after the last value.
+     */
+    template <typename TInputIterator>
+    TInputIterator setRow(const Point &aPoint, const Dimension aDimension,
+                          const typename Domain::Size aSize, TInputIterator anInput)
+    {
+      return imageFromRow(*myImagePointer, aPoint, aDimension, aSize, anInput);
+    }
+
 
 
     /////////////////// API //////////////////
@@ -306,6 +351,48 @@ trace.warning() << "Image copy Ctor  "<<std::endl;
   std::ostream&
   operator<< ( std::ostream & out, const Image<T> & object );
 
+  /**
+   * Overloads 'rowFromImage' (see ImageHelper.h) for Image: calls
+   * Image::getRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is read.
+   * @param aSize the number of values of the row.
+   * @param anOutput an output iterator on the values.
+   * @return the output iterator after the last value.
+   */
+  template <typename T, typename TOutputIterator>
+  inline
+  TOutputIterator
+  rowFromImage ( const Image<T> & anImage,
+                 const typename T::Point & aPoint, const Dimension aDimension,
+                 const typename T::Domain::Size aSize, TOutputIterator anOutput )
+  {
+    return anImage.getRow( aPoint, aDimension, aSize, anOutput );
+  }
+
+  /**
+   * Overloads 'imageFromRow' (see ImageHelper.h) for Image: calls
+   * Image::setRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is written.
+   * @param aSize the number of values of the row.
+   * @param anInput an input iterator on the values.
+   * @return the input iterator after the last value.
+   */
+  template <typename T, typename TInputIterator>
+  inline
+  TInputIterator
+  imageFromRow ( Image<T> & anImage,
+                 const typename T::Point & aPoint, const Dimension aDimension,
+                 const typename T::Domain::Size aSize, TInputIterator anInput )
+  {
+    return anImage.setRow( aPoint, aDimension, aSize, anInput );
+  }
+
 } // namespace DGtal
 
 
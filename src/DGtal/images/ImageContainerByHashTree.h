@@ -361,6 +361,42 @@ namespace DGtal
      */
     void setValue(const Point& aPoint, const Value object);
 
+    /**
+     * Copies the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[, to
+     * an output iterator. The key of the first point is computed once,
+     * the next keys are obtained by incrementing the interleaved bits
+     * of dimension @a aDimension.
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is read.
+     * @param aSize the number of values of the row.
+     * @param anOutput an output iterator on the values.
+     * @return the output iterator after the last value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator getRow(const Point &aPoint, const Dimension aDimension,
+                const Size aSize, TOutputIterator anOutput) const;
+
+    /**
+     * Sets the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[,
+     * from an input iterator (see getRow).
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is written.
+     * @param aSize the number of values of the row.
+     * @param anInput an input iterator on the values.
+     * @return the input iterator after the last value.
+     */
+    template <typename TInputIterator>
+    TInputIterator setRow(const Point &aPoint, const Dimension aDimension,
+                const Size aSize, TInputIterator anInput);
+
     /**
      * Returns the size of a dimension (the container represents a
      * line, a square, a cube, etc. depending on the dimmension so no
@@ -810,6 +846,48 @@ namespace DGtal
     return out;
   }
 
+  /**
+   * Overloads 'rowFromImage' (see ImageHelper.h) for
+   * ImageContainerByHashTree: calls ImageContainerByHashTree::getRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is read.
+   * @param aSize the number of values of the row.
+   * @param anOutput an output iterator on the values.
+   * @return the output iterator after the last value.
+   */
+  template<typename TDomain, typename TValue, typename THashKey, typename TOutputIterator>
+  inline
+  TOutputIterator
+  rowFromImage ( const ImageContainerByHashTree<TDomain, TValue, THashKey> & anImage,
+                 const typename TDomain::Point & aPoint, const Dimension aDimension,
+                 const typename TDomain::Size aSize, TOutputIterator anOutput )
+  {
+    return anImage.getRow( aPoint, aDimension, aSize, anOutput );
+  }
+
+  /**
+   * Overloads 'imageFromRow' (see ImageHelper.h) for
+   * ImageContainerByHashTree: calls ImageContainerByHashTree::setRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is written.
+   * @param aSize the number of values of the row.
+   * @param anInput an input iterator on the values.
+   * @return the input iterator after the last value.
+   */
+  template<typename TDomain, typename TValue, typename THashKey, typename TInputIterator>
+  inline
+  TInputIterator
+  imageFromRow ( ImageContainerByHashTree<TDomain, TValue, THashKey> & anImage,
+                 const typename TDomain::Point & aPoint, const Dimension aDimension,
+                 const typename TDomain::Size aSize, TInputIterator anInput )
+  {
+    return anImage.setRow( aPoint, aDimension, aSize, anInput );
+  }
+
 
 }
 } // namespace DGtal
@@ -0,0 +1,328 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByRuns.h
+ *
+ * Header file for module ImageContainerByRuns.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByRuns_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByRuns.h
+#else // defined(ImageContainerByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByRuns_RECURSES
+
+#if !defined ImageContainerByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByRuns
+  /**
+   * Description of class 'ImageContainerByRuns' <p>
+   * Aim: Model of CImage implementing a binary image (values of type
+   * bool) as a run-length encoded set of points (DigitalSetByRuns):
+   * the points whose value is 'true'.
+   *
+   * The memory is proportional to the number of runs of the
+   * foreground, so that large and sparse binary volumes (e.g.
+   * segmentation masks) are stored in a few runs per row. Reading a
+   * value is in O(log r) where r is the number of runs. Rows along the
+   * first axis are read and written run by run with getRow / setRow
+   * (and rowFromImage / imageFromRow).
+   *
+   * The underlying set is available with digitalSet(), for instance
+   * for set operations or for Surfaces::sMakeBoundaryFromRuns.
+   *
+   * @tparam TDomain the type of domain, an HyperRectDomain.
+   *
+   * @see testDigitalSetByRuns.cpp
+   */
+
+  template <typename TDomain>
+  class ImageContainerByRuns
+  {
+
+  public:
+
+    typedef ImageContainerByRuns<TDomain> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension;
+
+    /// the underlying set
+    typedef DigitalSetByRuns<Domain> DigitalSet;
+
+    /// range of values
+    typedef bool Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /////////////////// Data members //////////////////
+  private:
+
+    /// The points of value 'true'.
+    DigitalSet mySet;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor from a Domain. All the values are 'false'.
+     *
+     * @param aDomain the image domain.
+     */
+    ImageContainerByRuns( const Domain &aDomain );
+
+    /**
+     * Constructor from a set: the values are 'true' on the points of
+     * @a aSet, whose domain becomes the image domain.
+     *
+     * @param aSet a set of points.
+     */
+    ImageContainerByRuns( const DigitalSet &aSet );
+
+    /**
+     * Copy operator
+     *
+     * @param other the object to copy.
+     */
+    ImageContainerByRuns( const ImageContainerByRuns& other );
+
+    /**
+     * Assignement operator
+     *
+     * @param other the object to copy.
+     * @return this
+     */
+    ImageContainerByRuns& operator=( const ImageContainerByRuns& other );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByRuns();
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point &aPoint, const Value &aValue );
+
+    /**
+     * Copies the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[, to
+     * an output iterator. Along the first dimension, the runs of the
+     * row are searched once and the values are written run by run.
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is read.
+     * @param aSize the number of values of the row.
+     * @param anOutput an output iterator on the values.
+     * @return the output iterator after the last value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator getRow( const Point &aPoint, const Dimension aDimension,
+                            const Size aSize, TOutputIterator anOutput ) const;
+
+    /**
+     * Sets the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[,
+     * from an input iterator. Along the first dimension, the runs of
+     * the row are erased and the new ones are inserted as a whole.
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is written.
+     * @param aSize the number of values of the row.
+     * @param anInput an input iterator on the values.
+     * @return the input iterator after the last value.
+     */
+    template <typename TInputIterator>
+    TInputIterator setRow( const Point &aPoint, const Dimension aDimension,
+                           const Size aSize, TInputIterator anInput );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the set of points of value 'true'.
+     */
+    const DigitalSet &digitalSet() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * Construct a Iterator on the image
+     *
+     * @return a Iterator
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  inline
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByRuns<TDomain> & object )
+  {
+    object.selfDisplay ( out );
+    return out;
+  }
+
+  /**
+   * Overloads 'rowFromImage' (see ImageHelper.h) for
+   * ImageContainerByRuns: calls ImageContainerByRuns::getRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is read.
+   * @param aSize the number of values of the row.
+   * @param anOutput an output iterator on the values.
+   * @return the output iterator after the last value.
+   */
+  template <typename TDomain, typename TOutputIterator>
+  inline
+  TOutputIterator
+  rowFromImage ( const ImageContainerByRuns<TDomain> & anImage,
+                 const typename TDomain::Point & aPoint, const Dimension aDimension,
+                 const typename TDomain::Size aSize, TOutputIterator anOutput )
+  {
+    return anImage.getRow ( aPoint, aDimension, aSize, anOutput );
+  }
+
+  /**
+   * Overloads 'imageFromRow' (see ImageHelper.h) for
+   * ImageContainerByRuns: calls ImageContainerByRuns::setRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is written.
+   * @param aSize the number of values of the row.
+   * @param anInput an input iterator on the values.
+   * @return the input iterator after the last value.
+   */
+  template <typename TDomain, typename TInputIterator>
+  inline
+  TInputIterator
+  imageFromRow ( ImageContainerByRuns<TDomain> & anImage,
+                 const typename TDomain::Point & aPoint, const Dimension aDimension,
+                 const typename TDomain::Size aSize, TInputIterator anInput )
+  {
+    return anImage.setRow ( aPoint, aDimension, aSize, anInput );
+  }
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageContainerByRuns.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByRuns_h
+
+#undef ImageContainerByRuns_RECURSES
+#endif // else defined(ImageContainerByRuns_RECURSES)
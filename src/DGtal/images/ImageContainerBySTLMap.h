@@ -197,6 +197,43 @@ namespace DGtal
      * @param aValue the value.
      */
     void setValue(const Point &aPoint, const Value &aValue);
+
+    /**
+     * Copies the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[, to
+     * an output iterator. Along the last dimension, the points of a row
+     * are consecutive keys of the map, which is then walked once from
+     * the first point of the row instead of being searched for each point.
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is read.
+     * @param aSize the number of values of the row.
+     * @param anOutput an output iterator on the values.
+     * @return the output iterator after the last value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator getRow(const Point &aPoint, const Dimension aDimension,
+                const Size aSize, TOutputIterator anOutput) const;
+
+    /**
+     * Sets the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[,
+     * from an input iterator. Along the last dimension, each value is
+     * inserted with the position of the previous one as hint.
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is written.
+     * @param aSize the number of values of the row.
+     * @param anInput an input iterator on the values.
+     * @return the input iterator after the last value.
+     */
+    template <typename TInputIterator>
+    TInputIterator setRow(const Point &aPoint, const Dimension aDimension,
+                const Size aSize, TInputIterator anInput);
     
 
     /**
@@ -266,6 +303,48 @@ namespace DGtal
     return out;
   }
 
+  /**
+   * Overloads 'rowFromImage' (see ImageHelper.h) for
+   * ImageContainerBySTLMap: calls ImageContainerBySTLMap::getRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is read.
+   * @param aSize the number of values of the row.
+   * @param anOutput an output iterator on the values.
+   * @return the output iterator after the last value.
+   */
+  template <typename TDomain, typename TValue, typename TOutputIterator>
+  inline
+  TOutputIterator
+  rowFromImage ( const ImageContainerBySTLMap<TDomain,TValue> & anImage,
+                 const typename TDomain::Point & aPoint, const Dimension aDimension,
+                 const typename TDomain::Size aSize, TOutputIterator anOutput )
+  {
+    return anImage.getRow ( aPoint, aDimension, aSize, anOutput );
+  }
+
+  /**
+   * Overloads 'imageFromRow' (see ImageHelper.h) for
+   * ImageContainerBySTLMap: calls ImageContainerBySTLMap::setRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is written.
+   * @param aSize the number of values of the row.
+   * @param anInput an input iterator on the values.
+   * @return the input iterator after the last value.
+   */
+  template <typename TDomain, typename TValue, typename TInputIterator>
+  inline
+  TInputIterator
+  imageFromRow ( ImageContainerBySTLMap<TDomain,TValue> & anImage,
+                 const typename TDomain::Point & aPoint, const Dimension aDimension,
+                 const typename TDomain::Size aSize, TInputIterator anInput )
+  {
+    return anImage.setRow ( aPoint, aDimension, aSize, anInput );
+  }
+
 
 } // namespace DGtal
 
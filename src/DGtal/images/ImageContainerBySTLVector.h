@@ -47,6 +47,7 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
 #include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
@@ -506,6 +507,43 @@ namespace DGtal
       return ( *it );
     };
 
+    /////////////////////////// Row access ////////////////////
+
+    /**
+     * Copies the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[, to
+     * an output iterator. Along the first dimension, the row is a
+     * contiguous range of the underlying vector.
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is read.
+     * @param aSize the number of values of the row.
+     * @param anOutput an output iterator on the values.
+     * @return the output iterator after the last value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator getRow ( const Point &aPoint, const Dimension aDimension,
+                  const Size aSize, TOutputIterator anOutput ) const;
+
+    /**
+     * Sets the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[,
+     * from an input iterator.
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is written.
+     * @param aSize the number of values of the row.
+     * @param anInput an input iterator on the values.
+     * @return the input iterator after the last value.
+     */
+    template <typename TInputIterator>
+    TInputIterator setRow ( const Point &aPoint, const Dimension aDimension,
+                  const Size aSize, TInputIterator anInput );
+
 
 
 
@@ -535,6 +573,48 @@ namespace DGtal
     return out;
   }
 
+  /**
+   * Overloads 'rowFromImage' (see ImageHelper.h) for
+   * ImageContainerBySTLVector: calls ImageContainerBySTLVector::getRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is read.
+   * @param aSize the number of values of the row.
+   * @param anOutput an output iterator on the values.
+   * @return the output iterator after the last value.
+   */
+  template <typename Domain, typename V, typename TOutputIterator>
+  inline
+  TOutputIterator
+  rowFromImage ( const ImageContainerBySTLVector<Domain, V> & anImage,
+                 const typename Domain::Point & aPoint, const Dimension aDimension,
+                 const typename Domain::Size aSize, TOutputIterator anOutput )
+  {
+    return anImage.getRow ( aPoint, aDimension, aSize, anOutput );
+  }
+
+  /**
+   * Overloads 'imageFromRow' (see ImageHelper.h) for
+   * ImageContainerBySTLVector: calls ImageContainerBySTLVector::setRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is written.
+   * @param aSize the number of values of the row.
+   * @param anInput an input iterator on the values.
+   * @return the input iterator after the last value.
+   */
+  template <typename Domain, typename V, typename TInputIterator>
+  inline
+  TInputIterator
+  imageFromRow ( ImageContainerBySTLVector<Domain, V> & anImage,
+                 const typename Domain::Point & aPoint, const Dimension aDimension,
+                 const typename Domain::Size aSize, TInputIterator anInput )
+  {
+    return anImage.setRow ( aPoint, aDimension, aSize, anInput );
+  }
+
 } // namespace DGtal
 
 
@@ -0,0 +1,543 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageExpression.h
+ *
+ * Header file for module ImageExpression.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageExpression_RECURSES)
+#error Recursive header files inclusion detected in ImageExpression.h
+#else // defined(ImageExpression_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageExpression_RECURSES
+
+#if !defined ImageExpression_h
+/** Prevents repeated inclusion of headers. */
+#define ImageExpression_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageTermExpression
+  /**
+   * Description of template class 'ImageTermExpression' <p>
+   * \brief Aim: leaf of an image expression, i.e. a lightweight
+   * proxy on an ImageContainerBySTLVector whose values are read by
+   * their linear index.
+   *
+   * Image expressions (ImageTermExpression, UnaryImageExpression and
+   * BinaryImageExpression) are lazy chains of functors applied to
+   * images sharing the same domain. Like ConstImageAdapter, they are
+   * models of CConstImage and can be read point by point, but they
+   * also provide an eval() method on linear indices: a whole chain is
+   * then inlined into a single loop on the image storage, without
+   * domain checks nor intermediate images (see imageFromExpression()).
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+   * typedef ImageContainerBySTLVector<Z3i::Domain, bool> BinaryImage;
+   * Image image( domain );
+   * ...
+   * Thresholder<unsigned char> t( 128 );
+   * BinaryImage result( domain );
+   * imageFromExpression( result, transformExpression<bool>( makeImageExpression( image ), t ) );
+   * @endcode
+   *
+   * @tparam TImageContainer an ImageContainerBySTLVector type.
+   *
+   * @see testImageExpression.cpp
+   */
+  template <typename TImageContainer>
+  class ImageTermExpression
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageTermExpression<TImageContainer> Self;
+
+    BOOST_CONCEPT_ASSERT(( CConstImage<TImageContainer> ));
+
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Point Point;
+    typedef typename ImageContainer::Value Value;
+    typedef typename ImageContainer::Size Size;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anImage the image (aliased).
+     */
+    ImageTermExpression( ConstAlias<ImageContainer> anImage )
+      : myImagePtr( &anImage )
+    {}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the image.
+     */
+    const Domain & domain() const
+    {
+      return myImagePtr->domain();
+    }
+
+    /**
+     * @return a range on the values of the expression.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * @return the number of values of the expression.
+     */
+    Size size() const
+    {
+      return myImagePtr->size();
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its linear index.
+     */
+    Size linearized( const Point & aPoint ) const
+    {
+      return myImagePtr->linearized( aPoint );
+    }
+
+    /**
+     * @param i a linear index.
+     * @return the value at @a i.
+     */
+    Value eval( const Size i ) const
+    {
+      return (*myImagePtr)[ i ];
+    }
+
+    /**
+     * @pre the point must be in the domain
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const
+    {
+      ASSERT( domain().isInside( aPoint ) );
+      return eval( linearized( aPoint ) );
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[ImageTermExpression] " << *myImagePtr;
+    }
+
+    /**
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myImagePtr->isValid();
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Alias on the image container
+    const ImageContainer * myImagePtr;
+
+  }; // end of class ImageTermExpression
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class UnaryImageExpression
+  /**
+   * Description of template class 'UnaryImageExpression' <p>
+   * \brief Aim: image expression whose values are the values of
+   * another image expression transformed by a functor:
+   * eval(i) = f( e.eval(i) ).
+   *
+   * The sub-expression and the functor are copied (expressions are
+   * lightweight proxies), so that expressions can be built from
+   * temporaries.
+   *
+   * @tparam TExpression an image expression type.
+   * @tparam TFunctor a unary functor from TExpression::Value to TValue.
+   * @tparam TValue the value type of the expression.
+   *
+   * @see ImageTermExpression
+   */
+  template <typename TExpression, typename TFunctor, typename TValue>
+  class UnaryImageExpression
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef UnaryImageExpression<TExpression, TFunctor, TValue> Self;
+
+    typedef TExpression Expression;
+    typedef TFunctor Functor;
+    typedef typename Expression::Domain Domain;
+    typedef typename Expression::Point Point;
+    typedef typename Expression::Size Size;
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anExpression the sub-expression (copied).
+     * @param aFunctor the functor (copied).
+     */
+    UnaryImageExpression( const Expression & anExpression, const Functor & aFunctor )
+      : myExpression( anExpression ), myFunctor( aFunctor )
+    {}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the domain of the expression.
+    const Domain & domain() const
+    {
+      return myExpression.domain();
+    }
+
+    /// @return a range on the values of the expression.
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /// @return the number of values of the expression.
+    Size size() const
+    {
+      return myExpression.size();
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its linear index.
+     */
+    Size linearized( const Point & aPoint ) const
+    {
+      return myExpression.linearized( aPoint );
+    }
+
+    /**
+     * @param i a linear index.
+     * @return the value at @a i.
+     */
+    Value eval( const Size i ) const
+    {
+      return myFunctor( myExpression.eval( i ) );
+    }
+
+    /**
+     * @pre the point must be in the domain
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const
+    {
+      ASSERT( domain().isInside( aPoint ) );
+      return eval( linearized( aPoint ) );
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[UnaryImageExpression] f(";
+      myExpression.selfDisplay( out );
+      out << ")";
+    }
+
+    /// @return 'true' if the object is valid, 'false' otherwise.
+    bool isValid() const
+    {
+      return myExpression.isValid();
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Sub-expression
+    Expression myExpression;
+    /// Value functor
+    Functor myFunctor;
+
+  }; // end of class UnaryImageExpression
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryImageExpression
+  /**
+   * Description of template class 'BinaryImageExpression' <p>
+   * \brief Aim: image expression whose values are computed by a
+   * binary functor from the values of two image expressions on the
+   * same domain: eval(i) = f( e1.eval(i), e2.eval(i) ).
+   *
+   * @tparam TExpression1 an image expression type.
+   * @tparam TExpression2 an image expression type (same domain).
+   * @tparam TFunctor a binary functor from (TExpression1::Value,
+   * TExpression2::Value) to TValue.
+   * @tparam TValue the value type of the expression.
+   *
+   * @see ImageTermExpression
+   */
+  template <typename TExpression1, typename TExpression2, typename TFunctor, typename TValue>
+  class BinaryImageExpression
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef BinaryImageExpression<TExpression1, TExpression2, TFunctor, TValue> Self;
+
+    typedef TExpression1 Expression1;
+    typedef TExpression2 Expression2;
+    typedef TFunctor Functor;
+    typedef typename Expression1::Domain Domain;
+    typedef typename Expression1::Point Point;
+    typedef typename Expression1::Size Size;
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anExpression1 the first sub-expression (copied).
+     * @param anExpression2 the second sub-expression (copied), on the same domain.
+     * @param aFunctor the functor (copied).
+     */
+    BinaryImageExpression( const Expression1 & anExpression1,
+                           const Expression2 & anExpression2,
+                           const Functor & aFunctor )
+      : myExpression1( anExpression1 ), myExpression2( anExpression2 ), myFunctor( aFunctor )
+    {
+      ASSERT( anExpression1.domain().lowerBound() == anExpression2.domain().lowerBound()
+              && anExpression1.domain().upperBound() == anExpression2.domain().upperBound() );
+    }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the domain of the expression.
+    const Domain & domain() const
+    {
+      return myExpression1.domain();
+    }
+
+    /// @return a range on the values of the expression.
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /// @return the number of values of the expression.
+    Size size() const
+    {
+      return myExpression1.size();
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return its linear index.
+     */
+    Size linearized( const Point & aPoint ) const
+    {
+      return myExpression1.linearized( aPoint );
+    }
+
+    /**
+     * @param i a linear index.
+     * @return the value at @a i.
+     */
+    Value eval( const Size i ) const
+    {
+      return myFunctor( myExpression1.eval( i ), myExpression2.eval( i ) );
+    }
+
+    /**
+     * @pre the point must be in the domain
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const
+    {
+      ASSERT( domain().isInside( aPoint ) );
+      return eval( linearized( aPoint ) );
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[BinaryImageExpression] f(";
+      myExpression1.selfDisplay( out );
+      out << ", ";
+      myExpression2.selfDisplay( out );
+      out << ")";
+    }
+
+    /// @return 'true' if the object is valid, 'false' otherwise.
+    bool isValid() const
+    {
+      return myExpression1.isValid() && myExpression2.isValid();
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// First sub-expression
+    Expression1 myExpression1;
+    /// Second sub-expression
+    Expression2 myExpression2;
+    /// Value functor
+    Functor myFunctor;
+
+  }; // end of class BinaryImageExpression
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Expression construction and evaluation
+
+  /**
+   * @param anImage an ImageContainerBySTLVector.
+   * @return the leaf expression on @a anImage.
+   */
+  template <typename TImageContainer>
+  ImageTermExpression<TImageContainer>
+  makeImageExpression( const TImageContainer & anImage );
+
+  /**
+   * Fuses a ConstImageAdapter (with an identity domain functor and the
+   * domain of its image) into an image expression.
+   *
+   * @param anAdapter the adapter.
+   * @return the expression f( image ).
+   */
+  template <typename TImageContainer, typename TNewValue, typename TFunctorV>
+  UnaryImageExpression<ImageTermExpression<TImageContainer>, TFunctorV, TNewValue>
+  makeImageExpression( const ConstImageAdapter<TImageContainer, typename TImageContainer::Domain,
+                       DefaultFunctor, TNewValue, TFunctorV> & anAdapter );
+
+  /**
+   * @tparam TValue the value type of the new expression (explicit).
+   * @param anExpression an image expression.
+   * @param aFunctor a unary functor.
+   * @return the expression aFunctor( anExpression ).
+   */
+  template <typename TValue, typename TExpression, typename TFunctor>
+  UnaryImageExpression<TExpression, TFunctor, TValue>
+  transformExpression( const TExpression & anExpression, const TFunctor & aFunctor );
+
+  /**
+   * @tparam TValue the value type of the new expression (explicit).
+   * @param anExpression1 an image expression.
+   * @param anExpression2 an image expression on the same domain.
+   * @param aFunctor a binary functor.
+   * @return the expression aFunctor( anExpression1, anExpression2 ).
+   */
+  template <typename TValue, typename TExpression1, typename TExpression2, typename TFunctor>
+  BinaryImageExpression<TExpression1, TExpression2, TFunctor, TValue>
+  combineExpressions( const TExpression1 & anExpression1,
+                      const TExpression2 & anExpression2,
+                      const TFunctor & aFunctor );
+
+  /**
+   * Materializes an image expression in an ImageContainerBySTLVector
+   * of the same domain: the whole chain of functors is evaluated in a
+   * single loop on linear indices, by blocks processed in parallel if
+   * DGtal has been built with OpenMP support. Blocks are multiples of
+   * 4096 values, so that bit-packed (bool) images are safely written
+   * by several threads.
+   *
+   * @param [out] anImage the output image.
+   * @param anExpression the expression.
+   */
+  template <typename TImageContainer, typename TExpression>
+  void imageFromExpression( TImageContainer & anImage, const TExpression & anExpression );
+
+  /**
+   * Overloads 'operator<<' for displaying image expressions.
+   * @param out the output stream where the object is written.
+   * @param object the object to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageTermExpression<TImageContainer> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying image expressions.
+   * @param out the output stream where the object is written.
+   * @param object the object to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TExpression, typename TFunctor, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const UnaryImageExpression<TExpression, TFunctor, TValue> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying image expressions.
+   * @param out the output stream where the object is written.
+   * @param object the object to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TExpression1, typename TExpression2, typename TFunctor, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const BinaryImageExpression<TExpression1, TExpression2, TFunctor, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageExpression.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageExpression_h
+
+#undef ImageExpression_RECURSES
+#endif // else defined(ImageExpression_RECURSES)
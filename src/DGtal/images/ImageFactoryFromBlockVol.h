@@ -0,0 +1,248 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryFromBlockVol.h
+ *
+ * Header file for module ImageFactoryFromBlockVol.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryFromBlockVol_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryFromBlockVol.h
+#else // defined(ImageFactoryFromBlockVol_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryFromBlockVol_RECURSES
+
+#if !defined ImageFactoryFromBlockVol_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryFromBlockVol_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/io/BlockVolume.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4290)
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryFromBlockVol
+  /**
+   * Description of template class 'ImageFactoryFromBlockVol' <p>
+   * \brief Aim: implements a factory from a block compressed volume
+   * file ("bvol" format, see BlockVolume).
+   *
+   * @tparam TImageContainer an image container type (model of CImage).
+   *
+   * The factory images production (images are copied, so it's a
+   * creation process) is done with the function 'requestImage' so the
+   * deletion must be done with the function 'detachImage'. Only the
+   * bricks of the file intersecting the requested domain are read and
+   * decompressed; the last brick is kept, so that consecutive requests
+   * of small images (e.g. the tiles of a TiledImage whose tiles divide
+   * the bricks) decompress each brick once.
+   *
+   * The update of the file is done with the function 'flushImage',
+   * which rewrites the bricks intersecting the image domain whose
+   * values have changed. The factory must then be constructed with
+   * isWritable set to 'true'; by default the file is opened read-only
+   * and flushImage does nothing, so that e.g. a TiledImage may flush
+   * its (unmodified) tiles.
+   *
+   * The image values are cast from and to the file values
+   * (DGtal::uint64_t).
+   *
+   * @see testImageFactoryFromBlockVol.cpp
+   */
+  template <typename TImageContainer>
+  class ImageFactoryFromBlockVol
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryFromBlockVol<TImageContainer> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+
+    ///New types
+    typedef ImageContainer OutputImage;
+    typedef typename OutputImage::Value Value;
+    typedef typename Domain::Point Point;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor.
+     * @param aFilename bvol filename.
+     * @param isWritable when 'true', the file is opened for
+     * writing too (see flushImage), otherwise it is only read
+     * (default).
+     */
+    ImageFactoryFromBlockVol( const std::string & aFilename, const bool isWritable = false )
+      throw( DGtal::IOException );
+
+    /**
+     * Destructor.
+     */
+    ~ImageFactoryFromBlockVol() {}
+
+  private:
+
+    ImageFactoryFromBlockVol( const ImageFactoryFromBlockVol & other );
+
+    ImageFactoryFromBlockVol & operator=( const ImageFactoryFromBlockVol & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myDomain;
+    }
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain aDomain.
+     *
+     * @param aDomain the domain (included in domain()).
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage( const Domain & aDomain ) throw( DGtal::IOException );
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage. Only the bricks
+     * whose values have changed are written; nothing is done if the
+     * file is not writable.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage( OutputImage* outputImage ) throw( DGtal::IOException );
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage( OutputImage* outputImage )
+    {
+      delete outputImage;
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The bvol file.
+    BlockVolume myVolume;
+
+    /// The image domain
+    Domain myDomain;
+
+    /// Index of the brick in myBrickValues (nbBricks() if none).
+    std::size_t myBrick;
+
+    /// Values of the last brick read or written.
+    std::vector<BlockVolume::RawValue> myBrickValues;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Reads a brick, unless it is the last brick read or written.
+     * @param anIndex the index of the brick.
+     */
+    void loadBrick( const std::size_t anIndex ) throw( DGtal::IOException );
+
+    /**
+     * Copies the values of an image from the bricks, or to the
+     * bricks, that intersect its domain.
+     *
+     * @param anImage an image.
+     * @param toFile when 'true', the image values are written to the
+     * file (only in the bricks they change), otherwise the image is
+     * filled.
+     */
+    void transfer( OutputImage & anImage, const bool toFile ) throw( DGtal::IOException );
+
+  }; // end of class ImageFactoryFromBlockVol
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryFromBlockVol'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryFromBlockVol' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryFromBlockVol<TImageContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryFromBlockVol.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryFromBlockVol_h
+
+#undef ImageFactoryFromBlockVol_RECURSES
+#endif // else defined(ImageFactoryFromBlockVol_RECURSES)
@@ -203,6 +203,59 @@ namespace DGtal
   template<typename I>
   void imageFromImage(I& aImg1, const I& aImg2); 
 
+  /**
+   * Copy the values of the row of @a aSize points starting at
+   * @a aPoint along dimension @a aDimension, i.e. the points
+   * @a aPoint + k e_@a aDimension for k in [0, @a aSize[, to
+   * an output iterator.
+   *
+   * This generic version reads the values point by point. Image
+   * containers with a faster row access (ImageContainerBySTLVector,
+   * ImageContainerBySTLMap, ImageContainerByHashTree, TiledImage,
+   * Image) overload this function, so that generic algorithms can
+   * process images row by row whatever their container.
+   *
+   * @pre the first and the last points of the row must be in the
+   * domain of @a aImg.
+   *
+   * @param aImg an image
+   * @param aPoint the first point of the row
+   * @param aDimension the dimension along which the row is read
+   * @param aSize the number of values of the row
+   * @param anOutput an output iterator on the values
+   * @return the output iterator after the last value
+   *
+   * @tparam I any model of CConstImage
+   * @tparam O any model of output iterator
+   */
+  template<typename I, typename O>
+  O rowFromImage(const I& aImg, const typename I::Point& aPoint,
+                 const Dimension aDimension, const typename I::Domain::Size aSize,
+                 O anOutput); 
+
+  /**
+   * Set the values of the row of @a aSize points starting at
+   * @a aPoint along dimension @a aDimension from an input iterator
+   * (see rowFromImage).
+   *
+   * @pre the first and the last points of the row must be in the
+   * domain of @a aImg.
+   *
+   * @param aImg an image
+   * @param aPoint the first point of the row
+   * @param aDimension the dimension along which the row is written
+   * @param aSize the number of values of the row
+   * @param anInput an input iterator on the values
+   * @return the input iterator after the last value
+   *
+   * @tparam I any model of CImage
+   * @tparam It any model of input iterator
+   */
+  template<typename I, typename It>
+  It imageFromRow(I& aImg, const typename I::Point& aPoint,
+                  const Dimension aDimension, const typename I::Domain::Size aSize,
+                  It anInput); 
+
   /**
    * Insert @a aPoint in @a aSet and if (and only if)
    * @a aPoint is a newly inserted point. 
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -50,6 +51,7 @@
 #include "DGtal/base/Alias.h"
 
 #include "DGtal/images/ImageCache.h"
+#include "DGtal/images/ImageHelper.h"
 
 #include "DGtal/base/TiledImageBidirectionalConstRangeFromPoint.h"
 #include "DGtal/base/TiledImageBidirectionalRangeFromPoint.h"
@@ -752,6 +754,96 @@ namespace DGtal
         }
     }
 
+    /**
+     * Copies the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[, to
+     * an output iterator. The tile (from cache) is looked up once per
+     * tile crossed by the row, and each part of the row is read with
+     * the row access of the tile container (see rowFromImage).
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is read.
+     * @param aSize the number of values of the row.
+     * @param anOutput an output iterator on the values.
+     * @return the output iterator after the last value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator getRow(const Point &aPoint, const Dimension aDimension,
+                           const typename Domain::Size aSize, TOutputIterator anOutput) const
+    {
+      ASSERT(aDimension < Domain::dimension);
+
+      Point p = aPoint;
+      typename Domain::Size remaining = aSize;
+      while (remaining > 0)
+        {
+          ASSERT(myImageFactory->domain().isInside(p));
+
+          Domain d = findSubDomain(p);
+          OutputImage *tile = myImageCache->getPage(d);
+          if (!tile)
+            {
+              myImageCache->incCacheMissRead();
+              myImageCache->update(d);
+              tile = myImageCache->getPage(d);
+            }
+
+          typename Domain::Size n = std::min(remaining,
+                                             static_cast<typename Domain::Size>(d.upperBound()[aDimension] - p[aDimension] + 1));
+          anOutput = rowFromImage(*tile, p, aDimension, n, anOutput);
+          p[aDimension] += n;
+          remaining -= n;
+        }
+      return anOutput;
+    }
+
+    /**
+     * Sets the values of a row of the image, i.e. the values at the
+     * points @a aPoint + k e_@a aDimension for k in [0, @a aSize[, from
+     * an input iterator. The tile (from cache) is looked up once per
+     * tile crossed by the row, the values are then written according
+     * to the write policy.
+     *
+     * @pre the first and the last points of the row must be in the domain.
+     *
+     * @param aPoint the first point of the row.
+     * @param aDimension the dimension along which the row is written.
+     * @param aSize the number of values of the row.
+     * @param anInput an input iterator on the values.
+     * @return the input iterator after the last value.
+     */
+    template <typename TInputIterator>
+    TInputIterator setRow(const Point &aPoint, const Dimension aDimension,
+                          const typename Domain::Size aSize, TInputIterator anInput)
+    {
+      ASSERT(aDimension < Domain::dimension);
+
+      Point p = aPoint;
+      typename Domain::Size remaining = aSize;
+      while (remaining > 0)
+        {
+          ASSERT(myImageFactory->domain().isInside(p));
+
+          Domain d = findSubDomain(p);
+          OutputImage *tile = myImageCache->getPage(d);
+          if (!tile)
+            {
+              myImageCache->incCacheMissWrite();
+              myImageCache->update(d);
+              tile = myImageCache->getPage(d);
+            }
+
+          typename Domain::Size n = std::min(remaining,
+                                             static_cast<typename Domain::Size>(d.upperBound()[aDimension] - p[aDimension] + 1));
+          for (typename Domain::Size i = 0; i < n; ++i, ++p[aDimension], ++anInput)
+            myWritePolicy->writeInPage(tile, p, *anInput);
+          remaining -= n;
+        }
+      return anInput;
+    }
+
     /**
      * Get the cacheMissRead value.
      */
@@ -815,6 +907,50 @@ namespace DGtal
   std::ostream&
   operator<< ( std::ostream & out, const TiledImage<TImageContainer, TImageFactory, TImageCacheReadPolicy, TImageCacheWritePolicy> & object );
 
+  /**
+   * Overloads 'rowFromImage' (see ImageHelper.h) for TiledImage:
+   * calls TiledImage::getRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is read.
+   * @param aSize the number of values of the row.
+   * @param anOutput an output iterator on the values.
+   * @return the output iterator after the last value.
+   */
+  template <typename TImageContainer, typename TImageFactory, typename TImageCacheReadPolicy, typename TImageCacheWritePolicy,
+            typename TOutputIterator>
+  inline
+  TOutputIterator
+  rowFromImage ( const TiledImage<TImageContainer, TImageFactory, TImageCacheReadPolicy, TImageCacheWritePolicy> & anImage,
+                 const typename TImageContainer::Point & aPoint, const Dimension aDimension,
+                 const typename TImageContainer::Domain::Size aSize, TOutputIterator anOutput )
+  {
+    return anImage.getRow( aPoint, aDimension, aSize, anOutput );
+  }
+
+  /**
+   * Overloads 'imageFromRow' (see ImageHelper.h) for TiledImage:
+   * calls TiledImage::setRow.
+   *
+   * @param anImage the image.
+   * @param aPoint the first point of the row.
+   * @param aDimension the dimension along which the row is written.
+   * @param aSize the number of values of the row.
+   * @param anInput an input iterator on the values.
+   * @return the input iterator after the last value.
+   */
+  template <typename TImageContainer, typename TImageFactory, typename TImageCacheReadPolicy, typename TImageCacheWritePolicy,
+            typename TInputIterator>
+  inline
+  TInputIterator
+  imageFromRow ( TiledImage<TImageContainer, TImageFactory, TImageCacheReadPolicy, TImageCacheWritePolicy> & anImage,
+                 const typename TImageContainer::Point & aPoint, const Dimension aDimension,
+                 const typename TImageContainer::Domain::Size aSize, TInputIterator anInput )
+  {
+    return anImage.setRow( aPoint, aDimension, aSize, anInput );
+  }
+
 } // namespace DGtal
 
 
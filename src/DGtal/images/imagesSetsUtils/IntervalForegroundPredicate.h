@@ -104,6 +104,15 @@ namespace DGtal
       return ((*it) > myMinVal) && ((*it) <= myMaxVal);
     }
 
+    /**
+     * @param aValue an image value.
+     * @return True if the value belongs to the value interval.
+     */
+    bool isForegroundValue(const Value &aValue) const
+    {
+      return (aValue > myMinVal) && (aValue <= myMaxVal);
+    }
+
   private:
     const Image* myImage;
     Value myMaxVal;
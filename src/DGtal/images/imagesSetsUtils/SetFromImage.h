@@ -41,15 +41,41 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/images/imagesSetsUtils/IntervalForegroundPredicate.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+  /**
+   * Description of template struct 'ConcurrentReadTraits' <p>
+   * \brief Aim: Tells whether a const image can be read from several
+   * threads at once (operator() and rowFromImage). It is false by
+   * default, since a read may update a cache (e.g. TiledImage) or
+   * compute values lazily, and true for ImageContainerBySTLVector.
+   * Specialize it for other images whose reads are thread-safe.
+   *
+   * @tparam TImage any model of CConstImage.
+   */
+  template <typename TImage>
+  struct ConcurrentReadTraits
+  {
+    static const bool value = false;
+  };
+
+  template <typename TDomain, typename TValue>
+  struct ConcurrentReadTraits< ImageContainerBySTLVector<TDomain, TValue> >
+  {
+    static const bool value = true;
+  };
+
   /////////////////////////////////////////////////////////////////////////////
   // template class SetFromImage
   /**
@@ -109,7 +135,7 @@ namespace DGtal
     {
       IntervalForegroundPredicate<Image> isForeground(aImage,minVal,maxVal);
       
-      append(aSet, isForeground,itBegin,itEnd);
+      append<Image>(aSet, isForeground,itBegin,itEnd);
     }
 
     /** 
@@ -117,6 +143,13 @@ namespace DGtal
      * contained in the image domain are considered. 
      * @pre the ForegroundPredicate instance must have been created on the image aImage.
      *
+     * The domain of @a aImage (an HyperRectDomain) is processed slab
+     * by slab (hyperplanes orthogonal to the last dimension): each
+     * slab gives a run of foreground points in the domain order,
+     * inserted in bulk into @a aSet as soon as the slab is done (with
+     * insertNew if @a aSet was empty). The predicate is called
+     * sequentially and only one run is kept in memory.
+     *
      * @param aSet the set (maybe empty) to which points are added.
      * @param aImage image to convert to a Set.
      * @param isForeground instance of ForegroundPredicate to decide
@@ -124,11 +157,47 @@ namespace DGtal
      */
     template<typename Image,typename ForegroundPredicate>
     static
-    void append(Set &aSet, const Image &aImage, const ForegroundPredicate &isForeground)
+    void append(Set &aSet, const Image &aImage, const ForegroundPredicate &isForeground);
+
+    /** 
+     * Append the points of an image whose values belong to the
+     * interval of an IntervalForegroundPredicate. The image is read
+     * row by row (see rowFromImage) and the values are tested
+     * directly, slab by slab as above. The slabs are processed in
+     * parallel if DGtal has been built with OpenMP support and
+     * ConcurrentReadTraits<Image>::value is true.
+     * @pre the IntervalForegroundPredicate instance must have been created on the image aImage.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param isForeground the interval predicate.
+     */
+    template<typename Image>
+    static
+    void append(Set &aSet, const Image &aImage, 
+                const IntervalForegroundPredicate<Image> &isForeground)
     {
-      typename Image::Domain domain=aImage.domain();
+      appendByRows(aSet, aImage, isForeground);
+    }
 
-      append<Image,ForegroundPredicate>(aSet,isForeground,domain.begin(),domain.end());
+    /** 
+     * Append the points of an image whose values are greater than the
+     * threshold of a SimpleThresholdForegroundPredicate. The image is
+     * read row by row (see rowFromImage) and the values are tested
+     * directly, slab by slab as above (in parallel under the same
+     * conditions).
+     * @pre the SimpleThresholdForegroundPredicate instance must have been created on the image aImage.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param isForeground the threshold predicate.
+     */
+    template<typename Image>
+    static
+    void append(Set &aSet, const Image &aImage, 
+                const SimpleThresholdForegroundPredicate<Image> &isForeground)
+    {
+      appendByRows(aSet, aImage, isForeground);
     }
 
     /** 
@@ -154,6 +223,54 @@ namespace DGtal
       append(aSet,aImage,isForeground);
     }
 
+    /** 
+     * Dense output: sets to 'true' the values of a bit image at the
+     * points of @a aImage whose values satisfy a value predicate
+     * (other values are left unchanged). The bit image is the
+     * characteristic function of the set, one bit per point, without
+     * any point insertion. The computation is done by blocks of 4096
+     * bits (whole words of the bit vector), in parallel if DGtal has
+     * been built with OpenMP support and
+     * ConcurrentReadTraits<Image>::value is true (isForegroundValue
+     * must then be reentrant); the image is read row by row.
+     *
+     * @pre @a aBitImage and @a aImage have the same domain.
+     *
+     * @param aBitImage the bit image.
+     * @param aImage the image to threshold.
+     * @param isForeground an IntervalForegroundPredicate or a
+     * SimpleThresholdForegroundPredicate (any class providing
+     * isForegroundValue).
+     */
+    template<typename Image, typename ValuePredicate>
+    static
+    void appendToBitImage(ImageContainerBySTLVector<typename Image::Domain, bool> &aBitImage,
+                          const Image &aImage, const ValuePredicate &isForeground);
+
+  private:
+
+    /** 
+     * Slab by slab conversion reading the image row by row and
+     * testing its values with isForeground.isForegroundValue().
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param isForeground a predicate on values.
+     */
+    template<typename Image, typename ValuePredicate>
+    static
+    void appendByRows(Set &aSet, const Image &aImage, const ValuePredicate &isForeground);
+
+    /** 
+     * Bulk insertion of runs of distinct points into a set.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param runs the runs of points, inserted in order.
+     */
+    template<typename Point>
+    static
+    void insertRuns(Set &aSet, const std::vector< std::vector<Point> > &runs);
+
   };
 } // namespace DGtal
 
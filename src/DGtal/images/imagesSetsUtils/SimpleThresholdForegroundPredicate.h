@@ -110,6 +110,15 @@ namespace DGtal
     {
       return ((*it) > myVal);
     }
+
+    /**
+     * @param aValue an image value.
+     * @return True if the value is greater than the threshold.
+     */
+    bool isForegroundValue(const Value &aValue) const
+    {
+      return (aValue > myVal);
+    }
     
 
   private:
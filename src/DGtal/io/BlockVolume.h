@@ -0,0 +1,366 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BlockVolume.h
+ *
+ * Header file for module BlockVolume.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BlockVolume_RECURSES)
+#error Recursive header files inclusion detected in BlockVolume.h
+#else // defined(BlockVolume_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BlockVolume_RECURSES
+
+#if !defined BlockVolume_h
+/** Prevents repeated inclusion of headers. */
+#define BlockVolume_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4290)
+#endif
+
+namespace DGtal
+{
+
+  namespace details
+  {
+    /**
+     * Compresses a block of bytes with the LZ77 codec of the block
+     * volumes: a sequence of (literals, match) pairs, each one coded
+     * with a token byte (4 bits of literal length, 4 bits of match
+     * length), the literals and a 2 bytes little-endian offset in a
+     * 64KB window. Lengths greater than 14 are extended by bytes
+     * (255 means "continue").
+     *
+     * @param aData the bytes to compress.
+     * @param aSize the number of bytes.
+     * @param aResult (returns) the compressed bytes.
+     */
+    void lzCompress( const unsigned char * aData, const std::size_t aSize,
+                     std::vector<unsigned char> & aResult );
+
+    /**
+     * Decompresses a block of bytes compressed with lzCompress.
+     *
+     * @param aData the compressed bytes.
+     * @param aSize the number of compressed bytes.
+     * @param aResult (returns) the decompressed bytes.
+     * @param aResultSize the expected number of decompressed bytes.
+     * @return 'false' if the data are corrupted.
+     */
+    bool lzDecompress( const unsigned char * aData, const std::size_t aSize,
+                       unsigned char * aResult, const std::size_t aResultSize );
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class BlockVolume
+  /**
+   * Description of class 'BlockVolume' <p>
+   * \brief Aim: Low level access to a block compressed volume file
+   * ("bvol" format), cut into independently compressed bricks.
+   *
+   * A bvol file is made of:
+   * - a text header, "Field: value" lines as in the vol format:
+   * @code
+   * BVOL
+   * Version: 1
+   * Dimension: 3
+   * Size: 512 512 300
+   * Brick-Size: 64
+   * Value-Size: 2
+   * Codec: LZ
+   * .
+   * @endcode
+   * - the index of the bricks: for each brick, its offset in the
+   * file (8 bytes) and its compressed size (4 bytes), little-endian.
+   * A brick of size 0 is made of zero values (e.g. never written),
+   * - the compressed bricks.
+   *
+   * The domain of the volume is [0, size-1] in each dimension. The
+   * bricks are hypercubes of side Brick-Size (clipped at the
+   * upper borders of the volume), numbered along the first dimension
+   * first. The values of a brick, ordered along the first dimension
+   * first, are stored as little-endian unsigned integers of
+   * Value-Size bytes (1 to 8), byte plane by byte plane (all the least
+   * significant bytes, then the next bytes...), which makes the
+   * label and low range values very compressible.
+   *
+   * A brick is read by one seek and one decompression of its bytes
+   * only. A modified brick is written in place when its compressed
+   * size does not grow, otherwise in the first free space large
+   * enough (space of former versions of bricks, of zero bricks, or
+   * the end of the file). The free space is found from the index when
+   * a file is opened; the file never shrinks.
+   *
+   * This class only deals with brick values; see BlockVolReader,
+   * BlockVolWriter and ImageFactoryFromBlockVol for the image
+   * interface.
+   *
+   * @see testBlockVol.cpp
+   */
+  class BlockVolume
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Type of the values stored in a file.
+    typedef DGtal::uint64_t RawValue;
+
+    /**
+     * Constructor: no file is opened.
+     */
+    BlockVolume();
+
+    /**
+     * Destructor: closes the file.
+     */
+    ~BlockVolume();
+
+    /**
+     * Creates a new file, with an empty index (all the values are 0).
+     *
+     * @param aFilename the file name.
+     * @param anExtent the size of the volume in each dimension.
+     * @param aBrickSize the side of the bricks.
+     * @param aValueSize the number of bytes per value (1 to 8).
+     */
+    void create( const std::string & aFilename,
+                 const std::vector<unsigned int> & anExtent,
+                 const unsigned int aBrickSize,
+                 const unsigned int aValueSize ) throw( DGtal::IOException );
+
+    /**
+     * Opens an existing file.
+     *
+     * @param aFilename the file name.
+     * @param isWritable when 'true', bricks may be written.
+     */
+    void open( const std::string & aFilename, const bool isWritable = false )
+      throw( DGtal::IOException );
+
+    /**
+     * Closes the file, if any.
+     */
+    void close();
+
+    /**
+     * @return the dimension of the volume.
+     */
+    unsigned int dimension() const;
+
+    /**
+     * @return the size of the volume in each dimension.
+     */
+    const std::vector<unsigned int> & extent() const;
+
+    /**
+     * @return the side of the bricks.
+     */
+    unsigned int brickSize() const;
+
+    /**
+     * @return the number of bytes per value.
+     */
+    unsigned int valueSize() const;
+
+    /**
+     * @return the number of bricks in each dimension.
+     */
+    const std::vector<unsigned int> & gridExtent() const;
+
+    /**
+     * @return the number of bricks.
+     */
+    std::size_t nbBricks() const;
+
+    /**
+     * @return 'true' if bricks may be written.
+     */
+    bool isWritable() const;
+
+    /**
+     * @param aBrickCoordinates the coordinates of a brick in the grid
+     * of bricks.
+     * @return the index of the brick.
+     */
+    std::size_t brickIndex( const std::vector<unsigned int> & aBrickCoordinates ) const;
+
+    /**
+     * Computes the voxels of a brick.
+     *
+     * @param anIndex the index of a brick.
+     * @param aLower (returns) the coordinates of the first voxel of the brick.
+     * @param aSize (returns) the size of the brick in each dimension.
+     */
+    void brickBounds( const std::size_t anIndex, std::vector<unsigned int> & aLower,
+                      std::vector<unsigned int> & aSize ) const;
+
+    /**
+     * Reads a brick.
+     *
+     * @param anIndex the index of a brick.
+     * @param aValues (returns) the values of the brick, ordered along
+     * the first dimension first.
+     */
+    void readBrick( const std::size_t anIndex, std::vector<RawValue> & aValues )
+      throw( DGtal::IOException );
+
+    /**
+     * Writes a brick (the file must be writable).
+     *
+     * @param anIndex the index of a brick.
+     * @param aValues the values of the brick (see readBrick).
+     */
+    void writeBrick( const std::size_t anIndex, const std::vector<RawValue> & aValues )
+      throw( DGtal::IOException );
+
+    /**
+     * @param anIndex the index of a brick.
+     * @return the compressed size of the brick in the file.
+     */
+    std::size_t brickStoredSize( const std::size_t anIndex ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if a file is opened.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The file.
+    std::fstream myFile;
+    /// 'true' if bricks may be written.
+    bool myWritable;
+    /// Size of the volume.
+    std::vector<unsigned int> myExtent;
+    /// Number of bricks in each dimension.
+    std::vector<unsigned int> myGridExtent;
+    /// Side of the bricks.
+    unsigned int myBrickSize;
+    /// Number of bytes per value.
+    unsigned int myValueSize;
+    /// Position of the index in the file.
+    std::streamoff myIndexOffset;
+    /// Position of each brick in the file.
+    std::vector<DGtal::uint64_t> myOffsets;
+    /// Compressed size of each brick.
+    std::vector<DGtal::uint32_t> mySizes;
+    /// End of the used part of the file.
+    DGtal::uint64_t myEnd;
+    /// Free space between the bricks: size for each offset.
+    std::map<DGtal::uint64_t, DGtal::uint64_t> myHoles;
+    /// Compressed bytes of a brick.
+    std::vector<unsigned char> myCompressed;
+    /// Byte planes of a brick.
+    std::vector<unsigned char> myPlanes;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    BlockVolume( const BlockVolume & other );
+    BlockVolume & operator=( const BlockVolume & other );
+
+    /**
+     * Computes myGridExtent from myExtent and myBrickSize.
+     */
+    void computeGrid();
+
+    /**
+     * @param anIndex the index of a brick.
+     * @return the number of voxels of the brick.
+     */
+    std::size_t brickVolume( const std::size_t anIndex ) const;
+
+    /**
+     * Computes the free space (myHoles and myEnd) from the index.
+     */
+    void computeHoles();
+
+    /**
+     * Marks some space of the file as free, merging it with the
+     * adjacent free space.
+     * @param anOffset the position of the space.
+     * @param aSize its size.
+     */
+    void release( const DGtal::uint64_t anOffset, const DGtal::uint64_t aSize );
+
+    /**
+     * Finds free space for a brick (first fit, or at the end of the
+     * file), which is then used.
+     * @param aSize the needed size.
+     * @return the position of the space.
+     */
+    DGtal::uint64_t allocate( const DGtal::uint64_t aSize );
+
+    /**
+     * Writes the index entry of a brick.
+     * @param anIndex the index of a brick.
+     */
+    void writeIndexEntry( const std::size_t anIndex ) throw( DGtal::IOException );
+
+  }; // end of class BlockVolume
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BlockVolume'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BlockVolume' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const BlockVolume & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/BlockVolume.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BlockVolume_h
+
+#undef BlockVolume_RECURSES
+#endif // else defined(BlockVolume_RECURSES)
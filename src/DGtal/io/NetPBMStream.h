@@ -0,0 +1,270 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NetPBMStream.h
+ *
+ * Header file for module NetPBMStream.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NetPBMStream_RECURSES)
+#error Recursive header files inclusion detected in NetPBMStream.h
+#else // defined(NetPBMStream_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NetPBMStream_RECURSES
+
+#if !defined NetPBMStream_h
+/** Prevents repeated inclusion of headers. */
+#define NetPBMStream_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class NetPBMInputStream
+  /**
+   * Description of class 'NetPBMInputStream' <p>
+   * \brief Aim: Buffered reading of the header and of the samples of
+   * a Netpbm file (PGM, PPM and their 3D variants), used by PGMReader
+   * and PPMReader.
+   *
+   * The header is read token by token, '#' comments being skipped.
+   * Samples are then read by blocks (e.g. a whole slice):
+   * - in binary mode, with one byte per sample if the maximal value
+   *   is lower than 256 and with two bytes per sample (most
+   *   significant byte first) otherwise,
+   * - in ASCII mode, with a tokenizer which does not depend on the
+   *   locale of the stream.
+   *
+   * The stream should be opened in binary mode.
+   *
+   * @code
+   * std::ifstream infile( filename.c_str(), std::ifstream::in | std::ifstream::binary );
+   * NetPBMInputStream in( infile );
+   * std::string magic;
+   * unsigned int w, h, maxValue;
+   * in.readHeaderToken( magic );
+   * in.readHeaderValue( w ); in.readHeaderValue( h ); in.readHeaderValue( maxValue );
+   * in.skipHeaderEnd();
+   * std::vector<unsigned int> samples( w*h );
+   * in.readSamples( &samples[0], w*h, magic == "P2", maxValue );
+   * @endcode
+   */
+  class NetPBMInputStream
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anInput the stream to read, positioned at the beginning
+     * of the header.
+     */
+    NetPBMInputStream( std::istream & anInput );
+
+    /**
+     * Reads the next header token, skipping white spaces and comments.
+     * @param aToken (returns) the token.
+     * @return 'true' if a token was read.
+     */
+    bool readHeaderToken( std::string & aToken );
+
+    /**
+     * Reads the next header token as an unsigned integer.
+     * @param aValue (returns) the value.
+     * @return 'true' if the token was a valid unsigned integer.
+     */
+    bool readHeaderValue( unsigned int & aValue );
+
+    /**
+     * Skips the single white space character which ends the header
+     * (after the maximal value). Nothing else is consumed, since
+     * binary samples may start with blank bytes.
+     */
+    void skipHeaderEnd();
+
+    /**
+     * Reads a block of samples.
+     *
+     * @param aSamples (returns) a pointer on at least @a aNumber values.
+     * @param aNumber the number of samples to read.
+     * @param isASCII 'true' if the samples are written in ASCII.
+     * @param aMaxValue the maximal value of the file, which gives the
+     * number of bytes per sample in binary mode.
+     * @return the number of samples actually read.
+     */
+    std::size_t readSamples( unsigned int * aSamples, const std::size_t aNumber,
+                             const bool isASCII, const unsigned int aMaxValue );
+
+    /**
+     * Reads raw bytes.
+     * @param aBuffer (returns) a pointer on at least @a aNumber bytes.
+     * @param aNumber the number of bytes to read.
+     * @return the number of bytes actually read.
+     */
+    std::size_t readBytes( char * aBuffer, const std::size_t aNumber );
+
+    /**
+     * Reads the next ASCII unsigned integer, skipping white spaces.
+     * @param aValue (returns) the value.
+     * @return 'true' if a value was read.
+     */
+    bool readValue( unsigned int & aValue );
+
+    /**
+     * @return the number of characters extracted so far, e.g. the
+     * size of the header after skipHeaderEnd().
+     */
+    std::size_t consumed() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Size of the read buffer.
+    enum { BufferSize = 1 << 16 };
+
+    /// The input stream.
+    std::istream & myInput;
+    /// The read buffer.
+    std::vector<char> myBuffer;
+    /// Position of the next character in myBuffer.
+    std::size_t myPos;
+    /// Number of valid characters in myBuffer.
+    std::size_t myEnd;
+    /// Number of characters read from the stream.
+    std::size_t myLoaded;
+    /// Buffer for the binary samples.
+    std::vector<unsigned char> myBytes;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    NetPBMInputStream( const NetPBMInputStream & other );
+    NetPBMInputStream & operator=( const NetPBMInputStream & other );
+
+    /**
+     * Fills the buffer if it is empty.
+     * @return 'false' at the end of the stream.
+     */
+    bool fill();
+
+    /**
+     * @return the next character, or -1 at the end of the stream (the
+     * character is not extracted).
+     */
+    int peek();
+
+  }; // end of class NetPBMInputStream
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class NetPBMOutputStream
+  /**
+   * Description of class 'NetPBMOutputStream' <p>
+   * \brief Aim: Buffered writing of the samples of a Netpbm file,
+   * used by PGMWriter and PPMWriter.
+   *
+   * ASCII values are formatted without the locale facets of the
+   * stream, each of them followed by a white space. The buffer is
+   * flushed when it is full and at destruction.
+   */
+  class NetPBMOutputStream
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param anOutput the stream to write.
+     */
+    NetPBMOutputStream( std::ostream & anOutput );
+
+    /**
+     * Destructor: flushes the buffer.
+     */
+    ~NetPBMOutputStream();
+
+    /**
+     * Writes a sample as a byte.
+     * @param aValue the value.
+     */
+    void writeByte( const unsigned char aValue );
+
+    /**
+     * Writes a sample in ASCII followed by a white space.
+     * @param aValue the value.
+     */
+    void writeValue( const unsigned int aValue );
+
+    /**
+     * Writes samples as bytes.
+     * @param someValues the first value.
+     * @param aNumber the number of values.
+     */
+    void writeBytes( const unsigned char* someValues, std::size_t aNumber );
+
+    /**
+     * Writes the buffer to the stream.
+     */
+    void flush();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Size of the write buffer.
+    enum { BufferSize = 1 << 16 };
+
+    /// The output stream.
+    std::ostream & myOutput;
+    /// The write buffer.
+    std::vector<char> myBuffer;
+    /// Number of characters in myBuffer.
+    std::size_t myEnd;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    NetPBMOutputStream( const NetPBMOutputStream & other );
+    NetPBMOutputStream & operator=( const NetPBMOutputStream & other );
+
+  }; // end of class NetPBMOutputStream
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/NetPBMStream.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NetPBMStream_h
+
+#undef NetPBMStream_RECURSES
+#endif // else defined(NetPBMStream_RECURSES)
@@ -0,0 +1,314 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file TabulatedColorMap.h
+ *
+ * Header file for module TabulatedColorMap.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(TabulatedColorMap_RECURSES)
+#error Recursive header files inclusion detected in TabulatedColorMap.h
+#else // defined(TabulatedColorMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define TabulatedColorMap_RECURSES
+
+#if !defined TabulatedColorMap_h
+/** Prevents repeated inclusion of headers. */
+#define TabulatedColorMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/Color.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class TabulatedColorMap
+  /**
+   * Description of template class 'TabulatedColorMap' <p>
+   * \brief Aim: A color map whose colors are precomputed once for
+   * every value of an integral range [min,max], so that converting a
+   * value is a table lookup instead of a (floating point)
+   * interpolation.
+   *
+   * The colors are computed by another color map (e.g.
+   * GradientColorMap or HueShadeColorMap) and stored as packed RGBA
+   * bytes. Values outside of [min,max] are given to the wrapped color
+   * map. Besides the usual operator(), whole ranges of values are
+   * converted at once into Color objects, packed RGB bytes (as written
+   * in PPM files) or packed RGBA bytes (as uploaded to textures), see
+   * colorize(), colorizeRGB() and colorizeRGBA(). The free functions
+   * DGtal::colorizeRGB() and DGtal::colorizeRGBA() do the same with
+   * any color functor and use the table when given a
+   * TabulatedColorMap.
+   *
+   * The table has (max - min + 1) entries of 4 bytes: this class is
+   * meant for 8, 12 or 16 bits images, not for 32 bits ranges.
+   *
+   * @code
+   * GradientColorMap<int> grad( 0, 4095, CMAP_JET );
+   * TabulatedColorMap< GradientColorMap<int> > lut( grad );
+   * PPMWriter< Image, TabulatedColorMap< GradientColorMap<int> > >
+   *   ::exportPPM( "out.ppm", image, lut );
+   * @endcode
+   *
+   * It is a model of CColorMap.
+   *
+   * @tparam TColorMap the type of the tabulated color map, a model of
+   * CColorMap whose Value type is integral.
+   */
+  template <typename TColorMap>
+  class TabulatedColorMap
+  {
+  public:
+
+    typedef TColorMap ColorMap;
+    typedef typename TColorMap::Value Value;
+
+    BOOST_STATIC_ASSERT(( boost::is_integral< Value >::value ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Tabulates the color map TColorMap( min, max ).
+     *
+     * @param min The lower bound of the value range.
+     * @param max The upper bound of the value range.
+     */
+    TabulatedColorMap( const Value & min, const Value & max );
+
+    /**
+     * Constructor. Tabulates \a aColorMap on its range [aColorMap.min(),
+     * aColorMap.max()].
+     *
+     * @param aColorMap any color map with methods min() and max().
+     */
+    TabulatedColorMap( const ColorMap & aColorMap );
+
+    /**
+     * Constructor. Tabulates \a aColorMap on the range [min,max].
+     *
+     * @param aColorMap any color map.
+     * @param min The lower bound of the tabulated range.
+     * @param max The upper bound of the tabulated range.
+     */
+    TabulatedColorMap( const ColorMap & aColorMap,
+                       const Value & min, const Value & max );
+
+    /**
+     * Computes the color associated with a value.
+     *
+     * @param value any value.
+     * @return the tabulated color of \a value if it lies in [min,max],
+     * the color given by the wrapped color map otherwise.
+     */
+    Color operator()( const Value & value ) const;
+
+    /**
+     * @return the lower bound of the tabulated range.
+     */
+    const Value & min() const;
+
+    /**
+     * @return the upper bound of the tabulated range.
+     */
+    const Value & max() const;
+
+    /**
+     * @return the wrapped color map.
+     */
+    const ColorMap & colorMap() const;
+
+    /**
+     * @return the number of tabulated colors.
+     */
+    std::size_t size() const;
+
+    // ----------------------- Batch services ---------------------------------
+  public:
+
+    /**
+     * Writes the colors of the values of [itb,ite) to \a out.
+     *
+     * @tparam TInputIterator an input iterator on values.
+     * @tparam TOutputIterator an output iterator on Color.
+     * @param itb the first value.
+     * @param ite past the last value.
+     * @param out the first output color.
+     * @return the output iterator past the last written color.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator colorize( TInputIterator itb, TInputIterator ite,
+                              TOutputIterator out ) const;
+
+    /**
+     * Writes the colors of the values of [itb,ite) to \a out as
+     * packed red, green, blue bytes.
+     *
+     * @tparam TInputIterator an input iterator on values.
+     * @param itb the first value.
+     * @param ite past the last value.
+     * @param out a buffer of 3 bytes per value.
+     * @return the pointer past the last written byte.
+     */
+    template <typename TInputIterator>
+    unsigned char* colorizeRGB( TInputIterator itb, TInputIterator ite,
+                                unsigned char* out ) const;
+
+    /**
+     * Writes the colors of the values of [itb,ite) to \a out as
+     * packed red, green, blue, alpha bytes.
+     *
+     * @tparam TInputIterator an input iterator on values.
+     * @param itb the first value.
+     * @param ite past the last value.
+     * @param out a buffer of 4 bytes per value.
+     * @return the pointer past the last written byte.
+     */
+    template <typename TInputIterator>
+    unsigned char* colorizeRGBA( TInputIterator itb, TInputIterator ite,
+                                 unsigned char* out ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// The tabulated color map.
+    ColorMap myColorMap;
+    /// The lower bound of the tabulated range.
+    Value myMin;
+    /// The upper bound of the tabulated range.
+    Value myMax;
+    /// The red, green, blue and alpha bytes of each value of [min,max].
+    std::vector<unsigned char> myTable;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Fills the table from myColorMap.
+     */
+    void tabulate();
+
+    /**
+     * @param value any value.
+     * @return the RGBA bytes of \a value, or 0 if it is not tabulated.
+     */
+    const unsigned char* entry( const Value & value ) const;
+
+  }; // end of class TabulatedColorMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'TabulatedColorMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'TabulatedColorMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TColorMap>
+  std::ostream&
+  operator<< ( std::ostream & out, const TabulatedColorMap<TColorMap> & object );
+
+  /**
+   * Writes the colors given by \a aFunctor to the values of
+   * [itb,ite) as packed red, green, blue bytes.
+   *
+   * @tparam TFunctor a functor from values to Color.
+   * @tparam TInputIterator an input iterator on values.
+   * @param aFunctor the color functor.
+   * @param itb the first value.
+   * @param ite past the last value.
+   * @param out a buffer of 3 bytes per value.
+   * @return the pointer past the last written byte.
+   */
+  template <typename TFunctor, typename TInputIterator>
+  unsigned char* colorizeRGB( const TFunctor & aFunctor,
+                              TInputIterator itb, TInputIterator ite,
+                              unsigned char* out );
+
+  /**
+   * Overload of colorizeRGB for TabulatedColorMap (table lookups).
+   */
+  template <typename TColorMap, typename TInputIterator>
+  unsigned char* colorizeRGB( const TabulatedColorMap<TColorMap> & aColorMap,
+                              TInputIterator itb, TInputIterator ite,
+                              unsigned char* out );
+
+  /**
+   * Writes the colors given by \a aFunctor to the values of
+   * [itb,ite) as packed red, green, blue, alpha bytes.
+   *
+   * @tparam TFunctor a functor from values to Color.
+   * @tparam TInputIterator an input iterator on values.
+   * @param aFunctor the color functor.
+   * @param itb the first value.
+   * @param ite past the last value.
+   * @param out a buffer of 4 bytes per value.
+   * @return the pointer past the last written byte.
+   */
+  template <typename TFunctor, typename TInputIterator>
+  unsigned char* colorizeRGBA( const TFunctor & aFunctor,
+                               TInputIterator itb, TInputIterator ite,
+                               unsigned char* out );
+
+  /**
+   * Overload of colorizeRGBA for TabulatedColorMap (table lookups).
+   */
+  template <typename TColorMap, typename TInputIterator>
+  unsigned char* colorizeRGBA( const TabulatedColorMap<TColorMap> & aColorMap,
+                               TInputIterator itb, TInputIterator ite,
+                               unsigned char* out );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/colormaps/TabulatedColorMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined TabulatedColorMap_h
+
+#undef TabulatedColorMap_RECURSES
+#endif // else defined(TabulatedColorMap_RECURSES)
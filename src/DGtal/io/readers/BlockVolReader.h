@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BlockVolReader.h
+ *
+ * Header file for module BlockVolReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BlockVolReader_RECURSES)
+#error Recursive header files inclusion detected in BlockVolReader.h
+#else // defined(BlockVolReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BlockVolReader_RECURSES
+
+#if !defined BlockVolReader_h
+/** Prevents repeated inclusion of headers. */
+#define BlockVolReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/BlockVolume.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4290)
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BlockVolReader
+  /**
+   * Description of template class 'BlockVolReader' <p>
+   * \brief Aim: implements methods to read a block compressed volume
+   * ("bvol" format, see BlockVolume) of any dimension.
+   *
+   * The main import method "importBlockVol" returns an instance of
+   * the template parameter TImageContainer, whose domain is [0,
+   * size-1] in each dimension. To read some parts of a large volume
+   * only, use ImageFactoryFromBlockVol (e.g. with TiledImage).
+   *
+   * Example usage:
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, unsigned int> Image;
+   * Image image = BlockVolReader<Image>::importBlockVol( "labels.bvol" );
+   * @endcode
+   *
+   * @tparam TImageContainer the image container to use.
+   * @tparam TFunctor the type of functor used in the import (by
+   * default set to CastFunctor< TImageContainer::Value>).
+   *
+   * @see testBlockVol.cpp
+   */
+  template <typename TImageContainer,
+            typename TFunctor = CastFunctor< typename TImageContainer::Value > >
+  struct BlockVolReader
+  {
+    // ----------------------- Standard services ------------------------------
+
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Value Value;
+    typedef TFunctor Functor;
+
+    BOOST_CONCEPT_ASSERT(( CUnaryFunctor<TFunctor, DGtal::uint64_t, Value > ));
+
+    /**
+     * Main method to import a bvol file into an instance of the
+     * template parameter ImageContainer.
+     *
+     * @param aFilename the file name to import.
+     * @param aFunctor the functor used to import and cast the source
+     * image values into the type of the image container value (by
+     * default set to CastFunctor < TImageContainer::Value > ).
+     *
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer importBlockVol( const std::string & aFilename,
+                                          const Functor & aFunctor = Functor() )
+      throw( DGtal::IOException );
+
+  }; // end of class BlockVolReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/BlockVolReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BlockVolReader_h
+
+#undef BlockVolReader_RECURSES
+#endif // else defined(BlockVolReader_RECURSES)
@@ -49,6 +49,7 @@
 #include "DGtal/io/readers/PPMReader.h"
 #include "DGtal/io/readers/PGMReader.h"
 #include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/BlockVolReader.h"
 #ifdef WITH_HDF5
 #include "DGtal/io/readers/HDF5Reader.h"
 #endif
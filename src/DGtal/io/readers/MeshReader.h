@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <string>
+#include <vector>
 #include <DGtal/kernel/SpaceND.h>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
@@ -50,6 +52,69 @@
 namespace DGtal
 {
 
+  namespace details
+  {
+    /// Scalar types of the PLY format.
+    enum PLYType { PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16, 
+                   PLY_INT32, PLY_UINT32, PLY_FLOAT32, PLY_FLOAT64, PLY_UNKNOWN };
+
+    /**
+     * @param aName a PLY type name (e.g. "uchar", "int32", "double").
+     * @return the corresponding type (PLY_UNKNOWN if none).
+     */
+    PLYType plyType( const std::string & aName );
+
+    /// A property of an element in a PLY header.
+    struct PLYProperty
+    {
+      std::string name;
+      PLYType type;
+      /// 'true' for a list property, whose size is of type countType.
+      bool isList;
+      PLYType countType;
+    };
+
+    /// An element (e.g. "vertex", "face") in a PLY header.
+    struct PLYElement
+    {
+      std::string name;
+      std::size_t count;
+      std::vector<PLYProperty> properties;
+    };
+
+    /**
+     * Description of class 'PLYValueReader' <p>
+     * \brief Aim: reads the values of the body of a PLY file, in
+     * ascii or binary (little or big endian) format. Binary data are
+     * read by chunks in an internal buffer.
+     */
+    class PLYValueReader
+    {
+    public:
+      /**
+       * Constructor.
+       * @param in the input stream, positioned after the header.
+       * @param isAscii 'true' for the ascii format.
+       * @param isBigEndian 'true' for the binary big endian format.
+       */
+      PLYValueReader( std::istream & in, bool isAscii, bool isBigEndian );
+
+      /**
+       * Reads a value.
+       * @param aType the type of the value.
+       * @return the value.
+       */
+      double read( PLYType aType ) throw( DGtal::IOException );
+
+    private:
+      std::istream & myIn;
+      bool myAscii;
+      bool myBigEndian;
+      std::vector<char> myBuffer;
+      std::size_t myPosition;
+      std::size_t myEnd;
+    };
+  }
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -57,7 +122,7 @@ namespace DGtal
 /**
  * Description of class 'MeshReader' <p> 
  * \brief Aim: Defined to import
- * OFF and OFS surface mesh. It allows to import a Mesh object and takes
+ * OFF, OFS and PLY surface mesh. It allows to import a Mesh object and takes
  * into accouts the optional color faces.
  * 
  * The importation can be done automatically according the input file
@@ -126,6 +191,24 @@ public:
   
   static  bool  importOFSFile(const std::string & filename, 
 			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false, double scale=1.0) throw(DGtal::IOException);
+
+
+ /** 
+  * Main method to import PLY meshes file (Stanford polygon file
+  * format), in ascii, binary little endian or binary big endian
+  * format. The vertices are given by the x, y, z properties of the
+  * "vertex" element, the faces by the vertex_indices list of the
+  * "face" element, with optional red, green, blue, alpha colors. The
+  * other elements and properties are skipped.
+  * 
+  * @param filename the file name to import.
+  * @param aMesh (return) the mesh object to be imported.
+  * @param invertVertexOrder used to invert (default value=false) the order of imported points (important for normal orientation). 
+  * @return true if the mesh has been imported.
+  */
+  
+  static  bool  importPLYFile(const std::string & filename, 
+			      DGtal::Mesh<TPoint> & aMesh, bool invertVertexOrder=false) throw(DGtal::IOException);
   
   
   
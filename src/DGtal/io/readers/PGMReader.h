@@ -86,6 +86,13 @@ namespace DGtal
  *  board << image.domain() << set2d; // display domain and set   
  *  @endcode
  *
+ * Binary files are read by whole slices (see NetPBMInputStream)
+ * and the image is filled row by row (see imageFromRow), so that the
+ * import is not slowed down by the stream. Files whose maximal value
+ * is greater than 255 are 16 bits files (two bytes per value, most
+ * significant byte first): the values given to the functor are then
+ * in [0, 65535].
+ *
  * @tparam TImageContainer the type of the image container
  *
  * @tparam TFunctor the type of functor used in the import (by default set to CastFunctor< TImageContainer::Value>) .
@@ -114,7 +121,7 @@ namespace DGtal
                          (ImageContainer::Domain::dimension == 3));
 
     /** 
-     * Main method to import a Pgm (8bits) into an instance of the 
+     * Main method to import a Pgm (8 or 16 bits) into an instance of the 
      * template parameter ImageContainer.
      * 
      * @param aFilename the file name to import.  
@@ -136,7 +143,7 @@ namespace DGtal
    
 
     /** 
-     * Main method to import a Pgm3D (8bits) into an instance of the 
+     * Main method to import a Pgm3D (8 or 16 bits) into an instance of the 
      * template parameter ImageContainer.
      * 
      * @param aFilename the file name to import.
@@ -115,7 +115,9 @@ namespace DGtal
    
      /** 
      * Main method to import a PPM (24bit, 8bits per channel) into an instance of the 
-     * template parameter ImageContainer.
+     * template parameter ImageContainer. The pixels are read at
+     * once (see NetPBMInputStream). The channels of a 16 bits file
+     * (maximal value greater than 255) are scaled to 8 bits.
      * 
      * @param aFilename the file name to import.  
      * @param aFunctor the functor that from a given color return it associated code (by default set to BasicColorToScalarFunctors::ColorRGBEncoder). 
@@ -0,0 +1,380 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VolumeSliceReader.h
+ *
+ * Header file for module VolumeSliceReader.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VolumeSliceReader_RECURSES)
+#error Recursive header files inclusion detected in VolumeSliceReader.h
+#else // defined(VolumeSliceReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VolumeSliceReader_RECURSES
+
+#if !defined VolumeSliceReader_h
+/** Prevents repeated inclusion of headers. */
+#define VolumeSliceReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#ifdef WITH_HDF5
+#include <hdf5.h>
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4290)
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class VolumeSliceReader
+  /**
+   * Description of class 'VolumeSliceReader' <p>
+   * \brief Aim: Streaming import of a 3D volume, one z-slice (or
+   * one slab of z-slices) at a time, into an image provided by the
+   * caller.
+   *
+   * Unlike VolReader, LongvolReader, RawReader, PGMReader or
+   * HDF5Reader, which return the whole image, this reader only keeps
+   * one slice in memory, so that volumes larger than the memory can
+   * be processed slab by slab in constant memory (thresholding,
+   * histograms, boundary extraction...).
+   *
+   * The supported formats are:
+   * - vol (8 bits values) and longvol (64 bits values),
+   * - binary PGM3D (P5-3D, P3D, 8 or 16 bits values),
+   * - raw 8 bits files, whose extent is given by the caller,
+   * - HDF5 3D datasets (hyperslabs), if DGtal is built WITH_HDF5.
+   *
+   * The volume domain is [0, width()-1] x [0, height()-1] x [0,
+   * depth()-1] as for the other readers. Slices are read in any
+   * order (readSlice) or sequentially (nextSlice). A slice is stored
+   * row by row in a 2D image of extent width() x height() (see
+   * imageFromRow), a slab in a 3D image whose domain gives the
+   * z-slices to read (readSlab).
+   *
+   * A reader is not thread-safe: slabs are read in sequence, and
+   * may then be processed in parallel.
+   *
+   * @code
+   * VolumeSliceReader reader;
+   * reader.open( "huge.vol" );
+   * Image2D slice( Z2i::Domain( Z2i::Point( 0, 0 ),
+   *                             Z2i::Point( reader.width()-1, reader.height()-1 ) ) );
+   * while ( reader.nextSlice( slice ) )
+   *   {
+   *     // process the slice reader.currentSlice()-1
+   *   }
+   * @endcode
+   *
+   * @see testVolumeSliceReader.cpp
+   */
+  class VolumeSliceReader
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Type of the values read in a file.
+    typedef DGtal::uint64_t RawValue;
+
+    /// Supported formats.
+    enum Format { NONE, VOL, LONGVOL, PGM3D, RAW8, HDF5 };
+
+    /**
+     * Constructor: no file is opened.
+     */
+    VolumeSliceReader();
+
+    /**
+     * Destructor: closes the file.
+     */
+    ~VolumeSliceReader();
+
+    /**
+     * Opens a volume, whose format is given by the file extension
+     * (vol, longvol, pgm3d/p3d/pgm, and h5 with the dataset
+     * "UInt8Array3D" if DGtal is built WITH_HDF5).
+     *
+     * @param aFilename the file name.
+     */
+    void open( const std::string & aFilename ) throw( DGtal::IOException );
+
+    /**
+     * Opens a vol file.
+     * @param aFilename the file name.
+     */
+    void openVol( const std::string & aFilename ) throw( DGtal::IOException );
+
+    /**
+     * Opens a longvol file.
+     * @param aFilename the file name.
+     */
+    void openLongvol( const std::string & aFilename ) throw( DGtal::IOException );
+
+    /**
+     * Opens a binary PGM3D file.
+     * @param aFilename the file name.
+     */
+    void openPGM3D( const std::string & aFilename ) throw( DGtal::IOException );
+
+    /**
+     * Opens a raw 8 bits file (see RawReader::importRaw8).
+     * @param aFilename the file name.
+     * @param aWidth the size of the volume along x.
+     * @param aHeight the size of the volume along y.
+     * @param aDepth the size of the volume along z.
+     */
+    void openRaw8( const std::string & aFilename, const unsigned int aWidth,
+                   const unsigned int aHeight, const unsigned int aDepth )
+      throw( DGtal::IOException );
+
+#ifdef WITH_HDF5
+    /**
+     * Opens a 3D dataset of an HDF5 file. Slices are read as
+     * hyperslabs of the dataset.
+     * @param aFilename the file name.
+     * @param aDataset the dataset name.
+     */
+    void openHDF5( const std::string & aFilename, const std::string & aDataset )
+      throw( DGtal::IOException );
+#endif
+
+    /**
+     * Closes the file, if any.
+     */
+    void close();
+
+    /**
+     * @return the format of the opened file (NONE if no file is opened).
+     */
+    Format format() const;
+
+    /**
+     * @return the size of the volume along x.
+     */
+    unsigned int width() const;
+
+    /**
+     * @return the size of the volume along y.
+     */
+    unsigned int height() const;
+
+    /**
+     * @return the number of slices (size of the volume along z).
+     */
+    unsigned int depth() const;
+
+    /**
+     * @return the index of the slice read by the next call to
+     * nextSlice.
+     */
+    unsigned int currentSlice() const;
+
+    /**
+     * Reads the values of a slice.
+     *
+     * @param aSlice the index of the slice, in [0, depth()-1].
+     * @return the width() x height() values of the slice, x first
+     * (valid until the next read).
+     */
+    const std::vector<RawValue> & readSliceValues( const unsigned int aSlice )
+      throw( DGtal::IOException );
+
+    /**
+     * Reads a slice into a 2D image.
+     *
+     * @param aSlice the index of the slice, in [0, depth()-1].
+     * @param anImage (returns) a 2D image of extent width() x
+     * height(): the value of the voxel (x, y, @a aSlice) is stored at
+     * the point anImage.domain().lowerBound() + (x, y).
+     * @param aFunctor the functor used to cast the file values
+     * (RawValue) into the image values.
+     *
+     * @tparam TImage a model of CImage (2D).
+     * @tparam TFunctor a model of CUnaryFunctor<TFunctor, RawValue, TImage::Value>.
+     */
+    template <typename TImage, typename TFunctor>
+    void readSlice( const unsigned int aSlice, TImage & anImage,
+                    const TFunctor & aFunctor ) throw( DGtal::IOException );
+
+    /**
+     * Reads a slice into a 2D image, casting the values.
+     *
+     * @param aSlice the index of the slice, in [0, depth()-1].
+     * @param anImage (returns) a 2D image of extent width() x height().
+     */
+    template <typename TImage>
+    void readSlice( const unsigned int aSlice, TImage & anImage )
+      throw( DGtal::IOException );
+
+    /**
+     * Reads the slice currentSlice() into a 2D image and moves to the
+     * next slice.
+     *
+     * @param anImage (returns) a 2D image of extent width() x height().
+     * @param aFunctor the functor used to cast the file values.
+     * @return 'false' if all the slices have been read.
+     */
+    template <typename TImage, typename TFunctor>
+    bool nextSlice( TImage & anImage, const TFunctor & aFunctor )
+      throw( DGtal::IOException );
+
+    /**
+     * Reads the slice currentSlice() into a 2D image, casting the
+     * values, and moves to the next slice.
+     *
+     * @param anImage (returns) a 2D image of extent width() x height().
+     * @return 'false' if all the slices have been read.
+     */
+    template <typename TImage>
+    bool nextSlice( TImage & anImage ) throw( DGtal::IOException );
+
+    /**
+     * Reads a slab of slices into a 3D image: the slices read are the
+     * z coordinates of the image domain, which must be [0, width()-1]
+     * x [0, height()-1] x [z0, z1] with 0 <= z0 <= z1 < depth().
+     *
+     * @param anImage (returns) a 3D image.
+     * @param aFunctor the functor used to cast the file values.
+     */
+    template <typename TImage, typename TFunctor>
+    void readSlab( TImage & anImage, const TFunctor & aFunctor )
+      throw( DGtal::IOException );
+
+    /**
+     * Reads a slab of slices into a 3D image, casting the values.
+     *
+     * @param anImage (returns) a 3D image (see above).
+     */
+    template <typename TImage>
+    void readSlab( TImage & anImage ) throw( DGtal::IOException );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if a file is opened.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Format of the opened file.
+    Format myFormat;
+    /// Size of the volume.
+    unsigned int myWidth;
+    /// Size of the volume.
+    unsigned int myHeight;
+    /// Size of the volume.
+    unsigned int myDepth;
+    /// Index of the next slice for nextSlice.
+    unsigned int myCurrentSlice;
+    /// The file (all formats but HDF5).
+    std::ifstream myFile;
+    /// Position of the first value in myFile.
+    std::streamoff myDataOffset;
+    /// Number of bytes per value in myFile.
+    unsigned int myBytesPerValue;
+    /// 'true' if the values are stored most significant byte first.
+    bool myBigEndian;
+    /// Bytes of a slice.
+    std::vector<unsigned char> myBytes;
+    /// Values of a slice.
+    std::vector<RawValue> myValues;
+#ifdef WITH_HDF5
+    /// HDF5 file handle.
+    hid_t myH5File;
+    /// HDF5 dataset handle.
+    hid_t myH5Dataset;
+    /// HDF5 dataspace handle.
+    hid_t myH5Dataspace;
+#endif
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    VolumeSliceReader( const VolumeSliceReader & other );
+    VolumeSliceReader & operator=( const VolumeSliceReader & other );
+
+    /**
+     * Opens a vol or a longvol file.
+     * @param aFilename the file name.
+     * @param isLongvol 'true' for a longvol file.
+     */
+    void openVolOrLongvol( const std::string & aFilename, const bool isLongvol )
+      throw( DGtal::IOException );
+
+    /**
+     * Opens myFile in binary mode.
+     * @param aFilename the file name.
+     */
+    void openFile( const std::string & aFilename ) throw( DGtal::IOException );
+
+    /**
+     * Checks the size of the file from the header.
+     * @param aFilename the file name (for the error message).
+     */
+    void checkFileSize( const std::string & aFilename ) throw( DGtal::IOException );
+
+  }; // end of class VolumeSliceReader
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'VolumeSliceReader'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'VolumeSliceReader' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const VolumeSliceReader & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/VolumeSliceReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VolumeSliceReader_h
+
+#undef VolumeSliceReader_RECURSES
+#endif // else defined(VolumeSliceReader_RECURSES)
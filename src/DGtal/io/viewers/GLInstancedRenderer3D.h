@@ -0,0 +1,448 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file GLInstancedRenderer3D.h
+ *
+ * Header file for module GLInstancedRenderer3D.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(GLInstancedRenderer3D_RECURSES)
+#error Recursive header files inclusion detected in GLInstancedRenderer3D.h
+#else // defined(GLInstancedRenderer3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define GLInstancedRenderer3D_RECURSES
+
+#if !defined GLInstancedRenderer3D_h
+/** Prevents repeated inclusion of headers. */
+#define GLInstancedRenderer3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <deque>
+#include <vector>
+#include <cstddef>
+#ifdef APPLE
+#include <OpenGL/gl.h>
+#else
+#include <GL/gl.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/io/viewers/InstanceChunkBuffer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+// OpenGL 1.5/2.0 enumerants (gl.h may only declare OpenGL 1.1).
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#endif
+#ifndef GL_STATIC_DRAW
+#define GL_STATIC_DRAW 0x88E4
+#endif
+#ifndef GL_FRAGMENT_SHADER
+#define GL_FRAGMENT_SHADER 0x8B30
+#endif
+#ifndef GL_VERTEX_SHADER
+#define GL_VERTEX_SHADER 0x8B31
+#endif
+#ifndef GL_COMPILE_STATUS
+#define GL_COMPILE_STATUS 0x8B81
+#endif
+#ifndef GL_LINK_STATUS
+#define GL_LINK_STATUS 0x8B82
+#endif
+#ifndef GL_CURRENT_PROGRAM
+#define GL_CURRENT_PROGRAM 0x8B8D
+#endif
+
+/** Calling convention of the OpenGL entry points. */
+#if defined(_WIN32) && !defined(__CYGWIN__)
+#define DGTAL_GLAPIENTRY __stdcall
+#else
+#define DGTAL_GLAPIENTRY
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class GLInstancedRenderer3D
+  /**
+   * Description of class 'GLInstancedRenderer3D' <p>
+   * \brief Aim: Draws large sets of cubes and quads (the CubeD3D and
+   * QuadD3D lists of Display3D) with vertex buffer objects and
+   * instancing, instead of display lists.
+   *
+   * Each list of primitives is packed by an InstanceChunkBuffer into
+   * a buffer object of instance records (20 bytes per cube, 52 bytes
+   * per quad), drawn with glDrawArraysInstancedARB over a shared unit
+   * cube (or quad) mesh and a small GLSL program. Updating the lists
+   * uploads again only the chunks that have changed. At each frame,
+   * chunks outside of the view frustum are skipped, and far chunks are
+   * drawn at a coarser level of detail (fewer, larger instances), see
+   * setLevelOfDetail().
+   *
+   * The renderer needs a current OpenGL 2.1 (compatibility) context
+   * with the ARB_instanced_arrays and ARB_draw_instanced extensions.
+   * The OpenGL 1.5/2.0 and extension functions are not linked
+   * statically (e.g. opengl32 on Windows only exports OpenGL 1.1):
+   * init() loads them with a function given by the caller, such as
+   * QGLContext::getProcAddress, glXGetProcAddress or
+   * eglGetProcAddress, and fails if one of them is missing.
+   * It uses the current modelview and projection matrices, the user
+   * clip planes and the light GL_LIGHT0. Primitives are not sorted
+   * from back to front, nor named for selection.
+   *
+   * @code
+   * GLInstancedRenderer3D renderer;
+   * if ( renderer.init( myGetProcAddress ) )  // with a current context
+   *   {
+   *     renderer.updateCubeSets( myCubeSetList );
+   *     renderer.draw();
+   *   }
+   * @endcode
+   *
+   * @see Viewer3D, InstanceChunkBuffer
+   */
+  class GLInstancedRenderer3D
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef InstanceChunkBuffer< CubeInstance3D > CubeBuffer;
+    typedef InstanceChunkBuffer< QuadInstance3D > QuadBuffer;
+    typedef std::size_t Size;
+
+    /**
+     * Type of the functions returning the address of an OpenGL
+     * function of the current context from its name (0 if it is not
+     * available).
+     */
+    typedef void* (*ProcAddressLoader)( const char* name );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The renderer is not initialized.
+     * @param chunkSize the number of instances per chunk (see InstanceChunkBuffer).
+     */
+    GLInstancedRenderer3D( Size chunkSize = 32768 );
+
+    /**
+     * Destructor. The OpenGL objects are not released, since the
+     * context may be gone: call clear() before.
+     */
+    ~GLInstancedRenderer3D();
+
+    /**
+     * Loads the OpenGL functions, creates the shaders and the shared
+     * meshes. Needs a current OpenGL context.
+     * @param loader the function returning the address of the OpenGL
+     * functions of the current context.
+     * @return 'true' if the renderer can be used, 'false' if the
+     * context does not support it (the caller should then draw
+     * without the renderer).
+     */
+    bool init( ProcAddressLoader loader );
+
+    /**
+     * @return 'true' if init() has succeeded.
+     */
+    bool isInitialized() const;
+
+    /**
+     * Releases all the OpenGL objects (the context must be current).
+     */
+    void clear();
+
+    /**
+     * Sets the level of detail policy.
+     * @param minPixels the minimal projected size (in pixels) of the
+     * drawn instances (0 disables the levels of detail).
+     * @param maxLevel the coarsest level of detail.
+     */
+    void setLevelOfDetail( double minPixels, unsigned int maxLevel = 4 );
+
+    /**
+     * @param culling when 'true' (default), chunks outside of the view
+     * frustum are not drawn.
+     */
+    void setFrustumCulling( bool culling );
+
+    // ----------------------- Rendering services -----------------------------
+  public:
+
+    /**
+     * Packs the lists of cubes and uploads the chunks that have
+     * changed.
+     * Does nothing if init() has not succeeded.
+     * @tparam TCube a type with fields center, width and color (CubeD3D).
+     * @param cubeSets the lists of cubes.
+     */
+    template <typename TCube>
+    void updateCubeSets( const std::vector< std::vector< TCube > > & cubeSets );
+
+    /**
+     * Packs the lists of quads and uploads the chunks that have
+     * changed.
+     * Does nothing if init() has not succeeded.
+     * @tparam TQuad a type with fields point1, ..., point4 and color (QuadD3D).
+     * @param quadSets the lists of quads.
+     */
+    template <typename TQuad>
+    void updateQuadSets( const std::vector< std::vector< TQuad > > & quadSets );
+
+    /**
+     * Draws the cubes and the quads with the current matrices.
+     */
+    void draw() const;
+
+    /**
+     * @return the number of instances drawn by the last draw().
+     */
+    Size nbDrawnInstances() const;
+
+    /**
+     * @return the number of chunks drawn by the last draw().
+     */
+    Size nbDrawnChunks() const;
+
+    /**
+     * @return the number of chunks culled by the last draw().
+     */
+    Size nbCulledChunks() const;
+
+    /**
+     * @return the number of chunks uploaded since the construction.
+     */
+    Size nbUploadedChunks() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * A list of primitives and its buffer object.
+     */
+    template <typename TInstance>
+    struct InstanceSet
+    {
+      InstanceSet( Size chunkSize ) : buffer( chunkSize ), name( 0 ), capacity( 0 ) {}
+      InstanceChunkBuffer< TInstance > buffer;
+      /// The buffer object.
+      GLuint name;
+      /// The number of instances the buffer object can hold.
+      Size capacity;
+    };
+
+    /**
+     * The view parameters used to cull chunks and choose their level
+     * of detail.
+     */
+    struct View
+    {
+      double planes[ 6 ][ 4 ];
+      double eye[ 3 ];
+      double pixelsPerUnit;
+    };
+
+    /**
+     * Packs \a primitiveSets into \a sets and uploads their dirty chunks.
+     */
+    template <typename TInstance, typename TPrimitive>
+    void updateSets( std::deque< InstanceSet< TInstance > > & sets,
+                     const std::vector< std::vector< TPrimitive > > & primitiveSets );
+
+    /**
+     * Draws the visible chunks of \a sets, with \a nbVertices
+     * vertices of \a mode per instance.
+     */
+    template <typename TInstance>
+    void drawSets( const std::deque< InstanceSet< TInstance > > & sets,
+                   const View & view, GLenum mode, GLsizei nbVertices,
+                   GLint scaleLocation ) const;
+
+    /**
+     * Enables (or disables) the instance attributes of cubes, at
+     * locations 2 and 3.
+     */
+    void enableInstanceAttributes( const CubeInstance3D*, bool enable ) const;
+
+    /**
+     * Enables (or disables) the instance attributes of quads, at
+     * locations 1 to 5.
+     */
+    void enableInstanceAttributes( const QuadInstance3D*, bool enable ) const;
+
+    /**
+     * Points the instance attributes of cubes to the instances
+     * starting at \a first in the bound buffer object.
+     */
+    void setInstanceAttributes( const CubeInstance3D*, Size first ) const;
+
+    /**
+     * Points the instance attributes of quads to the instances
+     * starting at \a first in the bound buffer object.
+     */
+    void setInstanceAttributes( const QuadInstance3D*, Size first ) const;
+
+    /**
+     * Computes the view parameters from the current matrices and viewport.
+     */
+    static void currentView( View & view );
+
+    /**
+     * @return a linked program from the given sources, 0 on failure.
+     */
+    GLuint createProgram( const char* vertexSource,
+                          const char* fragmentSource,
+                          const char* const* attributes,
+                          unsigned int nbAttributes ) const;
+
+    /**
+     * Sets \a function to the OpenGL function \a name given by \a loader.
+     * @return 'true' if the function is available.
+     */
+    template <typename TFunction>
+    static bool loadFunction( ProcAddressLoader loader, const char* name,
+                              TFunction & function );
+
+    /**
+     * Loads the OpenGL functions used by the renderer.
+     * @return 'true' if all of them are available.
+     */
+    bool loadFunctions( ProcAddressLoader loader );
+
+    /**
+     * The OpenGL functions which are not in OpenGL 1.1, loaded at run
+     * time by init().
+     */
+    struct Functions
+    {
+      void ( DGTAL_GLAPIENTRY * bindBuffer )( GLenum, GLuint );
+      void ( DGTAL_GLAPIENTRY * bufferData )( GLenum, std::ptrdiff_t, const GLvoid*, GLenum );
+      void ( DGTAL_GLAPIENTRY * bufferSubData )( GLenum, std::ptrdiff_t, std::ptrdiff_t, const GLvoid* );
+      void ( DGTAL_GLAPIENTRY * genBuffers )( GLsizei, GLuint* );
+      void ( DGTAL_GLAPIENTRY * deleteBuffers )( GLsizei, const GLuint* );
+      GLuint ( DGTAL_GLAPIENTRY * createProgram )();
+      GLuint ( DGTAL_GLAPIENTRY * createShader )( GLenum );
+      void ( DGTAL_GLAPIENTRY * shaderSource )( GLuint, GLsizei, const char* const*, const GLint* );
+      void ( DGTAL_GLAPIENTRY * compileShader )( GLuint );
+      void ( DGTAL_GLAPIENTRY * getShaderiv )( GLuint, GLenum, GLint* );
+      void ( DGTAL_GLAPIENTRY * getShaderInfoLog )( GLuint, GLsizei, GLsizei*, char* );
+      void ( DGTAL_GLAPIENTRY * attachShader )( GLuint, GLuint );
+      void ( DGTAL_GLAPIENTRY * deleteShader )( GLuint );
+      void ( DGTAL_GLAPIENTRY * bindAttribLocation )( GLuint, GLuint, const char* );
+      void ( DGTAL_GLAPIENTRY * linkProgram )( GLuint );
+      void ( DGTAL_GLAPIENTRY * getProgramiv )( GLuint, GLenum, GLint* );
+      void ( DGTAL_GLAPIENTRY * getProgramInfoLog )( GLuint, GLsizei, GLsizei*, char* );
+      void ( DGTAL_GLAPIENTRY * deleteProgram )( GLuint );
+      void ( DGTAL_GLAPIENTRY * useProgram )( GLuint );
+      GLint ( DGTAL_GLAPIENTRY * getUniformLocation )( GLuint, const char* );
+      void ( DGTAL_GLAPIENTRY * uniform1f )( GLint, GLfloat );
+      void ( DGTAL_GLAPIENTRY * enableVertexAttribArray )( GLuint );
+      void ( DGTAL_GLAPIENTRY * disableVertexAttribArray )( GLuint );
+      void ( DGTAL_GLAPIENTRY * vertexAttribPointer )( GLuint, GLint, GLenum, GLboolean, GLsizei, const GLvoid* );
+      void ( DGTAL_GLAPIENTRY * drawArraysInstanced )( GLenum, GLint, GLsizei, GLsizei );
+      void ( DGTAL_GLAPIENTRY * vertexAttribDivisor )( GLuint, GLuint );
+    };
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The OpenGL functions (valid when myIsInitialized is 'true').
+    Functions myGL;
+    /// The number of instances per chunk.
+    Size myChunkSize;
+    /// 'true' when the shaders and meshes are created.
+    bool myIsInitialized;
+    /// The programs drawing cubes and quads.
+    GLuint myCubeProgram;
+    GLuint myQuadProgram;
+    /// The locations of the LOD scale uniforms.
+    GLint myCubeScaleLocation;
+    GLint myQuadScaleLocation;
+    /// The unit cube mesh (36 vertices and normals).
+    GLuint myCubeMesh;
+    /// The quad mesh (4 corner weights).
+    GLuint myQuadMesh;
+    /// The lists of cubes (a deque, so that adding a list does not
+    /// copy the other ones).
+    std::deque< InstanceSet< CubeInstance3D > > myCubeSets;
+    /// The lists of quads.
+    std::deque< InstanceSet< QuadInstance3D > > myQuadSets;
+    /// The minimal projected size of an instance (0: no LOD).
+    double myLodPixels;
+    /// The coarsest level of detail.
+    unsigned int myMaxLodLevel;
+    /// 'true' if chunks are culled against the view frustum.
+    bool myFrustumCulling;
+    /// Statistics of the last draw and updates.
+    mutable Size myNbDrawnInstances;
+    mutable Size myNbDrawnChunks;
+    mutable Size myNbCulledChunks;
+    Size myNbUploadedChunks;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    GLInstancedRenderer3D( const GLInstancedRenderer3D & other );
+    GLInstancedRenderer3D & operator=( const GLInstancedRenderer3D & other );
+
+  }; // end of class GLInstancedRenderer3D
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'GLInstancedRenderer3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'GLInstancedRenderer3D' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const GLInstancedRenderer3D & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/viewers/GLInstancedRenderer3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined GLInstancedRenderer3D_h
+
+#undef GLInstancedRenderer3D_RECURSES
+#endif // else defined(GLInstancedRenderer3D_RECURSES)
@@ -0,0 +1,340 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file InstanceChunkBuffer.h
+ *
+ * Header file for module InstanceChunkBuffer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(InstanceChunkBuffer_RECURSES)
+#error Recursive header files inclusion detected in InstanceChunkBuffer.h
+#else // defined(InstanceChunkBuffer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define InstanceChunkBuffer_RECURSES
+
+#if !defined InstanceChunkBuffer_h
+/** Prevents repeated inclusion of headers. */
+#define InstanceChunkBuffer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * The packed representation of a cube (CubeD3D of Display3D) for
+   * instanced rendering: center, half width and RGBA color (20 bytes).
+   */
+  struct CubeInstance3D
+  {
+    float center[ 3 ];
+    float width;
+    unsigned char color[ 4 ];
+  };
+
+  /**
+   * The packed representation of a quad (QuadD3D of Display3D) for
+   * instanced rendering: four vertices and RGBA color (52 bytes).
+   */
+  struct QuadInstance3D
+  {
+    float points[ 4 ][ 3 ];
+    unsigned char color[ 4 ];
+  };
+
+  /**
+   * Description of template struct 'InstanceTraits' <p>
+   * \brief Aim: Packs a display primitive into an instance record and
+   * gives its extent. Specialized for CubeInstance3D and QuadInstance3D.
+   *
+   * @tparam TInstance the instance record type.
+   */
+  template <typename TInstance>
+  struct InstanceTraits;
+
+  /// Specialization of InstanceTraits for CubeInstance3D.
+  template <>
+  struct InstanceTraits< CubeInstance3D >
+  {
+    /// Dimension of the primitive (LOD thinning is 2^dimension per level).
+    static const unsigned int dimension = 3;
+
+    /**
+     * @param cube any object with fields center, width and color (e.g. CubeD3D).
+     * @param[out] instance the packed cube.
+     */
+    template <typename TCube>
+    static void pack( const TCube & cube, CubeInstance3D & instance );
+
+    /**
+     * Extends the box [lo,up] so that it contains \a instance.
+     * @return the size of the instance.
+     */
+    static float extend( const CubeInstance3D & instance,
+                         float lo[ 3 ], float up[ 3 ] );
+  };
+
+  /// Specialization of InstanceTraits for QuadInstance3D.
+  template <>
+  struct InstanceTraits< QuadInstance3D >
+  {
+    /// Dimension of the primitive (LOD thinning is 2^dimension per level).
+    static const unsigned int dimension = 2;
+
+    /**
+     * @param quad any object with fields point1, ..., point4 and color
+     * (e.g. QuadD3D).
+     * @param[out] instance the packed quad.
+     */
+    template <typename TQuad>
+    static void pack( const TQuad & quad, QuadInstance3D & instance );
+
+    /**
+     * Extends the box [lo,up] so that it contains \a instance.
+     * @return the size of the instance.
+     */
+    static float extend( const QuadInstance3D & instance,
+                         float lo[ 3 ], float up[ 3 ] );
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class InstanceChunkBuffer
+  /**
+   * Description of template class 'InstanceChunkBuffer' <p>
+   * \brief Aim: Packs a list of display primitives (cubes or quads of
+   * Display3D) into a flat array of instance records cut into chunks,
+   * for buffer based rendering (see GLInstancedRenderer3D). It does
+   * not depend on OpenGL.
+   *
+   * Each chunk of chunkSize() consecutive primitives has a bounding
+   * box, used to cull it against the view frustum (isVisible()), and
+   * the size of its largest primitive, used to choose a level of
+   * detail (lodLevel()). Inside a chunk, primitives are stored in bit
+   * reversed order, so that any prefix of the chunk is spread over the
+   * whole chunk: the level of detail \a l draws only the first
+   * lodCount() primitives of a chunk, enlarged by 2^l.
+   *
+   * update() repacks a list of primitives and compares each chunk
+   * with its previous content: only the chunks that have changed are
+   * marked dirty, so that a renderer uploads again only those ones
+   * (e.g. when primitives are appended to a list, only the last chunks
+   * change).
+   *
+   * @tparam TInstance the instance record, CubeInstance3D or QuadInstance3D.
+   */
+  template <typename TInstance>
+  class InstanceChunkBuffer
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TInstance Instance;
+    typedef InstanceTraits< Instance > Traits;
+    typedef std::size_t Size;
+
+    /**
+     * A chunk of consecutive instances.
+     */
+    struct Chunk
+    {
+      /// Index of the first instance of the chunk.
+      Size first;
+      /// Number of instances of the chunk.
+      Size count;
+      /// Lower corner of the bounding box of the chunk.
+      float lo[ 3 ];
+      /// Upper corner of the bounding box of the chunk.
+      float up[ 3 ];
+      /// Size of the largest instance of the chunk.
+      float size;
+      /// 'true' if the chunk has changed since the last clearDirty().
+      bool dirty;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param chunkSize the number of instances per chunk (at least 1).
+     */
+    InstanceChunkBuffer( Size chunkSize = 32768 );
+
+    /**
+     * Packs the primitives of [itb,ite) and marks dirty the chunks
+     * whose content has changed.
+     *
+     * @tparam TIterator a random access iterator on primitives.
+     * @param itb the first primitive.
+     * @param ite past the last primitive.
+     * @return the number of dirty chunks.
+     */
+    template <typename TIterator>
+    Size update( TIterator itb, TIterator ite );
+
+    /**
+     * Removes all the instances.
+     */
+    void clear();
+
+    /**
+     * Marks all the chunks as uploaded.
+     */
+    void clearDirty();
+
+    /**
+     * Marks all the chunks as dirty.
+     */
+    void setDirty();
+
+    /**
+     * @return the number of instances per chunk.
+     */
+    Size chunkSize() const;
+
+    /**
+     * @return the number of instances.
+     */
+    Size size() const;
+
+    /**
+     * @return the packed instances (size() values), chunk after chunk.
+     */
+    const Instance* data() const;
+
+    /**
+     * @return the chunks.
+     */
+    const std::vector< Chunk > & chunks() const;
+
+    /**
+     * @return the number of dirty chunks.
+     */
+    Size nbDirtyChunks() const;
+
+    // ----------------------- Culling services -------------------------------
+  public:
+
+    /**
+     * @param chunk any chunk.
+     * @param planes the six planes (a,b,c,d) of the view frustum, the
+     * inside of each plane being a x + b y + c z + d >= 0.
+     * @return 'false' if the bounding box of \a chunk is outside the
+     * frustum, 'true' if it may be visible.
+     */
+    static bool isVisible( const Chunk & chunk, const double planes[ 6 ][ 4 ] );
+
+    /**
+     * Chooses the level of detail of a chunk: the smallest level \a l
+     * such that the instances of the chunk, enlarged by 2^l, are
+     * projected on at least \a minPixels pixels.
+     *
+     * @param chunk any chunk.
+     * @param eye the position of the camera.
+     * @param pixelsPerUnit the number of pixels covered by a unit
+     * length at unit distance of the camera.
+     * @param minPixels the minimal projected size of an instance.
+     * @param maxLevel the maximal level.
+     * @return the level of detail, between 0 and maxLevel.
+     */
+    static unsigned int lodLevel( const Chunk & chunk, const double eye[ 3 ],
+                                  double pixelsPerUnit, double minPixels,
+                                  unsigned int maxLevel );
+
+    /**
+     * @param count the number of instances of a chunk.
+     * @param level a level of detail.
+     * @return the number of instances drawn at this level, that is
+     * count / 2^(dimension * level) rounded up.
+     */
+    static Size lodCount( Size count, unsigned int level );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The number of instances per chunk.
+    Size myChunkSize;
+    /// The packed instances.
+    std::vector< Instance > myInstances;
+    /// The chunks.
+    std::vector< Chunk > myChunks;
+    /// The storage order of a full chunk.
+    std::vector< Size > myOrder;
+    /// The packed instances of the chunk being updated.
+    std::vector< Instance > myScratch;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the bit reversed order of [0,n).
+     * @param n any number.
+     * @param[out] order the indices of [0,n) in bit reversed order.
+     */
+    static void bitReversedOrder( Size n, std::vector< Size > & order );
+
+  }; // end of class InstanceChunkBuffer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'InstanceChunkBuffer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'InstanceChunkBuffer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInstance>
+  std::ostream&
+  operator<< ( std::ostream & out, const InstanceChunkBuffer<TInstance> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/viewers/InstanceChunkBuffer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined InstanceChunkBuffer_h
+
+#undef InstanceChunkBuffer_RECURSES
+#endif // else defined(InstanceChunkBuffer_RECURSES)
@@ -61,6 +61,8 @@
 #include "DGtal/topology/KhalimskySpaceND.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/io/Display3D.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/io/viewers/GLInstancedRenderer3D.h"
 #include "DGtal/math/BasicMathFunctions.h"
 
 #include "DGtal/kernel/CSpace.h"
@@ -130,14 +132,16 @@ namespace DGtal
     /**
      * Constructor
      */
-    Viewer3D() :QGLViewer(), Display3D<Space, KSpace>()
+    Viewer3D() :QGLViewer(), Display3D<Space, KSpace>(),
+      myUseInstancedRendering(false)
     {};
 
     /**
      *Constructor with a khalimsky space
      * @param KSEmb the Khalimsky space
      */
-    Viewer3D(const KSpace &KSEmb):QGLViewer(), Display3D<Space,KSpace>(KSEmb)
+    Viewer3D(const KSpace &KSEmb):QGLViewer(), Display3D<Space,KSpace>(KSEmb),
+      myUseInstancedRendering(false)
     {};
 
     /**
@@ -145,7 +149,8 @@ namespace DGtal
      *@param SEmb a space
      *@param KSEmb a khalimsky space
      **/
-    Viewer3D(const Space &SEmb, const KSpace &KSEmb) : QGLViewer(), Display3D<Space,KSpace>(SEmb, KSEmb)
+    Viewer3D(const Space &SEmb, const KSpace &KSEmb) : QGLViewer(), Display3D<Space,KSpace>(SEmb, KSEmb),
+      myUseInstancedRendering(false)
     {};
 
 
@@ -209,6 +214,25 @@ namespace DGtal
       myGLScaleFactorZ=sz;
     }
 
+    /**
+     * Draws the cubes and the quad faces with vertex buffers and
+     * instancing (see GLInstancedRenderer3D) instead of display lists:
+     * faster for large sets, with view frustum culling and levels of
+     * detail, but without back to front sorting nor selection of these
+     * primitives. It falls back to display lists when the OpenGL
+     * context does not support instancing. Takes effect at the next
+     * updateList().
+     *
+     * @param instanced when 'true', uses the instanced rendering.
+     * @param lodPixels the minimal projected size (in pixels) of a
+     * cube or a quad (0 disables the levels of detail).
+     **/
+    void setInstancedRendering(bool instanced, double lodPixels = 1.0)
+    {
+      myUseInstancedRendering=instanced;
+      myInstancedRenderer.setLevelOfDetail(lodPixels);
+    }
+
 
     /// the 3 possible axes for the image direction
     enum ImageDirection {xDirection, yDirection, zDirection, undefDirection };
@@ -455,12 +479,17 @@ namespace DGtal
         point3[0] += xTranslation; point3[1] += yTranslation; point3[2] += zTranslation;
         point4[0] += xTranslation; point4[1] += yTranslation; point4[2] += zTranslation;
 
-        unsigned int pos=0;
-        for(typename TImageType::Domain::ConstIterator it = image.domain().begin(), itend=image.domain().end();
-            it!=itend; ++it)
+        // Row by row: the values are read with rowFromImage (bulk
+        // copies for ImageContainerBySTLVector) and then transformed.
+        typedef typename TImageType::Point Point;
+        const Point lower = image.domain().lowerBound();
+        std::vector<typename TImageType::Value> row( myImageWidth );
+        for (unsigned int i=0; i<myImageHeight; i++)
           {
-            myTabImage[pos]= aFunctor(image(*it));
-            pos++;
+            Point p = lower;
+            p[1] += static_cast<typename Point::Component>( i );
+            rowFromImage( image, p, 0, myImageWidth, row.begin() );
+            std::transform( row.begin(), row.end(), myTabImage + i*myImageWidth, aFunctor );
           }
       }
 
@@ -867,6 +896,12 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * @return the address of the OpenGL function \a name in the
+     * current context, 0 if it is not available (used by
+     * myInstancedRenderer).
+     */
+    static void* glProcAddress( const char* name );
 
     /**
      * Used to display in OPENGL an image as a textured quad image.
@@ -999,23 +1034,18 @@ namespace DGtal
           }else if(myMode==Viewer3D<Space, KSpace>::RGBMode)
           {
             myTextureImageBufferRGB = new unsigned char [3*myBufferHeight*myBufferWidth];
-            unsigned int pos=0;
-            for (unsigned int i=0; i<myBufferHeight; i++)
+            std::fill( myTextureImageBufferRGB,
+                       myTextureImageBufferRGB + 3*myBufferHeight*myBufferWidth, 0 );
+            // Unpacks the 0x00RRGGBB values (see Color::getRGB) row by row.
+            for (unsigned int i=0; i<myImageHeight; i++)
               {
-                for (unsigned int j=0; j<myBufferWidth; j++)
+                const unsigned int * src = aGSImage.myTabImage + i*myImageWidth;
+                unsigned char * dst = myTextureImageBufferRGB + 3*i*myBufferWidth;
+                for (unsigned int j=0; j<myImageWidth; j++, dst+=3)
                   {
-                    if(i<myImageHeight && j< myImageWidth)
-                      {
-                        DGtal::Color aCol(aGSImage.myTabImage[i*myImageWidth+j]);
-                        myTextureImageBufferRGB[pos]= aCol.red();
-                        myTextureImageBufferRGB[pos+1]= aCol.green();
-                        myTextureImageBufferRGB[pos+2]= aCol.blue();
-                      }else{
-                      myTextureImageBufferRGB[pos]=0;
-                      myTextureImageBufferRGB[pos+1]=0;
-                      myTextureImageBufferRGB[pos+2]=0;
-                    }
-                    pos+=3;
+                    dst[0] = static_cast<unsigned char>( src[j] >> 16 );
+                    dst[1] = static_cast<unsigned char>( src[j] >> 8 );
+                    dst[2] = static_cast<unsigned char>( src[j] );
                   }
               }
           }
@@ -1081,6 +1111,10 @@ namespace DGtal
     GLuint myListToAff;
     /// number of lists in myListToAff
     unsigned int myNbListe;
+    /// true if cubes and quad faces are drawn by myInstancedRenderer
+    bool myUseInstancedRendering;
+    /// the buffer based renderer of cubes and quad faces
+    GLInstancedRenderer3D myInstancedRenderer;
     /// information linked to the navigation in the viewer
     qglviewer::Vec myOrig, myDir, myDirSelector, mySelectedPoint;
     /// a point selected with postSelection @see postSelection
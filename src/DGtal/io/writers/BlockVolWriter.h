@@ -0,0 +1,116 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BlockVolWriter.h
+ *
+ * Header file for module BlockVolWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BlockVolWriter_RECURSES)
+#error Recursive header files inclusion detected in BlockVolWriter.h
+#else // defined(BlockVolWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BlockVolWriter_RECURSES
+
+#if !defined BlockVolWriter_h
+/** Prevents repeated inclusion of headers. */
+#define BlockVolWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/io/BlockVolume.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4290)
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BlockVolWriter
+  /**
+   * Description of template struct 'BlockVolWriter' <p>
+   * \brief Aim: Export an Image of any dimension in the block
+   * compressed volume format ("bvol", see BlockVolume).
+   *
+   * A functor can be specified to convert image values to file values
+   * (DGtal::uint64_t), which are stored with a given number of bytes.
+   * Label images (few distinct values, large regions) are typically
+   * 10 to 50 times smaller than the vol, longvol or raw files.
+   *
+   * @code
+   * BlockVolWriter<Image>::exportBlockVol( "labels.bvol", image, 64, 2 );
+   * @endcode
+   *
+   * @tparam TImage the Image type.
+   * @tparam TFunctor the type of functor used in the export (by
+   * default set to CastFunctor< DGtal::uint64_t >).
+   *
+   * @see testBlockVol.cpp
+   */
+  template <typename TImage, typename TFunctor = CastFunctor<DGtal::uint64_t> >
+  struct BlockVolWriter
+  {
+    // ----------------------- Standard services ------------------------------
+    typedef TImage Image;
+    typedef typename TImage::Value Value;
+    typedef TFunctor Functor;
+
+    BOOST_CONCEPT_ASSERT(( CUnaryFunctor<TFunctor, Value, DGtal::uint64_t> ));
+
+    /**
+     * Export an Image with the bvol format. The image domain is
+     * translated to start at the origin.
+     *
+     * @param aFilename name of the output file.
+     * @param anImage the image to export.
+     * @param aBrickSize the side of the bricks.
+     * @param aValueSize the number of bytes of the file values (1 to
+     * 8), by default the size of the image values.
+     * @param aFunctor functor used to cast image values.
+     * @return true if no errors occur.
+     */
+    static bool exportBlockVol( const std::string & aFilename, const Image & anImage,
+                                const unsigned int aBrickSize = 64,
+                                const unsigned int aValueSize = sizeof( Value ),
+                                const Functor & aFunctor = Functor() )
+      throw( DGtal::IOException );
+  };
+}//namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/BlockVolWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BlockVolWriter_h
+
+#undef BlockVolWriter_RECURSES
+#endif // else defined(BlockVolWriter_RECURSES)
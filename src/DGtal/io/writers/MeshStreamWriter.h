@@ -0,0 +1,300 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MeshStreamWriter.h
+ *
+ * Header file for module MeshStreamWriter.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MeshStreamWriter_RECURSES)
+#error Recursive header files inclusion detected in MeshStreamWriter.h
+#else // defined(MeshStreamWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MeshStreamWriter_RECURSES
+
+#if !defined MeshStreamWriter_h
+/** Prevents repeated inclusion of headers. */
+#define MeshStreamWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/Color.h"
+#include "DGtal/io/writers/MeshWriter.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4290)
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MeshStreamWriter
+  /**
+   * Description of template class 'MeshStreamWriter' <p>
+   * \brief Aim: Writes a surface mesh in a PLY (binary or ascii) or
+   * OFF file while its vertices and faces are produced, without
+   * storing them in a Mesh object.
+   *
+   * The vertices are written in the file as soon as they are added,
+   * the faces in a temporary file (the file name followed by
+   * ".faces.tmp"), appended to the file by close(). The numbers of
+   * vertices and faces, unknown when the header is written, are
+   * written in fixed width fields of the header, updated by close().
+   * In binary format, both files are written by chunks.
+   *
+   * Example of typical use:
+   * @code
+   * MeshStreamWriter<Z3i::RealPoint> writer( "surface.ply" );
+   * CanonicCellEmbedder<KSpace> embedder( K );
+   * writer.addDigitalSurface( digSurf, embedder );
+   * writer.close();
+   * @endcode
+   *
+   * @tparam TPoint the type of the mesh vertices.
+   *
+   * @see MeshWriter testMeshStreamWriter.cpp
+   */
+  template <typename TPoint>
+  class MeshStreamWriter
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// The output formats.
+    enum Format { PLY_BINARY, PLY_ASCII, OFF };
+
+    /**
+     * Constructor: no file is opened.
+     */
+    MeshStreamWriter();
+
+    /**
+     * Constructor: opens a file (see open).
+     *
+     * @param aFilename the file name.
+     * @param aFormat the output format (default PLY_BINARY).
+     * @param exportColor true to export face colors (default false).
+     */
+    MeshStreamWriter( const std::string & aFilename, Format aFormat = PLY_BINARY,
+                      bool exportColor = false ) throw( DGtal::IOException );
+
+    /**
+     * Destructor: closes the file.
+     */
+    ~MeshStreamWriter();
+
+    /**
+     * Opens a file and writes its header.
+     *
+     * @param aFilename the file name.
+     * @param aFormat the output format (default PLY_BINARY).
+     * @param exportColor true to export face colors (default false).
+     */
+    void open( const std::string & aFilename, Format aFormat = PLY_BINARY,
+               bool exportColor = false ) throw( DGtal::IOException );
+
+    /**
+     * Appends the faces to the file, updates the header and closes
+     * the file (nothing is done if no file is opened).
+     */
+    void close() throw( DGtal::IOException );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes a vertex.
+     *
+     * @param aVertex the vertex.
+     * @return the index of the vertex.
+     */
+    unsigned int addVertex( const TPoint & aVertex );
+
+    /**
+     * Writes a face given from an array of vertex indices.
+     *
+     * @param indices the indices of the face vertices.
+     * @param nbIndices the number of vertices of the face (at most
+     * 255 in PLY format).
+     * @param aColor the color of the face.
+     */
+    void addFace( const unsigned int * indices, unsigned int nbIndices,
+                  const DGtal::Color & aColor = DGtal::Color::White )
+      throw( DGtal::IOException );
+
+    /**
+     * Writes a face given from a vector of vertex indices.
+     *
+     * @param aFace the indices of the face vertices.
+     * @param aColor the color of the face.
+     */
+    void addFace( const std::vector<unsigned int> & aFace,
+                  const DGtal::Color & aColor = DGtal::Color::White )
+      throw( DGtal::IOException );
+
+    /**
+     * Writes a triangle face given from index position.
+     */
+    void addTriangularFace( unsigned int indexVertex1, unsigned int indexVertex2,
+                            unsigned int indexVertex3,
+                            const DGtal::Color & aColor = DGtal::Color::White )
+      throw( DGtal::IOException );
+
+    /**
+     * Writes a quad face given from index position.
+     */
+    void addQuadFace( unsigned int indexVertex1, unsigned int indexVertex2,
+                      unsigned int indexVertex3, unsigned int indexVertex4,
+                      const DGtal::Color & aColor = DGtal::Color::White )
+      throw( DGtal::IOException );
+
+    /**
+     * Writes the surfels of a 3D digital surface as quads, whose
+     * vertices are its pointels (each pointel is written once). The
+     * quads are oriented so that their normal points outside the
+     * surface (i.e. away from the direct incident spel of each
+     * surfel).
+     *
+     * The faces are streamed, but the vertex index of each pointel
+     * already written is kept in a hash table of Khalimsky
+     * coordinates: one slot (a Point and an unsigned int, 16 bytes
+     * in Z3i) for 0.375 to 0.75 pointel, i.e. 21 to 43 bytes per
+     * vertex, plus a transient copy while the table doubles. This is
+     * about 1.5 GB for a surface of 50 million surfels.
+     *
+     * @param aSurface any DigitalSurface (or any model of
+     * CDigitalSurfaceContainer) of dimension 3.
+     * @param anEmbedder any embedder of unsigned cells (e.g.
+     * CanonicCellEmbedder), whose values are convertible to TPoint.
+     *
+     * @tparam TSurface the type of digital surface.
+     * @tparam TCellEmbedder the type of cell embedder.
+     */
+    template <typename TSurface, typename TCellEmbedder>
+    void addDigitalSurface( const TSurface & aSurface, const TCellEmbedder & anEmbedder )
+      throw( DGtal::IOException );
+
+    /**
+     * @return the number of vertices written.
+     */
+    unsigned int nbVertex() const;
+
+    /**
+     * @return the number of faces written.
+     */
+    unsigned int nbFaces() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if a file is opened.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The output file.
+    std::ofstream myOut;
+    /// The temporary file of the faces.
+    std::ofstream myFaceOut;
+    /// The file name.
+    std::string myFilename;
+    /// The output format.
+    Format myFormat;
+    /// true if the face colors are written.
+    bool myExportColor;
+    /// Number of vertices written.
+    unsigned int myNbVertices;
+    /// Number of faces written.
+    unsigned int myNbFaces;
+    /// Positions of the numbers of vertices and faces in the header.
+    std::streampos myVertexCountPosition;
+    std::streampos myFaceCountPosition;
+    /// Buffer of the vertices (binary format).
+    std::vector<char> myVertexBuffer;
+    /// Buffer of the faces (binary format).
+    std::vector<char> myFaceBuffer;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    MeshStreamWriter( const MeshStreamWriter & other );
+    MeshStreamWriter & operator=( const MeshStreamWriter & other );
+
+    /**
+     * @return the name of the temporary file of the faces.
+     */
+    std::string faceFilename() const;
+
+    /**
+     * Writes a buffer in a stream when it is larger than a chunk (or
+     * always if force is 'true').
+     */
+    static void flushBuffer( std::ofstream & out, std::vector<char> & aBuffer,
+                             bool force = false );
+
+    /**
+     * @param aPoint the Khalimsky coordinates of a pointel.
+     * @return a hash value of the coordinates.
+     */
+    template <typename TKPoint>
+    static DGtal::uint64_t pointelHash( const TKPoint & aPoint );
+
+  }; // end of class MeshStreamWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MeshStreamWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MeshStreamWriter' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint>
+  std::ostream&
+  operator<< ( std::ostream & out, const MeshStreamWriter<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/MeshStreamWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MeshStreamWriter_h
+
+#undef MeshStreamWriter_RECURSES
+#endif // else defined(MeshStreamWriter_RECURSES)
@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include <string>
+#include <vector>
 #include <boost/static_assert.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/shapes/Mesh.h"
@@ -50,11 +51,34 @@
 namespace DGtal
 {
 
+  namespace details
+  {
+    /**
+     * Appends the aNbBytes least significant bytes of an unsigned
+     * integer to a buffer, in little-endian order (binary PLY).
+     *
+     * @param aBuffer the buffer.
+     * @param aValue the value.
+     * @param aNbBytes the number of bytes (1 to 8).
+     */
+    void appendLittleEndian( std::vector<char> & aBuffer, 
+                             DGtal::uint64_t aValue, unsigned int aNbBytes );
+
+    /**
+     * Appends the 8 bytes of an IEEE 754 double to a buffer, in
+     * little-endian order (binary PLY).
+     *
+     * @param aBuffer the buffer.
+     * @param aValue the value.
+     */
+    void appendLittleEndian( std::vector<char> & aBuffer, double aValue );
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // template class MeshWriter
   /**
    * Description of template struct 'MeshWriter' <p>
-   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF and OBJ).
+   * \brief Aim: Export a Mesh (Mesh object) in different format as OFF, OBJ and PLY).
    * 
    * The exportation can be done automatically according the input file
    * extension with the ">>" operator  
@@ -68,7 +92,13 @@ namespace DGtal
    * @snippet tests/io/readers/testMeshWriter.cpp MeshWriterUseMeshExport
    *
    *
-   * @see Mesh MeshWriter
+   * The PLY export writes the binary little-endian format by
+   * default, which is much faster to write and read than the text
+   * formats for large meshes. To export a mesh which is too large to
+   * be stored in memory (e.g. from a DigitalSurface), see
+   * MeshStreamWriter.
+   *
+   * @see Mesh MeshReader MeshStreamWriter
    *
    *
    */
@@ -104,6 +134,24 @@ namespace DGtal
      */
     
     static bool export2OBJ(std::ostream &out, const  Mesh<TPoint>  &aMesh) throw(DGtal::IOException);
+
+
+    /** 
+     * Export a Mesh towards a PLY format: the vertices are written as
+     * double coordinates, the faces as lists of int indices (at most
+     * 255 vertices per face) with optional uchar RGBA colors.
+     * 
+     * @param out the output stream of the exported PLY object (should
+     * be opened in binary mode for the binary format).
+     * @param aMesh the Mesh object to be exported.
+     * @param binary true to export in the binary little-endian
+     * format, false for the ascii format (default true).
+     * @param exportColor true to export colors (default false). 
+     * @return true if no errors occur.
+     */
+    
+    static bool export2PLY(std::ostream &out, const  Mesh<TPoint>  &aMesh,
+                           bool binary=true, bool exportColor=false) throw(DGtal::IOException);
        
     
   };
@@ -115,7 +163,7 @@ namespace DGtal
   /**
    *  'operator>>' for exporting objects of class 'Mesh'.
    *  This operator automatically selects the good method according to
-   *  the filename extension (off, obj).
+   *  the filename extension (off, obj, ply).
    *  
    * @param aMesh the mesh to be exported.
    * @param aFilename the filename of the file to be exported. 
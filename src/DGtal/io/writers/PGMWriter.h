@@ -63,6 +63,9 @@ namespace DGtal
    * A functor can be specified to convert image values to PGM values
    * (unsigned char).
    *
+   * The image is read row by row (see rowFromImage) and the values
+   * are written through a buffer (see NetPBMOutputStream).
+   *
    * Usage example:
    * @code
    * ...
@@ -57,12 +57,18 @@ namespace DGtal
   // template class PPMWriter
   /**
    * Description of template struct 'PPMWriter' <p>
-   * \brief Aim: Export a 2D and a 3D Image using the Netpbm PPM formats (ASCII mode).
+   * \brief Aim: Export a 2D and a 3D Image using the Netpbm PPM formats (ASCII
+   * P3, or binary P6 for 2D images).
    *  - PPM: grayscale
    *  - PPM3D: 3D variant of PPM
    *
    * A functor can be specified to convert image values to DGtal::Color values.
    *
+   * The image is read row by row (see rowFromImage), the colors of a
+   * row are computed at once (see colorizeRGB, which uses the table of
+   * a TabulatedColorMap functor) and written through a buffer (see
+   * NetPBMOutputStream).
+   *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
    *
@@ -86,11 +92,14 @@ namespace DGtal
      * @param aImage the image to export
      * @param aFunctor  functor used to cast image values
      * @param topbottomOrder true if top to bottom order is prefered (default: true)
+     * @param saveASCII true to save the colors in ASCII (P3, default),
+     * false to save them in binary (P6).
      *
      * @return true if no errors occur.
      */
     static bool exportPPM(const std::string & filename, const Image &aImage, 
-			  const Functor & aFunctor = Functor(), bool topbottomOrder=true);
+			  const Functor & aFunctor = Functor(), bool topbottomOrder=true,
+			  bool saveASCII=true);
   
 
     /** 
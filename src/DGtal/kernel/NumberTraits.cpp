@@ -68,6 +68,13 @@ namespace DGtal
   const long double NumberTraits<long double>::ONE = 1.0;
   const long double NumberTraits<long double>::ZERO = 0.0;
 
+#ifdef WITH_INT128
+  const int128_t NumberTraits<int128_t>::ONE = 1;
+  const int128_t NumberTraits<int128_t>::ZERO = 0;
+  const uint128_t NumberTraits<uint128_t>::ONE = 1;
+  const uint128_t NumberTraits<uint128_t>::ZERO = 0;
+#endif
+
 #ifdef WITH_BIGINTEGER
   const DGtal::BigInteger NumberTraits<DGtal::BigInteger>::ONE = 1;
   const DGtal::BigInteger NumberTraits<DGtal::BigInteger>::ZERO = 0;
@@ -769,6 +769,154 @@ namespace DGtal
     }
   }; // end of class NumberTraits<int64_t>.
 
+#ifdef WITH_INT128
+  /**
+   * Specialization for <uint128_t>, when the compiler supports native
+   * 128-bit integers (see WITH_INT128).
+   */
+  template <>
+  struct NumberTraits<uint128_t>
+  {
+    typedef TagTrue IsIntegral;
+    typedef TagTrue IsBounded;
+    typedef TagTrue IsUnsigned;
+    typedef TagFalse IsSigned;
+    typedef TagTrue IsSpecialized;
+    typedef int128_t SignedVersion;
+    typedef uint128_t UnsignedVersion;
+    typedef uint128_t ReturnType;
+    typedef uint128_t ParamType;
+    static const uint128_t ZERO; // = 0;
+    static const uint128_t ONE; // = 1;
+    static ReturnType zero()
+    {
+      return 0;
+    }
+    static ReturnType one()
+    {
+      return 1;
+    }
+    static ReturnType min()
+    {
+      return 0;
+    }
+    static ReturnType max()
+    {
+      return ~ (uint128_t) 0;
+    }
+    static unsigned int digits()
+    {
+      return 128;
+    }
+    static BoundEnum isBounded()
+    {
+      return BOUNDED;
+    }
+    static SignEnum isSigned()
+    {
+      return UNSIGNED;
+    }
+    static DGtal::int64_t castToInt64_t(const uint128_t & aT)
+    {
+      return static_cast<DGtal::int64_t>(aT);
+    }
+    static double castToDouble(const uint128_t & aT)
+    {
+      return static_cast<double>(aT);
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is even.
+    */
+    static bool even( ParamType aT )
+    {
+      return ( aT & 1 ) == 0;
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is odd.
+    */
+    static bool odd( ParamType aT )
+    {
+      return ( aT & 1 ) != 0;
+    }
+  }; // end of class NumberTraits<uint128_t>.
+#endif
+
+#ifdef WITH_INT128
+  /**
+   * Specialization for <int128_t>, when the compiler supports native
+   * 128-bit integers (see WITH_INT128).
+   */
+  template <>
+  struct NumberTraits<int128_t>
+  {
+    typedef TagTrue IsIntegral;
+    typedef TagTrue IsBounded;
+    typedef TagFalse IsUnsigned;
+    typedef TagTrue IsSigned;
+    typedef TagTrue IsSpecialized;
+    typedef int128_t SignedVersion;
+    typedef uint128_t UnsignedVersion;
+    typedef int128_t ReturnType;
+    typedef int128_t ParamType;
+    static const int128_t ZERO; // = 0;
+    static const int128_t ONE; // = 1;
+    static ReturnType zero()
+    {
+      return 0;
+    }
+    static ReturnType one()
+    {
+      return 1;
+    }
+    static ReturnType min()
+    {
+      return - max() - 1;
+    }
+    static ReturnType max()
+    {
+      return (int128_t) ( ( (uint128_t) 1 << 127 ) - 1 );
+    }
+    static unsigned int digits()
+    {
+      return 127;
+    }
+    static BoundEnum isBounded()
+    {
+      return BOUNDED;
+    }
+    static SignEnum isSigned()
+    {
+      return SIGNED;
+    }
+    static DGtal::int64_t castToInt64_t(const int128_t & aT)
+    {
+      return static_cast<DGtal::int64_t>(aT);
+    }
+    static double castToDouble(const int128_t & aT)
+    {
+      return static_cast<double>(aT);
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is even.
+    */
+    static bool even( ParamType aT )
+    {
+      return ( aT & 1 ) == 0;
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is odd.
+    */
+    static bool odd( ParamType aT )
+    {
+      return ( aT & 1 ) != 0;
+    }
+  }; // end of class NumberTraits<int128_t>.
+#endif
+
   /**
    * Specialization for <float>.
    */
@@ -1033,6 +1181,14 @@ namespace DGtal
     typedef int64_t promote_t;
   };
 
+#ifdef WITH_INT128
+  template<>
+  struct promote_trait<int64_t, int128_t>
+  {
+    typedef int128_t promote_t;
+  };
+#endif
+
 } // namespace DGtal
 
 
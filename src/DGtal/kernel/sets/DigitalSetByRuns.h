@@ -0,0 +1,587 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRuns.h
+ *
+ * Header file for module DigitalSetByRuns.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByRuns_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRuns.h
+#else // defined(DigitalSetByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRuns_RECURSES
+
+#if !defined DigitalSetByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include "boost/iterator/iterator_facade.hpp"
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/domains/CDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRuns
+  /**
+    Description of template class 'DigitalSetByRuns' <p>
+
+    \brief Aim: A container class for storing sets of digital points
+    within some given domain as runs, i.e. maximal intervals of
+    consecutive points along the first axis.
+
+    The domain is seen as a set of rows (lines parallel to the first
+    axis), numbered in the order of the domain iterator. The set is
+    stored as a sorted vector of runs (row index, first abscissa, last
+    abscissa), which is very compact for sets made of large
+    connected regions (e.g. segmentation masks): the memory is
+    proportional to the number of runs, not to the number of points
+    nor to the size of the domain.
+
+    - membership (find, operator()) is a binary search, in O(log r)
+    where r is the number of runs;
+    - points are visited in the order of the domain iterator;
+    - union (operator+=), intersection (operator*=), difference
+    (operator-=) and complement (assignFromComplement) are computed
+    by merging runs, in O(r) (plus the number of rows of the domain
+    for the complement);
+    - inserting or erasing a single point is in O(log r) when it
+    extends or shrinks an existing run, and in O(r) in the worst case
+    (it is constant time when points are inserted in the domain
+    order). Ranges of points are inserted or erased as a whole, by
+    merging.
+
+    Iterators are invalidated by any modification of the set, as for
+    DigitalSetBySTLVector. The rows of the set are accessed with
+    runBegin(), runEnd() and rowRuns(), and rowIndex() / rowPoint()
+    convert points to row indices. Surfaces::sMakeBoundaryFromRuns
+    uses them to extract the boundary of the set run by run.
+
+    Model of CDigitalSet.
+
+    @tparam TDomain the type of domain, an HyperRectDomain.
+
+    @see ImageContainerByRuns
+   */
+  template <typename TDomain>
+  class DigitalSetByRuns
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByRuns<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+
+    ///Concept checks
+    BOOST_CONCEPT_ASSERT(( CDomain< TDomain > ));
+
+    /**
+     * A run: the points of the row @a row whose first coordinate
+     * lies in [first,last].
+     */
+    struct Run
+    {
+      /// Index of the row in the domain.
+      Size row;
+      /// First coordinate of the first point of the run.
+      Integer first;
+      /// First coordinate of the last point of the run.
+      Integer last;
+
+      Run() {}
+      Run( const Size aRow, const Integer aFirst, const Integer aLast )
+        : row( aRow ), first( aFirst ), last( aLast ) {}
+
+      /// Runs are ordered by row, then by first coordinate.
+      bool operator<( const Run & other ) const
+      {
+        return ( row < other.row ) || ( ( row == other.row ) && ( first < other.first ) );
+      }
+      bool operator==( const Run & other ) const
+      {
+        return ( row == other.row ) && ( first == other.first ) && ( last == other.last );
+      }
+    };
+
+    typedef std::vector<Run> Runs;
+    typedef typename Runs::const_iterator RunConstIterator;
+
+    /**
+     * Bidirectional iterator on the points of the set, in the order of
+     * the domain iterator. It is a readable iterator whose reference
+     * type is Point (points are built on the fly).
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::bidirectional_traversal_tag, Point >
+    {
+    public:
+      ConstIterator() : mySet( 0 ), myX( 0 ) {}
+      ConstIterator( const Self & aSet, RunConstIterator aRun, const Integer aX )
+        : mySet( &aSet ), myRun( aRun ), myX( aX ) {}
+
+      /// @return the run containing the current point.
+      RunConstIterator run() const { return myRun; }
+
+    private:
+      friend class boost::iterator_core_access;
+      friend class DigitalSetByRuns<TDomain>;
+
+      Point dereference() const
+      {
+        Point p = mySet->rowPoint( myRun->row );
+        p[ 0 ] = myX;
+        return p;
+      }
+      bool equal( const ConstIterator & other ) const
+      {
+        return ( myRun == other.myRun ) && ( myX == other.myX );
+      }
+      void increment()
+      {
+        if ( myX < myRun->last ) ++myX;
+        else
+          {
+            ++myRun;
+            myX = ( myRun != mySet->myRuns.end() ) ? myRun->first : 0;
+          }
+      }
+      void decrement()
+      {
+        if ( ( myRun != mySet->myRuns.end() ) && ( myX > myRun->first ) ) --myX;
+        else
+          {
+            --myRun;
+            myX = myRun->last;
+          }
+      }
+
+      /// The set.
+      const Self * mySet;
+      /// The current run.
+      RunConstIterator myRun;
+      /// The first coordinate of the current point (0 at the end).
+      Integer myX;
+    };
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRuns();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRuns( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRuns ( const DigitalSetByRuns & other );
+
+    /**
+     * Assignment. Since runs are indexed by rows of the domain, the
+     * domain of @a other is copied as well.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator= ( const DigitalSetByRuns & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy on write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. The points are gathered into runs which are then
+     * merged with the runs of the set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds the points of a run, i.e. the points of the row of @a
+     * aFirst from @a aFirst to the point of first coordinate @a aLast.
+     *
+     * @param aFirst the first point of the run.
+     * @param aLast the first coordinate of the last point of the run.
+     * @pre the run should belong to the associated domain.
+     */
+    void insertRun( const Point & aFirst, const Integer aLast );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Removes the points of a run, i.e. the points of the row of @a
+     * aFirst from @a aFirst to the point of first coordinate @a aLast.
+     *
+     * @param aFirst the first point of the run.
+     * @param aLast the first coordinate of the last point of the run.
+     * @return the number of removed elements.
+     */
+    Size eraseRun( const Point & aFirst, const Integer aLast );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set (with the same domain).
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Self & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set (with the same domain).
+     * @return a reference on 'this'.
+     */
+    Self & operator*=( const Self & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set (with the same domain).
+     * @return a reference on 'this'.
+     */
+    Self & operator-=( const Self & aSet );
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this, row by row.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set (in O(r)).
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Run services -----------------------------------
+  public:
+
+    /**
+     * @return the number of runs of the set.
+     */
+    Size nbRuns() const;
+
+    /**
+     * @return a const iterator on the first run of the set.
+     */
+    RunConstIterator runBegin() const;
+
+    /**
+     * @return a const iterator after the last run of the set.
+     */
+    RunConstIterator runEnd() const;
+
+    /**
+     * @param aRow the index of a row of the domain.
+     * @return the range of the runs of the row @a aRow, sorted by
+     * first coordinate (O(log r)).
+     */
+    std::pair<RunConstIterator, RunConstIterator> rowRuns( const Size aRow ) const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of the row of @a p.
+     */
+    Size rowIndex( const Point & p ) const;
+
+    /**
+     * @param aRow the index of a row of the domain.
+     * @return the first point of the domain in the row @a aRow.
+     */
+    Point rowPoint( const Size aRow ) const;
+
+    /**
+     * @return the number of rows of the domain.
+     */
+    Size nbRows() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /**
+     * The runs of the set, sorted, disjoint and non adjacent.
+     */
+    Runs myRuns;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRuns();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aRow a row index.
+     * @param aX a first coordinate.
+     * @return the first run after (aRow,aX), i.e. such that the run
+     * before it (if any) is the only one that may contain (aRow,aX).
+     */
+    typename Runs::iterator upperRun( const Size aRow, const Integer aX );
+
+    /// Const version of upperRun.
+    RunConstIterator upperRun( const Size aRow, const Integer aX ) const;
+
+    /**
+     * Appends a run at the end of sorted runs, merging it with the
+     * last run if they overlap or are adjacent.
+     * @param runs (modified) sorted runs.
+     * @param aRun a run not before the last run of @a runs.
+     */
+    static void pushRun( Runs & runs, const Run & aRun );
+
+    /// @return the number of points of the runs @a runs.
+    static Size count( const Runs & runs );
+
+    /**
+     * Sorts runs and merges the overlapping or adjacent ones.
+     * @param runs (modified) any runs.
+     */
+    static void normalize( Runs & runs );
+
+    /// Union of two sorted lists of runs (in @a result).
+    static void unite( const Runs & a, const Runs & b, Runs & result );
+
+    /// Intersection of two sorted lists of runs (in @a result).
+    static void intersect( const Runs & a, const Runs & b, Runs & result );
+
+    /// Difference of two sorted lists of runs (in @a result).
+    static void subtract( const Runs & a, const Runs & b, Runs & result );
+
+    /// Compares runs with row indices.
+    struct RowComparator
+    {
+      bool operator()( const Run & aRun, const Size aRow ) const { return aRun.row < aRow; }
+      bool operator()( const Size aRow, const Run & aRun ) const { return aRow < aRun.row; }
+    };
+
+    friend class ConstIterator;
+
+  }; // end of class DigitalSetByRuns
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByRuns<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRuns.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRuns_h
+
+#undef DigitalSetByRuns_RECURSES
+#endif // else defined(DigitalSetByRuns_RECURSES)
@@ -0,0 +1,316 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompiledMPolynomial3.h
+ *
+ * Header file for module CompiledMPolynomial3.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompiledMPolynomial3_RECURSES)
+#error Recursive header files inclusion detected in CompiledMPolynomial3.h
+#else // defined(CompiledMPolynomial3_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompiledMPolynomial3_RECURSES
+
+#if !defined CompiledMPolynomial3_h
+/** Prevents repeated inclusion of headers. */
+#define CompiledMPolynomial3_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompiledMPolynomial3
+  /**
+    Description of template class 'CompiledMPolynomial3' <p>
+    \brief Aim: Evaluates a trivariate polynomial and its gradient
+    quickly, on single points or on batches of points.
+
+    An MPolynomial is a tree of coefficient arrays, and each
+    evaluation goes through nested MPolynomialEvaluatorImpl objects.
+    This class flattens once a MPolynomial<3,TRing> into a nested
+    Horner scheme:
+
+    \f[ P(x,y,z) = (\ldots( P_{d}(y,z) x + P_{d-1}(y,z) ) x + \ldots ) x + P_0(y,z), \f]
+
+    each \f$ P_i \f$ being itself evaluated by Horner in \a y, and its
+    coefficients by Horner in \a z. The program is made of a sequence
+    of loop counts and of the coefficients in the order they are
+    consumed, so that an evaluation is a linear scan of two arrays.
+    The three partial derivatives are derived and compiled at the same
+    time.
+
+    Batches of points (given as separate x, y and z arrays) are
+    evaluated by blocks of \a Lanes points: every step of the program
+    is applied to all the points of the block by a fixed-length loop,
+    that the compiler vectorizes. With OpenMP (WITH_OPENMP), large
+    batches are shared among threads.
+
+    @code
+    MPolynomial<3, double> P = mmonomial<double>( 2, 0, 0 ) + ...;
+    CompiledMPolynomial3<double> cP( P );
+    double v = cP( 0.5, 1.0, -0.5 );
+    cP.eval( n, xs, ys, zs, values );
+    cP.evalGradient( n, xs, ys, zs, gxs, gys, gzs );
+    @endcode
+
+    @tparam TRing the type of the coefficients and of the variables
+    (generally double).
+
+    @see MPolynomial, ImplicitPolynomial3Shape
+   */
+  template <typename TRing>
+  class CompiledMPolynomial3
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TRing Ring;
+    typedef CompiledMPolynomial3< Ring > Self;
+    typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef std::size_t Size;
+
+    /// Number of points evaluated together in batch evaluations.
+    static const unsigned int Lanes = 8;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The compiled polynomial is zero.
+     */
+    CompiledMPolynomial3();
+
+    /**
+     * Constructor.
+     * @param poly any trivariate polynomial.
+     */
+    CompiledMPolynomial3( const Polynomial3 & poly );
+
+    /**
+       Compiles the polynomial \a poly and its partial derivatives.
+       @param poly any trivariate polynomial.
+    */
+    void init( const Polynomial3 & poly );
+
+    // ----------------------- Evaluation services ----------------------------
+  public:
+
+    /**
+       @return the degree of the compiled polynomial in the first
+       variable (-1 for the zero polynomial).
+    */
+    int degree() const;
+
+    /**
+       @return the number of coefficients of the compiled polynomial
+       (some of them may be zero).
+    */
+    Size size() const;
+
+    /**
+       @param x the first coordinate.
+       @param y the second coordinate.
+       @param z the third coordinate.
+       @return the value P(x,y,z).
+    */
+    Ring operator()( const Ring & x, const Ring & y, const Ring & z ) const;
+
+    /**
+       Computes the gradient of P at (x,y,z).
+
+       @param x the first coordinate.
+       @param y the second coordinate.
+       @param z the third coordinate.
+       @param[out] gx the value dP/dx(x,y,z).
+       @param[out] gy the value dP/dy(x,y,z).
+       @param[out] gz the value dP/dz(x,y,z).
+    */
+    void gradient( const Ring & x, const Ring & y, const Ring & z,
+                   Ring & gx, Ring & gy, Ring & gz ) const;
+
+    /**
+       Evaluates P on \a n points.
+
+       @param n the number of points.
+       @param x the first coordinates of the points (n values).
+       @param y the second coordinates of the points (n values).
+       @param z the third coordinates of the points (n values).
+       @param[out] values the n values of P (must be allocated).
+    */
+    void eval( Size n, const Ring* x, const Ring* y, const Ring* z,
+               Ring* values ) const;
+
+    /**
+       Evaluates the gradient of P on \a n points.
+
+       @param n the number of points.
+       @param x the first coordinates of the points (n values).
+       @param y the second coordinates of the points (n values).
+       @param z the third coordinates of the points (n values).
+       @param[out] gx the n values of dP/dx (must be allocated).
+       @param[out] gy the n values of dP/dy (must be allocated).
+       @param[out] gz the n values of dP/dz (must be allocated).
+    */
+    void evalGradient( Size n, const Ring* x, const Ring* y, const Ring* z,
+                       Ring* gx, Ring* gy, Ring* gz ) const;
+
+    /**
+       Bounds the values of P on the box [lo,up] by interval
+       arithmetic on the Horner scheme (natural interval extension).
+       Rounding errors are not taken into account (see roundingError()).
+
+       @param lo the lower corner of the box.
+       @param up the upper corner of the box.
+       @param[out] vlo a lower bound of P on the box.
+       @param[out] vup an upper bound of P on the box.
+    */
+    void evalInterval( const Ring lo[ 3 ], const Ring up[ 3 ],
+                       Ring & vlo, Ring & vup ) const;
+
+    /**
+       Bounds the partial derivatives of P on the box [lo,up] by
+       interval arithmetic.
+
+       @param lo the lower corner of the box.
+       @param up the upper corner of the box.
+       @param[out] glo the lower bounds of dP/dx, dP/dy, dP/dz on the box.
+       @param[out] gup the upper bounds of dP/dx, dP/dy, dP/dz on the box.
+    */
+    void evalGradientInterval( const Ring lo[ 3 ], const Ring up[ 3 ],
+                               Ring glo[ 3 ], Ring gup[ 3 ] ) const;
+
+    /**
+       @param lo the lower corner of a box.
+       @param up the upper corner of a box.
+       @return an upper bound of the rounding error made when
+       evaluating P at any point of the box [lo,up].
+    */
+    Ring roundingError( const Ring lo[ 3 ], const Ring up[ 3 ] ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       A flattened polynomial. The code starts with the number of
+       coefficients in x, then, for each of them (highest degree
+       first), the number of coefficients in y followed by the number
+       of coefficients in z of each of them. The coefficients are
+       stored in the order the evaluation consumes them.
+    */
+    struct Program
+    {
+      std::vector< unsigned int > code;
+      std::vector< Ring > coefficients;
+
+      /**
+         Flattens \a poly.
+         @param poly any trivariate polynomial.
+      */
+      void compile( const Polynomial3 & poly );
+
+      /**
+         @return the value of the program at (x,y,z).
+      */
+      Ring eval( const Ring & x, const Ring & y, const Ring & z ) const;
+
+      /**
+         Evaluates the program on the \a Lanes points of a block.
+      */
+      void evalBlock( const Ring* x, const Ring* y, const Ring* z,
+                      Ring* values ) const;
+
+      /**
+         Evaluates the program on \a n points, block by block.
+      */
+      void evalBatch( Size n, const Ring* x, const Ring* y, const Ring* z,
+                      Ring* values ) const;
+
+      /**
+         Evaluates the program with intervals [lo,up] as variables.
+      */
+      void evalInterval( const Ring lo[ 3 ], const Ring up[ 3 ],
+                         Ring & vlo, Ring & vup ) const;
+
+      /**
+         @return the value at (x,y,z) of the program whose
+         coefficients are the absolute values of these ones.
+      */
+      Ring evalAbsolute( const Ring & x, const Ring & y, const Ring & z ) const;
+    };
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The compiled polynomial.
+    Program myValue;
+    /// The compiled partial derivatives.
+    Program myGradient[ 3 ];
+
+  }; // end of class CompiledMPolynomial3
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompiledMPolynomial3'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompiledMPolynomial3' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TRing>
+  std::ostream&
+  operator<< ( std::ostream & out, const CompiledMPolynomial3<TRing> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/CompiledMPolynomial3.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompiledMPolynomial3_h
+
+#undef CompiledMPolynomial3_RECURSES
+#endif // else defined(CompiledMPolynomial3_RECURSES)
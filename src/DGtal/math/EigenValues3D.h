@@ -46,6 +46,10 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
 #include "DGtal/kernel/SimpleMatrix.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -56,6 +60,15 @@ namespace DGtal
  * Description of struct 'EigenValues3D' <p>
  * \brief Aim: Computes EigenValues and EigenVectors from 3D Matrix.
  *
+ * getEigenDecomposition() processes one symmetric matrix with the
+ * iterative tred2/tql2 routines. getEigenValues() and
+ * getEigenDecompositions() process \a n symmetric matrices given as
+ * structure-of-arrays (one array per coefficient xx, xy, xz, yy, yz,
+ * zz) with the closed-form (trigonometric) method, which has no
+ * iteration and no data-dependent loop, and fall back to tred2/tql2
+ * for the matrices that are numerically multiples of the identity.
+ * The matrices are processed in parallel when OpenMP is enabled.
+ *
  * @tparam TQuantity Type of the quantity inside the matrix.
  */
 template< typename TQuantity >
@@ -412,6 +425,263 @@ public:
 
     tql2 ( eigenVectors, eigenValues, e );
   }
+
+  /**
+      * \brief Compute the eigen values of \a n symmetric matrices with the closed-form method.
+      *
+      * @param[in]  n            number of matrices.
+      * @param[in]  matrices     arrays of the coefficients xx, xy, xz, yy, yz, zz of the matrices (each of size n).
+      * @param[out] eigenValues  arrays of the smallest, middle and largest eigen values (each of size n).
+      */
+  static void getEigenValues( const std::size_t n, const Quantity * const matrices[ 6 ],
+                              Quantity * const eigenValues[ 3 ] )
+  {
+    const Quantity tolerance = closedFormTolerance();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) if( n > 4096 )
+#endif
+    for ( long int i = 0; i < (long int) n; ++i )
+    {
+      Quantity values[ 3 ], vectors[ 9 ];
+      closedFormDecomposition( matrices, i, tolerance, vectors, values );
+      for ( Dimension k = 0; k < 3; ++k )
+      {
+        eigenValues[ k ][ i ] = values[ k ];
+      }
+    }
+  }
+
+  /**
+      * \brief Compute both eigen vectors and eigen values of \a n symmetric matrices.
+      *
+      * Matrices which are numerically multiples of the identity are
+      * solved with getEigenDecomposition(). As with
+      * getEigenDecomposition(), eigen values are sorted in increasing
+      * order and eigen vectors are only defined up to their sign (and
+      * up to a rotation in the eigen space of a double eigen value).
+      *
+      * @param[in]  n             number of matrices.
+      * @param[in]  matrices      arrays of the coefficients xx, xy, xz, yy, yz, zz of the matrices (each of size n).
+      * @param[out] eigenVectors  arrays of the coefficients of the eigenvector matrices (each of size n), in row-major order: eigenVectors[ 3 * r + c ] is the r-th coordinate of the c-th eigen vector.
+      * @param[out] eigenValues   arrays of the smallest, middle and largest eigen values (each of size n).
+      */
+  static void getEigenDecompositions( const std::size_t n, const Quantity * const matrices[ 6 ],
+                                      Quantity * const eigenVectors[ 9 ],
+                                      Quantity * const eigenValues[ 3 ] )
+  {
+    const Quantity tolerance = closedFormTolerance();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static) if( n > 4096 )
+#endif
+    for ( long int i = 0; i < (long int) n; ++i )
+    {
+      Quantity values[ 3 ], vectors[ 9 ];
+      if ( ! closedFormDecomposition( matrices, i, tolerance, vectors, values ) )
+      {
+        Matrix33 matrix, refVectors;
+        Vector3 refValues;
+        static const Dimension coefficient[ 3 ][ 3 ] = { { 0, 1, 2 }, { 1, 3, 4 }, { 2, 4, 5 } };
+        for ( Dimension r = 0; r < 3; ++r )
+        {
+          for ( Dimension k = 0; k < 3; ++k )
+          {
+            matrix.setComponent( r, k, matrices[ coefficient[ r ][ k ] ][ i ] );
+          }
+        }
+        getEigenDecomposition( matrix, refVectors, refValues );
+        for ( Dimension r = 0; r < 3; ++r )
+        {
+          values[ r ] = refValues[ r ];
+          for ( Dimension k = 0; k < 3; ++k )
+          {
+            vectors[ 3 * r + k ] = refVectors( r, k );
+          }
+        }
+      }
+      for ( Dimension k = 0; k < 3; ++k )
+      {
+        eigenValues[ k ][ i ] = values[ k ];
+      }
+      for ( Dimension k = 0; k < 9; ++k )
+      {
+        eigenVectors[ k ][ i ] = vectors[ k ];
+      }
+    }
+  }
+
+private:
+  /**
+      * Below this spread of the eigen values (relatively to their
+      * mean), the shifted matrix is dominated by rounding errors and
+      * the closed-form method gives up.
+      *
+      * @return the relative tolerance of closedFormDecomposition().
+      */
+  static Quantity closedFormTolerance()
+  {
+    return Quantity( std::pow( (double) std::numeric_limits< Quantity >::epsilon(), 1.0 / 3.0 ));
+  }
+
+  /**
+      * Eigen decomposition of the \a i-th symmetric matrix of \a
+      * matrices with the closed-form method.
+      *
+      * The matrix is shifted by the mean m of its eigen values and
+      * scaled by their standard deviation p, so that its eigen values
+      * are \f$ m + 2p \cos( \phi + 2k\pi/3 ) \f$. The eigen value
+      * farthest from the two others is accurate, and its eigen vector
+      * u is the largest cross product of two rows of the shifted
+      * matrix. The two other eigen values are close to a double root
+      * of the characteristic polynomial, where the trigonometric
+      * formula loses half of the precision: they are computed again,
+      * with their eigen vectors, from the 2x2 restriction of the matrix
+      * to the plane orthogonal to u.
+      *
+      * @param[in]  matrices   arrays of the coefficients xx, xy, xz, yy, yz, zz.
+      * @param[in]  i          index of the matrix.
+      * @param[in]  tolerance  the relative tolerance (see closedFormTolerance()).
+      * @param[out] vectors    the eigen vectors, in columns (row-major order).
+      * @param[out] values     the sorted eigen values.
+      *
+      * @return 'false' if the matrix is numerically a multiple of the
+      * identity (then only the eigen values are valid).
+      */
+  static bool closedFormDecomposition( const Quantity * const matrices[ 6 ], const long int i,
+                                       const Quantity tolerance,
+                                       Quantity vectors[ 9 ], Quantity values[ 3 ] )
+  {
+    const Quantity xy = matrices[ 1 ][ i ];
+    const Quantity xz = matrices[ 2 ][ i ];
+    const Quantity yz = matrices[ 4 ][ i ];
+    const Quantity m = ( matrices[ 0 ][ i ] + matrices[ 3 ][ i ] + matrices[ 5 ][ i ] ) / Quantity( 3.0 );
+    const Quantity b00 = matrices[ 0 ][ i ] - m;
+    const Quantity b11 = matrices[ 3 ][ i ] - m;
+    const Quantity b22 = matrices[ 5 ][ i ] - m;
+    const Quantity p = std::sqrt( ( b00 * b00 + b11 * b11 + b22 * b22
+                                    + Quantity( 2.0 ) * ( xy * xy + xz * xz + yz * yz ) ) / Quantity( 6.0 ));
+    const Quantity q = p > Quantity( 0.0 ) ? Quantity( 1.0 ) / p : Quantity( 0.0 );
+    const Quantity c[ 6 ] = { b00 * q, xy * q, xz * q, b11 * q, yz * q, b22 * q };
+    const Quantity halfDet = ( c[ 0 ] * ( c[ 3 ] * c[ 5 ] - c[ 4 ] * c[ 4 ] )
+                               - c[ 1 ] * ( c[ 1 ] * c[ 5 ] - c[ 4 ] * c[ 2 ] )
+                               + c[ 2 ] * ( c[ 1 ] * c[ 4 ] - c[ 3 ] * c[ 2 ] ) ) / Quantity( 2.0 );
+    const Quantity r = std::min( std::max( halfDet, Quantity( -1.0 ) ), Quantity( 1.0 ) );
+    const Quantity phi = Quantity( std::acos( r ) ) / Quantity( 3.0 );
+    const Quantity s2 = Quantity( 2.0 ) * Quantity( std::cos( phi ) );
+    const Quantity s0 = Quantity( 2.0 ) * Quantity( std::cos( phi + Quantity( 2.0 * M_PI / 3.0 ) ) );
+    const Quantity s1 = - s0 - s2;
+    values[ 0 ] = m + p * s0;
+    values[ 1 ] = m + p * s1;
+    values[ 2 ] = m + p * s2;
+    if ( ! ( p > tolerance * std::fabs( m ) ) )
+    {
+      return false;
+    }
+
+    // The isolated eigen value and its eigen vector u.
+    const bool isoFirst = ( s1 - s0 >= s2 - s1 );
+    Quantity u[ 3 ];
+    largestCrossProduct( c, isoFirst ? s0 : s2, u );
+    normalize( u );
+    Quantity cu[ 3 ];
+    product( c, u, cu );
+    const Quantity sIso = u[ 0 ] * cu[ 0 ] + u[ 1 ] * cu[ 1 ] + u[ 2 ] * cu[ 2 ];
+
+    // Orthonormal basis (e1,e2) of the plane orthogonal to u, and the
+    // restriction [ a b ; b d ] of the matrix to this plane.
+    const Dimension axis = ( std::fabs( u[ 0 ] ) <= std::fabs( u[ 1 ] ) )
+      ? ( std::fabs( u[ 0 ] ) <= std::fabs( u[ 2 ] ) ? 0 : 2 )
+      : ( std::fabs( u[ 1 ] ) <= std::fabs( u[ 2 ] ) ? 1 : 2 );
+    const Quantity e[ 3 ] = { Quantity( axis == 0 ), Quantity( axis == 1 ), Quantity( axis == 2 ) };
+    Quantity e1[ 3 ], e2[ 3 ], ce1[ 3 ], ce2[ 3 ];
+    cross( u, e, e1 );
+    normalize( e1 );
+    cross( u, e1, e2 );
+    product( c, e1, ce1 );
+    product( c, e2, ce2 );
+    const Quantity a = e1[ 0 ] * ce1[ 0 ] + e1[ 1 ] * ce1[ 1 ] + e1[ 2 ] * ce1[ 2 ];
+    const Quantity b = e1[ 0 ] * ce2[ 0 ] + e1[ 1 ] * ce2[ 1 ] + e1[ 2 ] * ce2[ 2 ];
+    const Quantity d = e2[ 0 ] * ce2[ 0 ] + e2[ 1 ] * ce2[ 1 ] + e2[ 2 ] * ce2[ 2 ];
+    const Quantity half = ( a - d ) / Quantity( 2.0 );
+    const Quantity radius = Quantity( std::sqrt( half * half + b * b ) );
+    const Quantity mid = ( a + d ) / Quantity( 2.0 );
+
+    // Eigen vector (x,y) of the largest 2x2 eigen value, written
+    // without cancellation.
+    Quantity x = half >= Quantity( 0.0 ) ? half + radius : b;
+    Quantity y = half >= Quantity( 0.0 ) ? b : radius - half;
+    const Quantity nxy = Quantity( std::sqrt( x * x + y * y ) );
+    x = nxy > Quantity( 0.0 ) ? x / nxy : Quantity( 1.0 );
+    y = nxy > Quantity( 0.0 ) ? y / nxy : Quantity( 0.0 );
+    Quantity vHigh[ 3 ], vLow[ 3 ];
+    for ( Dimension k = 0; k < 3; ++k )
+    {
+      vHigh[ k ] = x * e1[ k ] + y * e2[ k ];
+      vLow[ k ] = - y * e1[ k ] + x * e2[ k ];
+    }
+
+    const Quantity sLow = isoFirst ? std::max( mid - radius, sIso ) : mid - radius;
+    const Quantity sHigh = isoFirst ? mid + radius : std::min( mid + radius, sIso );
+    const Quantity * const columns[ 3 ] = { isoFirst ? u : vLow, isoFirst ? vLow : vHigh, isoFirst ? vHigh : u };
+    values[ 0 ] = m + p * ( isoFirst ? sIso : sLow );
+    values[ 1 ] = m + p * ( isoFirst ? sLow : sHigh );
+    values[ 2 ] = m + p * ( isoFirst ? sHigh : sIso );
+    for ( Dimension k = 0; k < 3; ++k )
+    {
+      for ( Dimension col = 0; col < 3; ++col )
+      {
+        vectors[ 3 * k + col ] = columns[ col ][ k ];
+      }
+    }
+    return true;
+  }
+
+  /**
+      * Eigen vector (not normalized) of the symmetric matrix \a c for
+      * the simple eigen value \a s: the largest cross product of two
+      * rows of the matrix \f$ c - s I \f$.
+      *
+      * @param[in]  c  the coefficients xx, xy, xz, yy, yz, zz of the matrix.
+      * @param[in]  s  a simple eigen value of the matrix.
+      * @param[out] u  the eigen vector.
+      */
+  static void largestCrossProduct( const Quantity c[ 6 ], const Quantity s, Quantity u[ 3 ] )
+  {
+    const Quantity r0[ 3 ] = { c[ 0 ] - s, c[ 1 ], c[ 2 ] };
+    const Quantity r1[ 3 ] = { c[ 1 ], c[ 3 ] - s, c[ 4 ] };
+    const Quantity r2[ 3 ] = { c[ 2 ], c[ 4 ], c[ 5 ] - s };
+    Quantity x01[ 3 ], x02[ 3 ], x12[ 3 ];
+    cross( r0, r1, x01 );
+    cross( r0, r2, x02 );
+    cross( r1, r2, x12 );
+    const Quantity n01 = x01[ 0 ] * x01[ 0 ] + x01[ 1 ] * x01[ 1 ] + x01[ 2 ] * x01[ 2 ];
+    const Quantity n02 = x02[ 0 ] * x02[ 0 ] + x02[ 1 ] * x02[ 1 ] + x02[ 2 ] * x02[ 2 ];
+    const Quantity n12 = x12[ 0 ] * x12[ 0 ] + x12[ 1 ] * x12[ 1 ] + x12[ 2 ] * x12[ 2 ];
+    const Quantity * x = ( n01 >= n02 ) ? ( n01 >= n12 ? x01 : x12 ) : ( n02 >= n12 ? x02 : x12 );
+    u[ 0 ] = x[ 0 ]; u[ 1 ] = x[ 1 ]; u[ 2 ] = x[ 2 ];
+  }
+
+  /// Product \a x = \a c \a u of the symmetric matrix \a c (xx, xy, xz, yy, yz, zz) with \a u.
+  static void product( const Quantity c[ 6 ], const Quantity u[ 3 ], Quantity x[ 3 ] )
+  {
+    x[ 0 ] = c[ 0 ] * u[ 0 ] + c[ 1 ] * u[ 1 ] + c[ 2 ] * u[ 2 ];
+    x[ 1 ] = c[ 1 ] * u[ 0 ] + c[ 3 ] * u[ 1 ] + c[ 4 ] * u[ 2 ];
+    x[ 2 ] = c[ 2 ] * u[ 0 ] + c[ 4 ] * u[ 1 ] + c[ 5 ] * u[ 2 ];
+  }
+
+  /// Cross product \a x = \a a ^ \a b.
+  static void cross( const Quantity a[ 3 ], const Quantity b[ 3 ], Quantity x[ 3 ] )
+  {
+    x[ 0 ] = a[ 1 ] * b[ 2 ] - a[ 2 ] * b[ 1 ];
+    x[ 1 ] = a[ 2 ] * b[ 0 ] - a[ 0 ] * b[ 2 ];
+    x[ 2 ] = a[ 0 ] * b[ 1 ] - a[ 1 ] * b[ 0 ];
+  }
+
+  /// Normalizes the non-null vector \a x.
+  static void normalize( Quantity x[ 3 ] )
+  {
+    const Quantity q = Quantity( 1.0 ) / Quantity( std::sqrt( x[ 0 ] * x[ 0 ] + x[ 1 ] * x[ 1 ] + x[ 2 ] * x[ 2 ] ) );
+    x[ 0 ] *= q; x[ 1 ] *= q; x[ 2 ] *= q;
+  }
 };
 }
 
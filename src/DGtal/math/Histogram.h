@@ -135,6 +135,11 @@ namespace DGtal
       std::cout << i << " " << hist.pdf( i ) << std::endl;
     @endcode
 
+    The samples need not be stored to initialize the histogram
+    (min, max, variance and number of samples are enough). When the
+    range is not known in advance, StreamingHistogram builds a
+    regular histogram in a single pass.
+
     @tparam TQuantity any model of CEuclideanRing listed in
     NumberTraits and that can be castToDouble.
 
@@ -218,6 +223,16 @@ namespace DGtal
     template <typename TInputIterator>
     void addValues( TInputIterator it, TInputIterator itE );
 
+    /**
+       Adds the counts of \a other to this histogram, typically to
+       merge partial histograms computed by several threads. terminate()
+       must be called again afterwards.
+
+       @param other any histogram.
+       @pre both histograms have the same binner (or at least the same number of bins).
+    */
+    void merge( const Histogram & other );
+
     /**
        Should be called when all values have been added.
     */
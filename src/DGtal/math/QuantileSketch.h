@@ -0,0 +1,238 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file QuantileSketch.h
+ *
+ * Header file for module QuantileSketch.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(QuantileSketch_RECURSES)
+#error Recursive header files inclusion detected in QuantileSketch.h
+#else // defined(QuantileSketch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define QuantileSketch_RECURSES
+
+#if !defined QuantileSketch_h
+/** Prevents repeated inclusion of headers. */
+#define QuantileSketch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class QuantileSketch
+  /**
+    Description of template class 'QuantileSketch' <p> \brief Aim:
+    Summarizes a stream of values in bounded memory so that any
+    quantile (median, percentiles) can be approximated afterwards
+    (KLL sketch, Karnin, Lang and Liberty, 2016).
+
+    Values are kept in a hierarchy of compactors: level \a h holds
+    values that each stand for \f$ 2^h \f$ input values. When a level
+    is full, it is sorted and one value out of two (starting at a
+    random offset) is promoted to the next level. Top levels have a
+    capacity \a k, lower levels have geometrically smaller
+    capacities, so that O(k) values are stored whatever the number of
+    input values. The rank error of a quantile is then about \f$
+    1.7/k \f$ (e.g. 1% for the default \a k = 200). Sketches built
+    from different parts of the data (e.g. per thread) can be merged.
+
+    @code
+    QuantileSketch<double> sketch;
+    for ( ... ) sketch.addValue( v );
+    double median = sketch.quantile( 0.5 );
+    double p90 = sketch.quantile( 0.9 );
+    @endcode
+
+    @tparam TQuantity any totally ordered, copyable number type.
+   */
+  template <typename TQuantity>
+  class QuantileSketch
+  {
+    // ----------------------- public types -----------------------------------
+  public:
+    typedef TQuantity Quantity;
+    typedef DGtal::uint64_t Size;
+    typedef std::vector< Quantity > Compactor;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param k the accuracy parameter (capacity of the top compactor), at least 2.
+     */
+    QuantileSketch( unsigned int k = 200 );
+
+    /**
+     * Adds a new sample value [v].
+     * @param v the new sample value.
+     */
+    void addValue( const Quantity & v );
+
+    /**
+     * Adds a sequence of sample values, scanning a container from
+     * iterators [b] to [e].
+     *
+     * @param b an iterator on the starting point.
+     * @param e an iterator after the last point.
+     */
+    template <class Iter>
+    void addValues( Iter b, Iter e );
+
+    /**
+     * Merges the values summarized by \a other into this sketch. Both
+     * sketches should have the same accuracy parameter.
+     *
+     * @param other another sketch.
+     */
+    void merge( const QuantileSketch & other );
+
+    /**
+     * Clears the object. As if it has just been created.
+     */
+    void clear();
+
+    /**
+     * @return the number of values added to the sketch.
+     */
+    Size samples() const;
+
+    /**
+     * @return the number of values stored in the sketch.
+     */
+    Size storedSize() const;
+
+    /**
+     * @return the accuracy parameter.
+     */
+    unsigned int accuracy() const;
+
+    /**
+     * Approximates the quantile of order \a q, i.e. the value of rank
+     * \f$ \lfloor q n \rfloor \f$ in the sorted sequence of the \a n
+     * values. While no compaction has occured (n small), the result
+     * is exact.
+     *
+     * @param q the order of the quantile, in [0,1] (0.5 for the median).
+     * @return the approximate quantile.
+     * @pre samples() > 0
+     */
+    Quantity quantile( double q ) const;
+
+    /**
+     * Approximates the rank of \a v, i.e. the number of added values
+     * that are lower or equal to \a v.
+     *
+     * @param v any value.
+     * @return the approximate rank of \a v.
+     */
+    Size rank( const Quantity & v ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Datas ----------------------------------------
+  private:
+
+    /// The accuracy parameter.
+    unsigned int myK;
+    /// The compactors, level h stores values of weight 2^h.
+    std::vector< Compactor > myLevels;
+    /// The number of added values.
+    Size mySamples;
+    /// The number of stored values.
+    Size myStoredSize;
+    /// The sum of the capacities of the compactors.
+    Size myMaxSize;
+    /// State of the pseudo-random generator choosing compaction offsets.
+    DGtal::uint32_t myRandom;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param h a level.
+     * @return the capacity of the compactor at level \a h.
+     */
+    Size capacity( unsigned int h ) const;
+
+    /**
+     * Adds a level on top of the compactors.
+     */
+    void grow();
+
+    /**
+     * Compacts the full compactors until the sketch fits in its
+     * capacity.
+     */
+    void compress();
+
+    /**
+     * @return a pseudo-random bit.
+     */
+    unsigned int randomBit();
+
+  }; // end of class QuantileSketch
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'QuantileSketch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'QuantileSketch' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TQuantity>
+  std::ostream&
+  operator<<( std::ostream & out, const QuantileSketch<TQuantity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/QuantileSketch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined QuantileSketch_h
+
+#undef QuantileSketch_RECURSES
+#endif // else defined(QuantileSketch_RECURSES)
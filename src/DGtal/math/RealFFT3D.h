@@ -0,0 +1,239 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RealFFT3D.h
+ *
+ * Header file for module RealFFT3D.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RealFFT3D_RECURSES)
+#error Recursive header files inclusion detected in RealFFT3D.h
+#else // defined(RealFFT3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RealFFT3D_RECURSES
+
+#if !defined RealFFT3D_h
+/** Prevents repeated inclusion of headers. */
+#define RealFFT3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <complex>
+#include <vector>
+#include "DGtal/base/Common.h"
+#ifdef WITH_FFTW3
+#include <fftw3.h>
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class RealFFT3D
+  /**
+   * Description of class 'RealFFT3D' <p>
+   * \brief Aim: Discrete Fourier transform of real 3D images of
+   * doubles, and its inverse.
+   *
+   * Images are stored in a contiguous array, x varying first, then y,
+   * then z. Since the input is real, only the non-redundant half of
+   * the spectrum is computed: (nx/2+1) x ny x nz complex coefficients,
+   * again with the first index varying first.
+   *
+   * If DGtal has been built with FFTW3 (WITH_FFTW3 flag set to
+   * "true"), transforms are delegated to FFTW and any size is
+   * accepted. Otherwise an in-tree radix-2 implementation is used
+   * and all sizes must be powers of two: use goodSize() to choose
+   * them.
+   *
+   * The forward transform is not normalized, the backward one is
+   * (backward( forward( f ) ) == f).
+   *
+   * @code
+   * RealFFT3D fft( 32, 32, 32 );
+   * std::vector<double> f( fft.size() );
+   * std::vector<RealFFT3D::Complex> F;
+   * fft.forward( f, F );
+   * ... // e.g. pointwise products of spectra.
+   * fft.backward( F, f );
+   * @endcode
+   *
+   * @see testRealFFT3D.cpp FFTBallConvolver.h
+   */
+  class RealFFT3D
+  {
+    // ----------------------- Types ------------------------------------------
+  public:
+    typedef std::complex< double > Complex;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param nx the size along x (must be even).
+     * @param ny the size along y.
+     * @param nz the size along z.
+     */
+    RealFFT3D( std::size_t nx, std::size_t ny, std::size_t nz );
+
+    /**
+     * Destructor.
+     */
+    ~RealFFT3D();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param n any positive size.
+     * @return the smallest size greater or equal to @a n that is
+     * supported (and efficient) for the transforms: a power of two for
+     * the in-tree implementation, a product of powers of 2, 3 and 5 with
+     * FFTW.
+     */
+    static std::size_t goodSize( std::size_t n );
+
+    /// @return the number of real values of an image (nx*ny*nz).
+    std::size_t size() const;
+
+    /// @return the number of complex coefficients of a spectrum ((nx/2+1)*ny*nz).
+    std::size_t spectrumSize() const;
+
+    /**
+     * Forward transform.
+     *
+     * @param[in] image a real image of size() values.
+     * @param[out] spectrum its half-spectrum (resized to spectrumSize()).
+     */
+    void forward( const std::vector< double > & image,
+                  std::vector< Complex > & spectrum ) const;
+
+    /**
+     * Backward (normalized) transform.
+     *
+     * @param[in,out] spectrum a half-spectrum of spectrumSize()
+     * values, which is used as a work buffer and overwritten.
+     * @param[out] image the real image (resized to size()).
+     */
+    void backward( std::vector< Complex > & spectrum,
+                   std::vector< double > & image ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+#ifndef WITH_FFTW3
+    /**
+     * In-place radix-2 complex transform of @a n values spaced by @a
+     * stride.
+     *
+     * @param data the first value.
+     * @param n the number of values (a power of two).
+     * @param stride the distance between consecutive values.
+     * @param inverse when 'true', the (unnormalized) inverse transform is computed.
+     * @param buffer a work buffer of at least @a n values.
+     */
+    void transform( Complex * data, std::size_t n, std::size_t stride,
+                    bool inverse, Complex * buffer ) const;
+
+    /**
+     * Complex transforms of a half-spectrum along y and z (forward),
+     * or along z and y (inverse).
+     *
+     * @param spectrum a half-spectrum of spectrumSize() values.
+     * @param inverse when 'true', the (unnormalized) inverse transforms are computed.
+     */
+    void transformYZ( std::vector< Complex > & spectrum, bool inverse ) const;
+#endif
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    std::size_t myNx; ///< Size along x.
+    std::size_t myNy; ///< Size along y.
+    std::size_t myNz; ///< Size along z.
+
+#ifdef WITH_FFTW3
+    fftw_plan myForwardPlan;  ///< FFTW plan of the forward transform.
+    fftw_plan myBackwardPlan; ///< FFTW plan of the backward transform.
+#else
+    std::vector< Complex > myTwiddles; ///< exp(-2i.pi.j/n) for 0 <= j <= n/2, n being the largest size.
+#endif
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    RealFFT3D ( const RealFFT3D & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    RealFFT3D & operator= ( const RealFFT3D & other );
+
+  }; // end of class RealFFT3D
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'RealFFT3D'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'RealFFT3D' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const RealFFT3D & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/RealFFT3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RealFFT3D_h
+
+#undef RealFFT3D_RECURSES
+#endif // else defined(RealFFT3D_RECURSES)
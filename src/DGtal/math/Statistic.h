@@ -45,6 +45,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CCommutativeRing.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/math/QuantileSketch.h"
 #include <utility>
 #include <vector>
 //////////////////////////////////////////////////////////////////////////////
@@ -59,6 +60,19 @@ namespace DGtal
     efficiency. For multiple variables, sample storage and others,
     see Statistics class.
 
+    The median (and other quantiles) are exact when the samples are
+    stored. Otherwise, a streaming mode summarizes the samples into a
+    QuantileSketch, which gives approximate quantiles in bounded
+    memory. Statistics computed on different parts of the data (e.g.
+    per thread) can be merged.
+
+    @code
+    Statistic<double> stat( false, 200 ); // streaming mode
+    for ( ... ) stat.addValue( v );
+    double median = stat.median();        // about 1% rank error
+    double p90 = stat.quantile( 0.9 );
+    @endcode
+
     Backported from [ImaGene](https://gforge.liris.cnrs.fr/projects/imagene). \cite Lachaud03b
     
     @see testStatistics.cpp
@@ -86,8 +100,16 @@ namespace DGtal
 
     /**
      * Constructor.
+     *
+     * @param storeSample when 'true', the samples are stored and the
+     * median is exact.
+     *
+     * @param sketchAccuracy when non zero and samples are not stored,
+     * the samples are summarized into a QuantileSketch with this
+     * accuracy parameter, so that median() and quantile() are
+     * available in bounded memory.
      */
-    Statistic(bool storeSample=false);
+    Statistic(bool storeSample=false, unsigned int sketchAccuracy=0);
 
     /**
      * Copy constructor.
@@ -119,6 +141,17 @@ namespace DGtal
      */
     Statistic operator+( const Statistic & other ) const;
 
+    /**
+     * Merges into self the statistics of another part of the samples
+     * of the same variable (typically computed by another
+     * thread). Same as operator+=. Stored samples (resp. quantile
+     * sketches) are merged if both objects store samples (resp. use a
+     * sketch), otherwise the median is no more available.
+     *
+     * @param other the object to merge.
+     */
+    void merge( const Statistic & other );
+
     /**
        @return an iterator on the first stored value (if storeSample was set).
     */
@@ -165,8 +198,9 @@ namespace DGtal
     
 
     /**
-     * Return the median value of the Statistic values. It can be given in two possible cases:
+     * Return the median value of the Statistic values. It can be given in three possible cases:
      * - if the the values are stored in the 'Statistic' objects (not always a good solution). (complexity: linear on average)
+     * - if the values are summarized in a quantile sketch (approximate value).
      * - if the values were first stored and computed by the function @ref terminate(). 
      *  @return the median value.
      * 
@@ -175,6 +209,22 @@ namespace DGtal
     
     Quantity median() ;
 
+    /**
+     * Return the quantile of order \a q of the Statistic values, i.e.
+     * the value of rank floor(q n) among the n sorted values. It is
+     * exact if the values are stored and approximate if they are
+     * summarized in a quantile sketch.
+     *
+     * @param q the order of the quantile, in [0,1].
+     * @return the quantile value.
+     */
+    Quantity quantile( double q );
+
+    /**
+     * @return 'true' if the samples are summarized in a quantile sketch.
+     */
+    bool isStreaming() const;
+
     
     /** 
      * Adds a new sample value [v].
@@ -209,7 +259,8 @@ namespace DGtal
      * Computes the median value of the statistics and switch to mode
      * which does not save the statistics samples (@ref
      * myStore_samples = false). Usefull only if the values are stored
-     * (specified in the the constructor) else it doest nothing.
+     * or summarized in a quantile sketch (specified in the the
+     * constructor) else it doest nothing.
      *
      * @see median, Statistic, myStore_samples
      */
@@ -284,6 +335,17 @@ namespace DGtal
      * Tells if values must be stored or not. 
      */
     bool myStoreSamples;
+
+    /**
+     * Tells if values are summarized in mySketch.
+     */
+    bool myUseSketch;
+
+    /**
+     * summary of the samples, for approximate quantiles in bounded
+     * memory (streaming mode).
+     */
+    QuantileSketch<Quantity> mySketch;
      
     
     /**
@@ -0,0 +1,300 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingHistogram.h
+ *
+ * Header file for module StreamingHistogram.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingHistogram_RECURSES)
+#error Recursive header files inclusion detected in StreamingHistogram.h
+#else // defined(StreamingHistogram_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingHistogram_RECURSES
+
+#if !defined StreamingHistogram_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingHistogram_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CEuclideanRing.h"
+#include "DGtal/math/Histogram.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamingHistogram
+  /**
+    Description of template class 'StreamingHistogram' <p>
+    \brief Aim: Represents a histogram with a fixed number of regular
+    bins, built in a single pass on values whose range is not known in
+    advance.
+
+    The first size() values are buffered to choose an initial range.
+    Afterwards, whenever a value falls outside the range, the width of
+    the bins is doubled and pairs of adjacent bins are merged, so that
+    the range doubles towards the value. Counts are never split
+    between bins, hence each value is counted in the bin of binner()
+    that contains it, as in a Histogram<Quantity> with this binner.
+    Memory is O(size()) whatever the number of values. Partial
+    histograms (e.g. computed by several threads) can be merged; the
+    merge is exact when they were initialized with the same range (see
+    init()), approximate otherwise (see merge()).
+
+    @code
+    StreamingHistogram<double> hist( 64 );
+    for ( ... ) hist.addValue( v );
+    hist.terminate();
+    for ( unsigned int i = 0; i < hist.size(); ++i )
+      std::cout << hist.binner().myMin + i * hist.binner().myWidth
+                << " " << hist.pdf( i ) << std::endl;
+    double median = hist.quantile( 0.5 );
+    @endcode
+
+    @tparam TQuantity any model of CEuclideanRing listed in
+    NumberTraits and that can be castToDouble.
+
+    @see Histogram, Statistic
+   */
+  template <typename TQuantity>
+  class StreamingHistogram
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( CEuclideanRing< TQuantity > ));
+
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TQuantity Quantity;
+    typedef StreamingHistogram< Quantity > Self;
+    typedef RegularBinner< Quantity > Binner;
+    typedef typename Binner::Bin Bin;
+    typedef DGtal::uint64_t Size;
+    typedef std::vector<Size> Container;
+    typedef Container::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param nbBins the number of bins, even and at least 2.
+     */
+    StreamingHistogram( Bin nbBins = 64 );
+
+    /**
+       The object is cleared (same number of bins), as if it has just
+       been created.
+    */
+    void clear();
+
+    /**
+       Fixes the initial range of the bins to [\a min, \a max]
+       instead of choosing it from the first values. The range still
+       grows if values fall outside.
+
+       @param min the lower bound of the first bin.
+       @param max the lower bound of the last bin.
+       @pre the histogram is empty, \a max > \a min.
+    */
+    void init( const Quantity & min, const Quantity & max );
+
+    /**
+       Add the quantity \a q to the histogram.
+       @param q any quantity.
+    */
+    void addValue( Quantity q );
+
+    /**
+       Add \a n times the quantity \a q to the histogram.
+       @param q any quantity.
+       @param n the number of occurrences of \a q.
+    */
+    void addValue( Quantity q, Size n );
+
+    /**
+       Add the quantities stored in range [it,itE) to the histogram.
+       @tparam TInputIterator any model of boost::InputIterator on Quantity.
+       @param it an iterator on the first element of the range [it,itE)
+       @param itE an iterator after the last element of the range [it,itE)
+    */
+    template <typename TInputIterator>
+    void addValues( TInputIterator it, TInputIterator itE );
+
+    /**
+       Adds the values of \a other to this histogram. Each bin of \a
+       other is added at its center, hence the result is exact when
+       both histograms were initialized with the same range (their
+       bins then match, or bins of \a other fall inside doubled bins
+       of this histogram). Otherwise the merge is approximate: a value
+       of \a other is counted as the center of its bin, which is at
+       most half a bin width of \a other away, so it may be counted
+       in a bin adjacent to the one of the exact histogram. Its
+       position is thus off by at most one bin width of \a other, and
+       so are the quantiles. terminate() must be called again
+       afterwards.
+
+       @param other any streaming histogram with the same number of bins.
+    */
+    void merge( const StreamingHistogram & other );
+
+    /**
+       Should be called when all values have been added.
+    */
+    void terminate();
+
+    /**
+       @return the regular binner corresponding to the current bins.
+       @pre terminate() must be called before (or more than size() values added).
+    */
+    Binner binner() const;
+
+    /**
+       @param q any quantity
+       @return the bin in which quantity \a q falls in the current bins.
+    */
+    Bin bin( Quantity q ) const;
+
+    /**
+       @return the number of bins.
+    */
+    Bin size() const;
+
+    /**
+       @return the total number of samples in the histogram, i.e. the number of added quantities.
+       @pre terminate() must be called before.
+    */
+    Size area() const;
+
+    /**
+       @param b any bin in 0 .. size()-1
+       @return the number of quantities in bin \a b.
+       @pre terminate() must be called before.
+    */
+    Size nb( Bin b ) const;
+
+    /**
+       @param b any bin in 0 .. size()-1
+       @return the total number of quantities in bins 0 to \a b (included).
+       @pre terminate() must be called before.
+    */
+    Size accumulation( Bin b ) const;
+
+    /**
+       @return the probability density function in the whole bin \a b (constant).
+       @pre terminate() must be called before.
+    */
+    double pdf( Bin b ) const;
+
+    /**
+       @return the cumulative distribution function at bin \a b.
+       @pre terminate() must be called before.
+    */
+    double cdf( Bin b ) const;
+
+    /**
+       Approximates the quantile of order \a q by linear interpolation
+       in the bin where the cumulative distribution function reaches \a q.
+
+       @param q the order of the quantile, in [0,1].
+       @return the approximate quantile.
+       @pre terminate() must be called before, area() > 0.
+    */
+    double quantile( double q ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The number of bins.
+    Bin myNb;
+    /// The lower bound of the first bin.
+    Quantity myOrigin;
+    /// The width of each bin.
+    Quantity myWidth;
+    /// Tells if the bins are fixed (myOrigin and myWidth are valid).
+    bool myHasBins;
+    /// The first values, until the bins are fixed.
+    std::vector< Quantity > myBuffer;
+    /// The histogram data.
+    Container myHistogram;
+    /// The cumulative histogram data.
+    Container myCumulativeHistogram;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /**
+       Fixes the bins from the range of the buffered values, and adds them.
+    */
+    void flush();
+
+    /**
+       Doubles the range of the bins until it contains \a q.
+       @param q any quantity.
+       @return the bin of \a q.
+    */
+    Bin extend( Quantity q );
+
+  }; // end of class StreamingHistogram
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StreamingHistogram'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StreamingHistogram' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TQuantity>
+  std::ostream&
+  operator<< ( std::ostream & out, const StreamingHistogram<TQuantity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/StreamingHistogram.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingHistogram_h
+
+#undef StreamingHistogram_RECURSES
+#endif // else defined(StreamingHistogram_RECURSES)
@@ -62,6 +62,16 @@ namespace DGtal
    *
    * The mesh object store explicitly each vertex and each face are represented with the list of point index.   
    *
+   * By default, each face is stored in its own vector of indices
+   * (FaceStorage). For large meshes (e.g. digital surfaces with
+   * millions of quads), the faces can be stored in a flat layout by
+   * setting the constructor parameter flatFaceStorage to true: all
+   * the indices are then stored in a single array, and the position
+   * of the first index of each face in a second array (offsets). The
+   * faces are then accessed with getFaceSize and getFaceIndices,
+   * which are valid in both layouts (FaceBegin and FaceEnd only
+   * apply to the default layout).
+   *
    * @note This class is a preliminary version of a mesh strucuture
    * (the method to access neigborhing facets or to a given facet are
    * not yet given)
@@ -126,8 +136,11 @@ namespace DGtal
      * If you want to include color in the Mesh object you have to set the constructor parameter saveFaceColor to true. 
      *
      * @param saveFaceColor used to memorize the color of a face (default= false) 
+     * @param flatFaceStorage when true, the faces are stored in a
+     * flat array of indices with offsets instead of a vector of
+     * MeshFace (default= false).
      */
-    Mesh(bool saveFaceColor=false);    
+    Mesh(bool saveFaceColor=false, bool flatFaceStorage=false);    
 
     /**
      * Constructor.
@@ -205,6 +218,27 @@ namespace DGtal
     * 
     **/    
     void addFace(const MeshFace &aFace, const DGtal::Color &aColor=DGtal::Color::White);
+
+   /**
+    * Add a face given from an array of vertex indices.
+    *
+    * @param indices the indices of the face vertices.
+    * @param nbIndices the number of vertices of the face.
+    * @param aColor the color of the face.
+    **/    
+    void addFace(const unsigned int *indices, unsigned int nbIndices,
+                 const DGtal::Color &aColor=DGtal::Color::White);
+
+    /**
+     * Reserves the memory needed to store some vertices and faces.
+     *
+     * @param nbVertices the expected number of vertices.
+     * @param nbFaces the expected number of faces.
+     * @param nbFaceIndices the expected total number of face indices
+     * (only used with the flat face storage).
+     **/
+    void reserve(unsigned int nbVertices, unsigned int nbFaces, 
+                 unsigned int nbFaceIndices=0);
     
    
     
@@ -219,11 +253,29 @@ namespace DGtal
     
     /**
      * Return a reference to a face of index i.
+     *
+     * @note with the flat face storage, the returned face is a copy
+     * kept in an internal buffer, valid until the next call: use
+     * getFaceSize and getFaceIndices instead.
+     *
      * @param i the index of the face.
      * @return the face of index i. 
      **/
     const MeshFace & getFace(unsigned int i) const;
 
+    /**
+     * @param i the index of the face.
+     * @return the number of vertices of the face of index i.
+     **/
+    unsigned int getFaceSize(unsigned int i) const;
+
+    /**
+     * @param i the index of the face.
+     * @return a pointer to the getFaceSize(i) vertex indices of the
+     * face of index i.
+     **/
+    const unsigned int * getFaceIndices(unsigned int i) const;
+
 
 
     /**
@@ -241,6 +293,12 @@ namespace DGtal
      **/
     bool isStoringFaceColors() const;
 
+    /**
+     * @return true if the Mesh is storing its faces in a flat array
+     * of indices.
+     **/
+    bool isStoringFlatFaces() const;
+
 
     /**
      * @return an iterator pointing to the first vertex of the mesh.  
@@ -265,12 +323,16 @@ namespace DGtal
     
     
     /**
-     * @return an iterator pointing to the first face of the mesh.  
+     * @return an iterator pointing to the first face of the mesh.
      *
+     * @pre the faces are not stored in a flat array (see
+     * isStoringFlatFaces): use nbFaces and getFace or getFaceIndices
+     * otherwise.
      **/
     
-    FaceStorage::iterator 
+    typename FaceStorage::const_iterator 
     FaceBegin() const {
+      ASSERT( ! myFlatFaceStorage );
       return myFaceList.begin();
     }
     
@@ -279,10 +341,12 @@ namespace DGtal
     /**
      * @return an iterator pointing after the end of the last face of the mesh.
      *
+     * @pre the faces are not stored in a flat array (see FaceBegin).
      **/
     
-    FaceStorage::const_iterator 
+    typename FaceStorage::const_iterator 
     FaceEnd() const {
+      ASSERT( ! myFlatFaceStorage );
       return myFaceList.end();
     }    
     
@@ -338,6 +402,15 @@ namespace DGtal
     ColorStorage myFaceColorList;
     bool mySaveFaceColor;
     DGtal::Color myDefaultColor;
+
+    bool myFlatFaceStorage;
+    /// Indices of all the faces (flat face storage).
+    std::vector<unsigned int> myFaceIndices;
+    /// Position of the first index of each face in myFaceIndices,
+    /// followed by the total number of indices (flat face storage).
+    std::vector<std::size_t> myFaceOffsets;
+    /// Buffer returned by getFace with the flat face storage.
+    mutable MeshFace myFaceBuffer;
     
 
     
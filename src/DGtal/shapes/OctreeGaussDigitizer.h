@@ -0,0 +1,317 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OctreeGaussDigitizer.h
+ *
+ * Header file for module OctreeGaussDigitizer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OctreeGaussDigitizer_RECURSES)
+#error Recursive header files inclusion detected in OctreeGaussDigitizer.h
+#else // defined(OctreeGaussDigitizer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OctreeGaussDigitizer_RECURSES
+
+#if !defined OctreeGaussDigitizer_h
+/** Prevents repeated inclusion of headers. */
+#define OctreeGaussDigitizer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  template <typename TSpace> class ImplicitBall;
+  template <typename TSpace> class ImplicitRoundedHyperCube;
+  template <typename TSpace> class ImplicitPolynomial3Shape;
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ShapeBoxOrientation
+  /**
+     Description of template class 'ShapeBoxOrientation' <p> \brief
+     Aim: Classifies a whole axis-aligned box with respect to some
+     Euclidean shape, for hierarchical digitizations.
+
+     The static method orientation( shape, lo, up ) returns INSIDE if
+     every point of the box [lo,up] is INSIDE the shape, OUTSIDE if
+     every point of the box is OUTSIDE, and ON when it cannot decide.
+     The default always answers ON. It is specialized for the implicit
+     shapes that provide a method boxOrientation() (ImplicitBall,
+     ImplicitRoundedHyperCube, ImplicitPolynomial3Shape). Other shapes
+     may specialize it as well.
+
+     @tparam TEuclideanShape a model of CEuclideanOrientedShape.
+   */
+  template <typename TEuclideanShape>
+  struct ShapeBoxOrientation
+  {
+    /**
+       @param shape any shape.
+       @param lo the lower corner of a box.
+       @param up the upper corner of a box.
+       @return ON, the box is not classified.
+    */
+    template <typename TRealPoint>
+    static Orientation orientation( const TEuclideanShape & /*shape*/,
+                                    const TRealPoint & /*lo*/,
+                                    const TRealPoint & /*up*/ )
+    {
+      return ON;
+    }
+  };
+
+  /// Specialization of ShapeBoxOrientation for ImplicitBall.
+  template <typename TSpace>
+  struct ShapeBoxOrientation< ImplicitBall<TSpace> >
+  {
+    template <typename TRealPoint>
+    static Orientation orientation( const ImplicitBall<TSpace> & shape,
+                                    const TRealPoint & lo,
+                                    const TRealPoint & up )
+    {
+      return shape.boxOrientation( lo, up );
+    }
+  };
+
+  /// Specialization of ShapeBoxOrientation for ImplicitRoundedHyperCube.
+  template <typename TSpace>
+  struct ShapeBoxOrientation< ImplicitRoundedHyperCube<TSpace> >
+  {
+    template <typename TRealPoint>
+    static Orientation orientation( const ImplicitRoundedHyperCube<TSpace> & shape,
+                                    const TRealPoint & lo,
+                                    const TRealPoint & up )
+    {
+      return shape.boxOrientation( lo, up );
+    }
+  };
+
+  /// Specialization of ShapeBoxOrientation for ImplicitPolynomial3Shape.
+  template <typename TSpace>
+  struct ShapeBoxOrientation< ImplicitPolynomial3Shape<TSpace> >
+  {
+    template <typename TRealPoint>
+    static Orientation orientation( const ImplicitPolynomial3Shape<TSpace> & shape,
+                                    const TRealPoint & lo,
+                                    const TRealPoint & up )
+    {
+      return shape.boxOrientation( lo, up );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OctreeGaussDigitizer
+  /**
+     Description of template class 'OctreeGaussDigitizer' <p> \brief
+     Aim: Computes the Gauss digitization of some Euclidean shape in a
+     bounding box, as GaussDigitizer does, without evaluating the
+     shape at every digital point.
+
+     The digital domain is recursively subdivided in halves along each
+     axis (an octree in 3D). Each box is classified with
+     ShapeBoxOrientation: boxes completely inside are added without
+     evaluation, boxes completely outside are dropped, and the other
+     ones are subdivided until their width is at most leafWidth(),
+     where points are evaluated one by one. Only a thin shell of
+     points around the boundary of the shape is thus evaluated, and
+     the digital set is the same as the one given by
+     Shapes::digitalShaper on the associated GaussDigitizer. For shapes
+     that do not specialize ShapeBoxOrientation, every point is
+     evaluated.
+
+     @code
+     ImplicitPolynomial3Shape<Z3i::Space> shape( P );
+     OctreeGaussDigitizer<Z3i::Space, ImplicitPolynomial3Shape<Z3i::Space> > dig;
+     dig.attach( shape );
+     dig.init( RealPoint( -2, -2, -2 ), RealPoint( 2, 2, 2 ), 0.01 );
+     Z3i::DigitalSet set( dig.getDomain() );
+     dig.digitize( set );
+     @endcode
+
+     @tparam TSpace the type of digital Space where the digitized
+     object lies.
+     @tparam TEuclideanShape a model of CEuclideanOrientedShape.
+
+     @see GaussDigitizer, ShapeBoxOrientation
+   */
+  template <typename TSpace, typename TEuclideanShape>
+  class OctreeGaussDigitizer
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealPoint RealVector;
+    typedef TEuclideanShape EuclideanShape;
+    typedef GaussDigitizer<Space, EuclideanShape> Digitizer;
+    typedef HyperRectDomain<Space> Domain;
+    typedef DGtal::uint64_t Size;
+
+    BOOST_CONCEPT_ASSERT(( CEuclideanOrientedShape<TEuclideanShape> ));
+
+    /**
+     * Constructor. The object is not valid.
+     * @param leafWidth the width of the boxes (in digital points)
+     * under which points are evaluated one by one, at least 1.
+     */
+    OctreeGaussDigitizer( Integer leafWidth = 4 );
+
+    /**
+       @param shape the digitizer now references the given shape.
+    */
+    void attach( const EuclideanShape & shape );
+
+    /**
+       Initializes the digital bounds of the digitizer so as to cover
+       at least the space specified by [xLow] and [xUp] (see
+       GaussDigitizer::init).
+
+       @param xLow Euclidean lower bound for the digitizer.
+       @param xUp Euclidean upper bound for the digitizer.
+       @param gridStep the grid step identical in every direction.
+    */
+    void init( const RealPoint & xLow, const RealPoint & xUp,
+               typename RealVector::Component gridStep );
+
+    /**
+       Initializes the digital bounds of the digitizer so as to cover
+       at least the space specified by [xLow] and [xUp] (see
+       GaussDigitizer::init).
+
+       @param xLow Euclidean lower bound for the digitizer.
+       @param xUp Euclidean upper bound for the digitizer.
+       @param gridSteps the grid steps in each direction.
+    */
+    void init( const RealPoint & xLow, const RealPoint & xUp,
+               const RealVector & gridSteps );
+
+    /**
+       @return the underlying (point-wise) Gauss digitizer.
+    */
+    const Digitizer & gaussDigitizer() const;
+
+    /**
+       @return the domain chosen for the digitizer.
+    */
+    Domain getDomain() const;
+
+    /**
+       @return the width of the boxes under which points are evaluated
+       one by one.
+    */
+    Integer leafWidth() const;
+
+    /**
+       Adds to the (perhaps non empty) set \a aSet the digital points
+       of the domain that are INSIDE or ON the shape.
+
+       @tparam TDigitalSet a model of CDigitalSet.
+       @param aSet the set (modified) which will contain the shape.
+    */
+    template <typename TDigitalSet>
+    void digitize( TDigitalSet & aSet ) const;
+
+    /**
+       @return the number of points evaluated one by one during the
+       last call to digitize().
+    */
+    Size nbEvaluations() const;
+
+    /**
+       @return the number of boxes classified during the last call to
+       digitize().
+    */
+    Size nbBoxes() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The referenced shape or 0 if not initialized.
+    const EuclideanShape* myEShape;
+    /// The point-wise digitizer, which also embeds the digital points.
+    Digitizer myDigitizer;
+    /// The width of the boxes evaluated point by point.
+    Integer myLeafWidth;
+    /// The number of point evaluations of the last digitization.
+    mutable Size myNbEvaluations;
+    /// The number of classified boxes of the last digitization.
+    mutable Size myNbBoxes;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Adds to \a aSet the points of box [lo,up] that are INSIDE or ON
+       the shape, recursively.
+    */
+    template <typename TDigitalSet>
+    void digitizeBox( TDigitalSet & aSet,
+                      const Point & lo, const Point & up ) const;
+
+  }; // end of class OctreeGaussDigitizer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OctreeGaussDigitizer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OctreeGaussDigitizer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TEuclideanShape>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OctreeGaussDigitizer<TSpace, TEuclideanShape> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/OctreeGaussDigitizer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OctreeGaussDigitizer_h
+
+#undef OctreeGaussDigitizer_RECURSES
+#endif // else defined(OctreeGaussDigitizer_RECURSES)
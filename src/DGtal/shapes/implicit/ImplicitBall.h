@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
@@ -110,6 +112,37 @@ namespace DGtal
           return ON;
     }
 
+    /**
+     * Classifies a whole axis-aligned box from the nearest and
+     * farthest points of the box to the center.
+     *
+     * @param lo the lower corner of the box.
+     * @param up the upper corner of the box.
+     *
+     * @return INSIDE if every point of the box is INSIDE, OUTSIDE if
+     * every point of the box is OUTSIDE, ON when undecided.
+     */
+    inline
+    Orientation boxOrientation(const RealPoint &lo, const RealPoint &up) const
+    {
+      RealPoint dmin, dmax;
+      for(Dimension i = 0; i < RealPoint::dimension; ++i)
+        {
+          const double a = std::abs( (double) ( lo[i] - myCenter[i] ) );
+          const double b = std::abs( (double) ( up[i] - myCenter[i] ) );
+          dmin[i] = ( lo[i] <= myCenter[i] && myCenter[i] <= up[i] )
+            ? 0.0 : std::min( a, b );
+          dmax[i] = std::max( a, b );
+        }
+      if ( myRadius - dmax.norm() > 0.0 )
+        return INSIDE;
+      else
+        if ( myRadius - dmin.norm() < 0.0 )
+          return OUTSIDE;
+        else
+          return ON;
+    }
+
     inline
     RealPoint getLowerBound() const
     {
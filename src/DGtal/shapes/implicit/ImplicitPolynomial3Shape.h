@@ -41,11 +41,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/BasicFunctors.h"
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial3.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +62,10 @@ namespace DGtal
    *
    * Model of CImplicitFunction
    *
+   * The polynomial and its gradient are evaluated through a
+   * CompiledMPolynomial3, built once in init(). Many points can be
+   * evaluated at once with evalValues() and evalGradients().
+   *
    * @tparam TSpace the Digital space definition.
    */
 
@@ -75,6 +81,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef CompiledMPolynomial3< Ring > CompiledPolynomial3;
     typedef Ring Value;
 
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -130,6 +137,20 @@ namespace DGtal
     */
     Orientation orientation(const RealPoint &aPoint) const;
 
+    /**
+       Classifies a whole axis-aligned box, by bounding the polynomial
+       with interval arithmetic (natural extension, then mean-value
+       form with the interval gradient). Bounds take into account the
+       rounding errors of point-wise evaluations.
+
+       @param lo the lower corner of the box.
+       @param up the upper corner of the box.
+
+       @return INSIDE if every point of the box is INSIDE, OUTSIDE if
+       every point of the box is OUTSIDE, ON when undecided.
+    */
+    Orientation boxOrientation( const RealPoint & lo, const RealPoint & up ) const;
+
     /**
        @param aPoint any point in the Euclidean space.
        @return the gradient vector of the polynomial at \a aPoint.
@@ -137,6 +158,38 @@ namespace DGtal
     inline
     RealVector gradient( const RealPoint &aPoint ) const;
 
+    /**
+       Evaluates the polynomial on a range of points, by batches.
+
+       @tparam TInputIterator any model of boost::InputIterator on RealPoint.
+       @tparam TOutputIterator any model of boost::OutputIterator on Value.
+       @param itb an iterator on the first point of the range.
+       @param ite an iterator after the last point of the range.
+       @param out the output iterator where the values are written.
+    */
+    template <typename TInputIterator, typename TOutputIterator>
+    void evalValues( TInputIterator itb, TInputIterator ite,
+                     TOutputIterator out ) const;
+
+    /**
+       Evaluates the gradient of the polynomial on a range of points,
+       by batches.
+
+       @tparam TInputIterator any model of boost::InputIterator on RealPoint.
+       @tparam TOutputIterator any model of boost::OutputIterator on RealVector.
+       @param itb an iterator on the first point of the range.
+       @param ite an iterator after the last point of the range.
+       @param out the output iterator where the gradient vectors are written.
+    */
+    template <typename TInputIterator, typename TOutputIterator>
+    void evalGradients( TInputIterator itb, TInputIterator ite,
+                        TOutputIterator out ) const;
+
+    /**
+       @return the compiled polynomial and gradient used for evaluations.
+    */
+    const CompiledPolynomial3 & compiledPolynomial() const;
+
 // ------------------------------------------------------------ Added by Anis Benyoub
 
     /**
@@ -217,6 +270,9 @@ namespace DGtal
     /// The 3-polynomial defining the implicit shape.
     Polynomial3 myPolynomial;
 
+    /// The polynomial and its gradient, flattened for fast evaluation.
+    CompiledPolynomial3 myCompiled;
+
     // Partial deriatives
     Polynomial3 myFx;
     Polynomial3 myFy;
@@ -251,6 +307,8 @@ namespace DGtal
 
   private:
 
+    /// Number of points gathered by evalValues() and evalGradients().
+    static const unsigned int BatchSize = 8192;
 
   }; // end of class ImplicitPolynomial3Shape
 
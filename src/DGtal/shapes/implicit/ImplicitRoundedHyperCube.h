@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -143,6 +145,39 @@ namespace DGtal
           return ON;
     }
 
+    /** 
+     * Classifies a whole axis-aligned box. The function is
+     * monotonous in the distance to the center along each axis,
+     * hence its extremal values on the box are exactly computed.
+     * 
+     * @param lo the lower corner of the box.
+     * @param up the upper corner of the box.
+     * 
+     * @return INSIDE if every point of the box is INSIDE, OUTSIDE if
+     * every point of the box is OUTSIDE, ON when undecided.
+     */
+    inline
+    Orientation boxOrientation(const RealPoint &lo, const RealPoint &up) const
+    {
+      double pmin = 0, pmax = 0;
+      for(Dimension i = 0; i < RealPoint::dimension; ++i)
+        {
+          const double a = std::abs( (double) ( lo[i] - myCenter[i] ) );
+          const double b = std::abs( (double) ( up[i] - myCenter[i] ) );
+          pmin += ( lo[i] <= myCenter[i] && myCenter[i] <= up[i] )
+            ? 0.0 : std::pow( std::min( a, b ), myPower );
+          pmax += std::pow( std::max( a, b ), myPower );
+        }
+      const double w = std::pow(myHalfWidth, myPower);
+      if ( w - pmax > 0.0 )
+        return INSIDE;
+      else
+        if ( w - pmin < 0.0 )
+          return OUTSIDE;
+        else
+          return ON;
+    }
+
 
     /** 
      * Returns the lower bound of the Shape bounding box.
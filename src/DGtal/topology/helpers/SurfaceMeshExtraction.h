@@ -0,0 +1,301 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfaceMeshExtraction.h
+ *
+ * Header file for module SurfaceMeshExtraction.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfaceMeshExtraction_RECURSES)
+#error Recursive header files inclusion detected in SurfaceMeshExtraction.h
+#else // defined(SurfaceMeshExtraction_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfaceMeshExtraction_RECURSES
+
+#if !defined SurfaceMeshExtraction_h
+/** Prevents repeated inclusion of headers. */
+#define SurfaceMeshExtraction_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/shapes/Mesh.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace details
+  {
+    /**
+     * Compares the indices of two points of a vector by comparing the
+     * points (used to sort the pointels of a bucket).
+     */
+    template <typename TPoint>
+    struct IndexedPointLess
+    {
+      const std::vector<TPoint> * points;
+      IndexedPointLess( const std::vector<TPoint> & thePoints ) : points( &thePoints ) {}
+      bool operator()( const std::size_t a, const std::size_t b ) const
+      {
+        return (*points)[ a ] < (*points)[ b ];
+      }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfaceMeshExtraction
+  /**
+   * Description of template class 'SurfaceMeshExtraction' <p>
+   * \brief Aim: Converts a 3D digital surface into an indexed Mesh,
+   * either primal (one quad per surfel, whose vertices are the
+   * pointels) or dual (one vertex per surfel, one face per closed
+   * umbrella, i.e. around each pointel, as in DigitalSurface::exportSurfaceAs3DOFF).
+   *
+   * For the primal mesh, the four pointels of each surfel are
+   * computed in parallel (OpenMP, if DGtal is compiled WITH_OPENMP)
+   * over chunks of surfels, then welded: the pointels are distributed
+   * into buckets by a hash of their Khalimsky coordinates, and each
+   * bucket is sorted and numbered independently. The resulting mesh
+   * does not depend on the number of threads. The quads are oriented
+   * so that their normal points outside the surface (i.e. away from
+   * the direct incident spel of each surfel).
+   *
+   * For the dual mesh, the umbrellas are computed in parallel, each
+   * thread with its own tracker on the surface: each closed face is
+   * output by the surfel of its representative state (see
+   * DigitalSurface::Face), hence exactly once. The faces are oriented
+   * outward too (i.e. in the reverse order of
+   * DigitalSurface::verticesAroundFace).
+   *
+   * Both meshes may be completed by per-vertex normal vectors given by
+   * a normal vector estimator (model of CNormalVectorEstimator) at
+   * each surfel: the normal of a pointel is the normalized sum of the
+   * normals of its incident surfels.
+   *
+   * Only the traversal of the surface is parallel: the embedders and
+   * the estimators are not supposed to be reentrant, hence they are
+   * evaluated sequentially.
+   *
+   * Example of typical use:
+   * @code
+   * typedef DigitalSurface< DigitalSetBoundary<KSpace, DigitalSet> > MyDigitalSurface;
+   * SurfaceMeshExtraction<MyDigitalSurface> extraction( digSurf );
+   * Mesh<RealPoint> mesh;
+   * extraction.primalMesh( mesh, CanonicCellEmbedder<KSpace>( K ) );
+   * @endcode
+   *
+   * @tparam TDigitalSurface any DigitalSurface of dimension 3 (e.g. on
+   * a DigitalSetBoundary, a SetOfSurfels or an implicit surface
+   * container), whose container can be read by several threads.
+   *
+   * @see testSurfaceMeshExtraction.cpp
+   */
+  template <typename TDigitalSurface>
+  class SurfaceMeshExtraction
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TDigitalSurface Surface;
+    typedef typename Surface::KSpace KSpace;
+    typedef typename Surface::Surfel Surfel;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Space::RealPoint RealPoint;
+    typedef typename KSpace::Space::RealVector RealVector;
+    typedef DGtal::Mesh<RealPoint> Mesh;
+
+    BOOST_STATIC_ASSERT(( KSpace::dimension == 3 ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aSurface the digital surface (referenced).
+     */
+    SurfaceMeshExtraction( const Surface & aSurface );
+
+    /**
+     * Destructor.
+     */
+    ~SurfaceMeshExtraction();
+
+    // ----------------------- Extraction services ------------------------------
+  public:
+
+    /**
+     * Appends the primal mesh of the surface to a mesh: one vertex per
+     * pointel (welded), one quad per surfel in the order of the surface.
+     *
+     * @param aMesh (returns) the mesh.
+     * @param anEmbedder any embedder of unsigned cells (e.g.
+     * CanonicCellEmbedder).
+     *
+     * @tparam TCellEmbedder any model of CCellEmbedder.
+     */
+    template <typename TCellEmbedder>
+    void primalMesh( Mesh & aMesh, const TCellEmbedder & anEmbedder ) const;
+
+    /**
+     * Appends the primal mesh of the surface to a mesh, and computes
+     * the normal vector of its vertices.
+     *
+     * @param aMesh (returns) the mesh.
+     * @param anEmbedder any embedder of unsigned cells (e.g.
+     * CanonicCellEmbedder).
+     * @param anEstimator a normal vector estimator on the surface.
+     * @param aNormals (returns) the normal vectors of the appended
+     * vertices, in the same order.
+     *
+     * @tparam TCellEmbedder any model of CCellEmbedder.
+     * @tparam TNormalEstimator any model of CNormalVectorEstimator.
+     */
+    template <typename TCellEmbedder, typename TNormalEstimator>
+    void primalMesh( Mesh & aMesh, const TCellEmbedder & anEmbedder,
+                     const TNormalEstimator & anEstimator,
+                     std::vector<RealVector> & aNormals ) const;
+
+    /**
+     * Appends the dual mesh of the surface to a mesh: one vertex per
+     * surfel in the order of the surface, one face per closed
+     * umbrella (open umbrellas, along the border of an open surface,
+     * are ignored).
+     *
+     * @param aMesh (returns) the mesh.
+     * @param anEmbedder any embedder of signed cells (e.g.
+     * CanonicSCellEmbedder).
+     *
+     * @tparam TSCellEmbedder any model of CSCellEmbedder.
+     */
+    template <typename TSCellEmbedder>
+    void dualMesh( Mesh & aMesh, const TSCellEmbedder & anEmbedder ) const;
+
+    /**
+     * Appends the dual mesh of the surface to a mesh, and computes the
+     * normal vector of its vertices (the estimated normal vector at
+     * each surfel).
+     *
+     * @param aMesh (returns) the mesh.
+     * @param anEmbedder any embedder of signed cells (e.g.
+     * CanonicSCellEmbedder).
+     * @param anEstimator a normal vector estimator on the surface.
+     * @param aNormals (returns) the normal vectors of the appended
+     * vertices, in the same order.
+     *
+     * @tparam TSCellEmbedder any model of CSCellEmbedder.
+     * @tparam TNormalEstimator any model of CNormalVectorEstimator.
+     */
+    template <typename TSCellEmbedder, typename TNormalEstimator>
+    void dualMesh( Mesh & aMesh, const TSCellEmbedder & anEmbedder,
+                   const TNormalEstimator & anEstimator,
+                   std::vector<RealVector> & aNormals ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The digital surface.
+    const Surface & mySurface;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    SurfaceMeshExtraction( const SurfaceMeshExtraction & other );
+    SurfaceMeshExtraction & operator=( const SurfaceMeshExtraction & other );
+
+    /**
+     * @param aPoint the Khalimsky coordinates of a cell.
+     * @return a hash value of the coordinates.
+     */
+    static DGtal::uint64_t hash( const Point & aPoint );
+
+    /**
+     * Computes the welded pointels of the surface.
+     *
+     * @param aSurfels (returns) the surfels, in the order of the surface.
+     * @param aPointels (returns) the Khalimsky coordinates of the
+     * distinct pointels.
+     * @param aQuads (returns) for each surfel, the indices of its 4
+     * pointels in aPointels, counterclockwise seen from outside.
+     */
+    void weldPointels( std::vector<Surfel> & aSurfels, std::vector<Point> & aPointels,
+                       std::vector<unsigned int> & aQuads ) const;
+
+    /**
+     * Computes the closed umbrellas of the surface.
+     *
+     * @param aSurfels (returns) the surfels, in the order of the surface.
+     * @param aFaces (returns) the indices in aSurfels of the surfels of
+     * each face, stored one after the other.
+     * @param anOffsets (returns) the index of the first surfel of each
+     * face in aFaces, followed by the size of aFaces.
+     */
+    void closedUmbrellas( std::vector<Surfel> & aSurfels,
+                          std::vector<unsigned int> & aFaces,
+                          std::vector<std::size_t> & anOffsets ) const;
+
+  }; // end of class SurfaceMeshExtraction
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfaceMeshExtraction'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfaceMeshExtraction' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurface>
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfaceMeshExtraction<TDigitalSurface> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/SurfaceMeshExtraction.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfaceMeshExtraction_h
+
+#undef SurfaceMeshExtraction_RECURSES
+#endif // else defined(SurfaceMeshExtraction_RECURSES)
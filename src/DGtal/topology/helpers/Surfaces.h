@@ -770,6 +770,53 @@ namespace DGtal
                          const PointPredicate & pp,
                          const Point & aLowerBound, 
                          const Point & aUpperBound  );
+
+    /**
+       Creates a set of unsigned surfels whose elements represents all
+       the boundary components of a digital set stored as runs (see
+       DigitalSetByRuns). Instead of testing every point of a bounding
+       box, the boundary is extracted run by run: along the first axis
+       each run has two surfels, along the other axes the run is
+       compared with the runs of the neighboring rows. The complexity
+       is thus in the number of runs and of boundary surfels, not in
+       the size of the domain. Points outside the domain of the set
+       are considered as outside the shape.
+
+       @tparam CellSet a model of a set of Cell (e.g., std::set<Cell>).
+       @tparam RunSet a digital set stored as runs (e.g. DigitalSetByRuns).
+
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of [aRunSet].
+
+       @param aKSpace any space containing the domain of the set.
+       @param aRunSet the digital set.
+    */
+    template <typename CellSet, typename RunSet >
+    static
+    void uMakeBoundaryFromRuns( CellSet & aBoundary,
+                                const KSpace & aKSpace,
+                                const RunSet & aRunSet );
+
+    /**
+       Creates a set of signed surfels whose elements represents all
+       the boundary components of a digital set stored as runs (see
+       DigitalSetByRuns), run by run as in uMakeBoundaryFromRuns. The
+       surfels are oriented as in sMakeBoundary.
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam RunSet a digital set stored as runs (e.g. DigitalSetByRuns).
+
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of [aRunSet].
+
+       @param aKSpace any space containing the domain of the set.
+       @param aRunSet the digital set.
+    */
+    template <typename SCellSet, typename RunSet >
+    static
+    void sMakeBoundaryFromRuns( SCellSet & aBoundary,
+                                const KSpace & aKSpace,
+                                const RunSet & aRunSet );
     
 
     
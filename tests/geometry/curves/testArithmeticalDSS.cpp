@@ -815,6 +815,9 @@ int main( int argc, char** argv )
 
   //main operators
   bool res = mainTest<DGtal::ArithmeticalDSS<DGtal::int32_t> >()
+#ifdef WITH_INT128
+    && mainTest<DGtal::ArithmeticalDSS<DGtal::int64_t, DGtal::int128_t, 4> >()
+#endif
 #ifdef WITH_BIGINTEGER
     && mainTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::BigInteger, 4> >()
 #endif
@@ -900,6 +903,9 @@ int main( int argc, char** argv )
 
   res = res
     && updateTest<DGtal::ArithmeticalDSS<DGtal::int32_t> >()
+#ifdef WITH_INT128
+    && updateTest<DGtal::ArithmeticalDSS<DGtal::int64_t, DGtal::int128_t, 4> >()
+#endif
 #ifdef WITH_BIGINTEGER
     && updateTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::BigInteger, 4> >()
 #endif
@@ -907,6 +913,9 @@ int main( int argc, char** argv )
 
   res = res
     && constructorsTest<DGtal::ArithmeticalDSS<DGtal::int32_t> >()
+#ifdef WITH_INT128
+    && constructorsTest<DGtal::ArithmeticalDSS<DGtal::int64_t, DGtal::int128_t, 4> >()
+#endif
 #ifdef WITH_BIGINTEGER
     && constructorsTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::BigInteger, 4> >()
 #endif
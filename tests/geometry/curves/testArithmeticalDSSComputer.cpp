@@ -41,6 +41,7 @@
 #include <cmath>
 #include <fstream>
 #include <vector>
+#include <cstdlib>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
@@ -467,6 +468,120 @@ void testArithmeticalDSSComputerConceptChecking()
 }
 
 
+/**
+ * Builds a simply 4- or 8-connected digital curve made of
+ * long pieces of digital straight lines of random slopes
+ * and random directions.
+ */
+template <typename Point>
+void randomPolygonalCurve( std::vector<Point>& aCurve, unsigned int aNbPieces, 
+                           unsigned short anAdjacency, unsigned int aSeed )
+{
+  srand( aSeed );
+  Point p( 0, 0 );
+  aCurve.push_back( p ); 
+  for ( unsigned int i = 0; i < aNbPieces; ++i )
+    {
+      //slope a/b in the first octant, direction given by the signs and the swap
+      int b = 1 + rand() % 50; 
+      int a = rand() % (b+1); 
+      int mu = rand() % b; 
+      int sx = ( rand() % 2 ) ? 1 : -1; 
+      int sy = ( rand() % 2 ) ? 1 : -1; 
+      bool swap = ( rand() % 2 ) == 0; 
+      int length = 1 + rand() % 200; 
+      for ( int x = 0; x < length; ++x )
+        {
+          int dy = ( a * (x+1) + mu ) / b - ( a * x + mu ) / b; 
+          Point steps[ 2 ] = { Point( 1, 0 ), Point( 0, dy ) }; 
+          unsigned int nbSteps = 1; 
+          if ( dy != 0 )
+            {
+              if ( anAdjacency == 4 ) 
+                nbSteps = 2; 
+              else
+                steps[ 0 ] = Point( 1, 1 ); 
+            }
+          for ( unsigned int k = 0; k < nbSteps; ++k )
+            {
+              Point step( sx * steps[ k ][ 0 ], sy * steps[ k ][ 1 ] ); 
+              if ( swap ) 
+                step = Point( step[ 1 ], step[ 0 ] ); 
+              p += step; 
+              aCurve.push_back( p ); 
+            }
+        }
+    }
+}
+
+/**
+ * Checks that the batch extension of the DSS computers
+ * gives the same DSS as the point by point extension.
+ */
+template <unsigned short adjacency>
+bool testBatchExtension()
+{
+  typedef PointVector<2,int> Point;
+  typedef std::vector<Point>::const_iterator Iterator;
+  typedef ArithmeticalDSSComputer<Iterator,int,adjacency> Computer;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock("Batch extension");
+  trace.info() << adjacency << "-connected curves" << std::endl; 
+
+  for ( unsigned int seed = 1; seed <= 10; ++seed )
+    {
+      std::vector<Point> curve; 
+      randomPolygonalCurve( curve, 50, adjacency, seed ); 
+      unsigned int nbDSS = 0, nbEqual = 0; 
+      for ( unsigned int i = 0; i < curve.size(); i += 7, ++nbDSS )
+        {
+          Iterator it = curve.begin() + i; 
+          //point by point extension
+          Computer c1; 
+          c1.init( it ); 
+          unsigned int n1 = 0; 
+          while ( (c1.end() != curve.end())
+                  &&(c1.extendFront()) ) 
+            ++n1; 
+
+          //batch extension
+          Computer c2; 
+          c2.init( it ); 
+          unsigned int n0 = c2.isExtendableFront( curve.end() ); 
+          unsigned int n2 = c2.extendFront( curve.end() ); 
+
+          if ( (c1 == c2) && (c1.primitive() == c2.primitive())
+               && (n0 == n1) && (n2 == n1) && c2.isValid() )
+            ++nbEqual; 
+        }
+      nbok += ( nbEqual == nbDSS ) ? 1 : 0; 
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << nbEqual << "/" << nbDSS << " DSS, "
+                   << curve.size() << " points" << std::endl;
+    }
+
+  //batch extension stops at the given end 
+  std::vector<Point> curve; 
+  for ( int x = 0; x < 10; ++x )
+    curve.push_back( Point( x, 0 ) ); 
+  Computer c; 
+  c.init( curve.begin() ); 
+  nbok += ( (c.extendFront( curve.begin() + 1 ) == 0)
+            && (c.extendFront( curve.begin() + 5 ) == 4)
+            && (c.end() == curve.begin() + 5) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "extension up to a given end" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 int main(int argc, char **argv)
 {
 
@@ -489,6 +604,8 @@ int main(int argc, char **argv)
     && testBIGINTEGER()
 #endif
     && testIsInside()
+    && testBatchExtension<4>()
+    && testBatchExtension<8>()
     ;
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
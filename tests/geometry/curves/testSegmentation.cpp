@@ -35,6 +35,7 @@
 #include <cmath>
 #include <fstream>
 #include <vector>
+#include <list>
 #include <iostream>
 #include <iterator>
 
@@ -935,6 +936,77 @@ bool SaturatedSegmentationTest()
   return (compteur == 4295);
 }
 
+/**
+ * Checks that the greedy and saturated segmentations
+ * are the same for a random access range, whose maximal
+ * extensions are batched, and a bidirectional one.
+ */
+bool batchExtensionSegmentationTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+  typedef PointVector<2,Coordinate> Point; 
+
+  std::string filename = testPath + "samples/BigBall2.fc";
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+
+  vector<Point> vPts; 
+  vPts.assign(fc.begin(),fc.end()); 
+  list<Point> lPts; 
+  lPts.assign(fc.begin(),fc.end()); 
+
+  typedef ArithmeticalDSSComputer<vector<Point>::const_iterator,Coordinate,4> VectorComputer;
+  typedef ArithmeticalDSSComputer<list<Point>::const_iterator,Coordinate,4> ListComputer;
+
+  trace.beginBlock("Segmentations with batch extension");
+  trace.info() << filename << endl;
+
+  unsigned int nbok = 0; 
+  unsigned int nb = 0; 
+
+  //greedy segmentation
+  {
+    typedef GreedySegmentation<VectorComputer> VectorSegmentation;
+    typedef GreedySegmentation<ListComputer> ListSegmentation;
+    VectorSegmentation vs(vPts.begin(), vPts.end(), VectorComputer()); 
+    ListSegmentation ls(lPts.begin(), lPts.end(), ListComputer()); 
+    VectorSegmentation::SegmentComputerIterator vit = vs.begin(); 
+    ListSegmentation::SegmentComputerIterator lit = ls.begin(); 
+    unsigned int n = 0, nbEqual = 0; 
+    for ( ; (vit != vs.end())&&(lit != ls.end()); ++vit, ++lit, ++n )
+      if ( vit->primitive() == lit->primitive() ) 
+        ++nbEqual;
+    nbok += ( (vit == vs.end())&&(lit == ls.end())&&(nbEqual == n) ) ? 1 : 0; 
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << nbEqual << "/" << n << " equal greedy segments" << endl;
+  }
+
+  //saturated segmentation
+  {
+    typedef SaturatedSegmentation<VectorComputer> VectorSegmentation;
+    typedef SaturatedSegmentation<ListComputer> ListSegmentation;
+    VectorSegmentation vs(vPts.begin(), vPts.end(), VectorComputer()); 
+    ListSegmentation ls(lPts.begin(), lPts.end(), ListComputer()); 
+    VectorSegmentation::SegmentComputerIterator vit = vs.begin(); 
+    ListSegmentation::SegmentComputerIterator lit = ls.begin(); 
+    unsigned int n = 0, nbEqual = 0; 
+    for ( ; (vit != vs.end())&&(lit != ls.end()); ++vit, ++lit, ++n )
+      if ( vit->primitive() == lit->primitive() ) 
+        ++nbEqual;
+    nbok += ( (vit == vs.end())&&(lit == ls.end())&&(nbEqual == n) ) ? 1 : 0; 
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << nbEqual << "/" << n << " equal maximal segments" << endl;
+  }
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -951,6 +1023,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& batchExtensionSegmentationTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
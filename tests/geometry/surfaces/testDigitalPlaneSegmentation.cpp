@@ -0,0 +1,254 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalPlaneSegmentation.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class DigitalPlaneSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/DigitalPlaneSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DigitalSetBoundary<KSpace, DigitalSet> Boundary;
+typedef DigitalSurface<Boundary> MyDigitalSurface;
+typedef COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> COBAComputer;
+typedef ChordGenericNaivePlaneComputer<Z3, Point, DGtal::int64_t> ChordComputer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalPlaneSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the outward normal of a surfel.
+ */
+RealVector trivialNormal( const KSpace & K, const SCell & s )
+{
+  RealVector n = RealVector::zero;
+  const Dimension k = K.sOrthDir( s );
+  n[ k ] = K.sDirect( s, k ) ? -1.0 : 1.0;
+  return n;
+}
+
+/**
+ * Checks that a greedy segmentation is a partition of the surface
+ * into outward oriented naive planes.
+ */
+template <typename Segmentation>
+bool checkPartition( const KSpace & K, const Segmentation & segmentation,
+                     const typename Segmentation::PlaneComputer & prototype )
+{
+  typedef typename Segmentation::PlaneComputer PlaneComputer;
+  const std::vector<unsigned int> & planes = segmentation.planes();
+  const unsigned int nbPlanes = segmentation.nbPlanes();
+  std::vector< std::vector<Point> > points( nbPlanes );
+  std::vector<RealVector> outwards( nbPlanes, RealVector::zero );
+  for ( unsigned int i = 0; i < segmentation.size(); ++i )
+    {
+      if ( planes[ i ] >= nbPlanes
+           || segmentation.normals()[ i ] != segmentation.planeNormals()[ planes[ i ] ] )
+        return false;
+      points[ planes[ i ] ].push_back( segmentation.point( i ) );
+      outwards[ planes[ i ] ] += trivialNormal( K, segmentation.surfels()[ i ] );
+    }
+  for ( unsigned int p = 0; p < nbPlanes; ++p )
+    {
+      PlaneComputer computer( prototype );
+      const RealVector & n = segmentation.planeNormals()[ p ];
+      if ( points[ p ].empty() || ! computer.extend( points[ p ].begin(), points[ p ].end() )
+           || std::fabs( n.norm() - 1.0 ) > 1e-9 || n.dot( outwards[ p ] ) <= 0.0 )
+        return false;
+    }
+  return true;
+}
+
+bool testGreedySegmentation()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Greedy segmentation of a box ..." );
+  Domain domain( Point::diagonal( -2 ), Point( 14, 10, 8 ) );
+  DigitalSet aBox( domain );
+  for ( Domain::ConstIterator it = Domain( Point( 0, 0, 0 ), Point( 12, 8, 6 ) ).begin(),
+          itend = Domain( Point( 0, 0, 0 ), Point( 12, 8, 6 ) ).end(); it != itend; ++it )
+    aBox.insertNew( *it );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  MyDigitalSurface aSurface( new Boundary( K, aBox ) );
+
+  COBAComputer prototype;
+  prototype.init( 40, 1, 1 );
+  DigitalPlaneSegmentation<MyDigitalSurface, COBAComputer> segmentation( aSurface, prototype );
+  nbok += segmentation.isValid() && segmentation.size() == aSurface.size() ? 1 : 0; nb++;
+  for ( unsigned int i = 0; i < segmentation.size(); i += 17 )
+    nbok += segmentation.index( segmentation.surfels()[ i ] ) == i ? 1 : 0, nb++;
+
+  const unsigned int nbPlanes = segmentation.greedySegmentation( 8 );
+  trace.info() << segmentation << std::endl;
+  nbok += checkPartition( K, segmentation, prototype ) ? 1 : 0; nb++;
+  // Each face of the box is mostly one plane, along its outward normal.
+  std::vector<unsigned int> sizes( nbPlanes, 0 );
+  for ( unsigned int i = 0; i < segmentation.size(); ++i )
+    ++sizes[ segmentation.planes()[ i ] ];
+  unsigned int nbFaces = 0;
+  for ( unsigned int p = 0; p < nbPlanes; ++p )
+    if ( sizes[ p ] >= 20 )
+      {
+        const RealVector & n = segmentation.planeNormals()[ p ];
+        nbFaces += std::fabs( std::fabs( n[ 0 ] ) + std::fabs( n[ 1 ] ) + std::fabs( n[ 2 ] ) - 1.0 ) < 1e-9 ? 1 : 0;
+      }
+  nbok += nbFaces == 6 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbPlanes << " planes, " << nbFaces << " faces" << std::endl;
+
+  // The same segmentation, whatever the number of seeds.
+  std::vector<unsigned int> planes8 = segmentation.planes();
+  segmentation.greedySegmentation( 1 );
+  nbok += checkPartition( K, segmentation, prototype ) ? 1 : 0; nb++;
+  segmentation.greedySegmentation( 8 );
+  nbok += segmentation.planes() == planes8 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "segmentation is a partition into planes" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Greedy segmentation of a ball ..." );
+  Domain domain2( Point::diagonal( -12 ), Point::diagonal( 12 ) );
+  DigitalSet aBall( domain2 );
+  Shapes<Domain>::addNorm2Ball( aBall, Point( 0, 0, 0 ), 10 );
+  KSpace K2;
+  K2.init( domain2.lowerBound(), domain2.upperBound(), true );
+  MyDigitalSurface aSphere( new Boundary( K2, aBall ) );
+  ChordComputer prototype2;
+  prototype2.init( 1, 1 );
+  DigitalPlaneSegmentation<MyDigitalSurface, ChordComputer> segmentation2( aSphere, prototype2 );
+  segmentation2.greedySegmentation( 16 );
+  trace.info() << segmentation2 << std::endl;
+  nbok += checkPartition( K2, segmentation2, prototype2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "segmentation is a partition into planes" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testMaximalPlanes()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Maximal planes on a ball ..." );
+  Domain domain( Point::diagonal( -12 ), Point::diagonal( 12 ) );
+  DigitalSet aBall( domain );
+  Shapes<Domain>::addNorm2Ball( aBall, Point( 0, 0, 0 ), 10 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  MyDigitalSurface aSurface( new Boundary( K, aBall ) );
+  COBAComputer prototype;
+  prototype.init( 40, 1, 1 );
+  DigitalPlaneSegmentation<MyDigitalSurface, COBAComputer> segmentation( aSurface, prototype );
+  segmentation.maximalPlanes();
+
+  // Normals are outward, and close to the ones of the sphere.
+  double minDot = 1.0;
+  double meanDot = 0.0;
+  for ( unsigned int i = 0; i < segmentation.size(); ++i )
+    {
+      RealVector u( segmentation.point( i )[ 0 ], segmentation.point( i )[ 1 ],
+                    segmentation.point( i )[ 2 ] );
+      const double dot = segmentation.normals()[ i ].dot( u / u.norm() );
+      minDot = std::min( minDot, dot );
+      meanDot += dot / segmentation.size();
+    }
+  nbok += minDot > 0.0 && meanDot > 0.95 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "min dot=" << minDot << " mean dot=" << meanDot << std::endl;
+
+  // Radii are the ones of a breadth-first traversal.
+  typedef BreadthFirstVisitor<MyDigitalSurface> Visitor;
+  unsigned int nbRadii = 0;
+  for ( unsigned int i = 0; i < segmentation.size(); i += 13 )
+    {
+      std::vector<Point> points;
+      COBAComputer computer( prototype );
+      unsigned int radius = 0;
+      Visitor visitor( aSurface, segmentation.surfels()[ i ] );
+      while ( ! visitor.finished() )
+        {
+          Visitor::Node node = visitor.current();
+          if ( node.second > radius )
+            {
+              if ( ! computer.extend( points.begin(), points.end() ) ) break;
+              radius = node.second;
+              points.clear();
+            }
+          points.push_back( segmentation.point( segmentation.index( node.first ) ) );
+          visitor.expand();
+        }
+      if ( visitor.finished() && computer.extend( points.begin(), points.end() ) )
+        ++radius;
+      nbRadii += segmentation.radii()[ i ] + 1 == radius ? 1 : 0;
+    }
+  nbok += nbRadii == ( segmentation.size() + 12 ) / 13 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "radii are maximal" << std::endl;
+
+  segmentation.maximalPlanes( 2 );
+  nbok += *std::max_element( segmentation.radii().begin(), segmentation.radii().end() ) == 2
+    && segmentation.nbPlanes() == 0 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "radii are bounded" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalPlaneSegmentation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testGreedySegmentation() && testMaximalPlanes(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
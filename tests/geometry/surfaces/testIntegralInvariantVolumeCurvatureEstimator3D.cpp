@@ -0,0 +1,366 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIntegralInvariantVolumeCurvatureEstimator3D.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing classes IntegralInvariantVolumeMeanCurvatureEstimator,
+ * IntegralInvariantVolumeGaussianCurvatureEstimator, SummedVolumeBallConvolver
+ * and FFTBallConvolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/FunctorOnCells.h"
+#include "DGtal/graph/DepthFirstVisitor.h"
+#include "DGtal/graph/GraphVisitorRange.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMeanCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantGaussianCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeMeanCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeGaussianCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/FFTBallConvolver.h"
+#include "DGtal/kernel/BasicPointFunctors.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef Z3i::Space::RealPoint RealPoint;
+typedef Z3i::KSpace::Surfel Surfel;
+typedef ImplicitBall<Z3i::Space> ImplicitShape;
+typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+typedef DigitalSurface< Boundary > MyDigitalSurface;
+typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+typedef GraphVisitorRange< Visitor > VisitorRange;
+typedef VisitorRange::ConstIterator VisitorConstIterator;
+typedef PointFunctorFromPointPredicateAndDomain< DigitalShape, Z3i::Domain, unsigned int > MyPointFunctor;
+typedef FunctorOnCells< MyPointFunctor, Z3i::KSpace > MySpelFunctor;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IntegralInvariantVolumeMeanCurvatureEstimator.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Compares the mean and Gaussian curvatures given by the estimators
+ * using SummedVolumeBallConvolver with the ones given by the
+ * estimators using DigitalSurfaceConvolver, on a ball.
+ */
+bool testIntegralInvariantVolumeCurvatureEstimator3D( double h )
+{
+  typedef IntegralInvariantMeanCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIMeanEstimator;
+  typedef IntegralInvariantVolumeMeanCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIVolumeMeanEstimator;
+  typedef IntegralInvariantGaussianCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIGaussianEstimator;
+  typedef IntegralInvariantVolumeGaussianCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIVolumeGaussianEstimator;
+  typedef MyIIMeanEstimator::Quantity Quantity;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  double re = 3;
+  double radius = 5;
+
+  trace.beginBlock ( "Initialisation of shape ..." );
+
+  ImplicitShape ishape( RealPoint( 0, 0, 0 ), radius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint( -10.0, -10.0, -10.0 ), RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  Z3i::Domain domain = dshape.getDomain();
+  MyPointFunctor pointFunctor( dshape, domain, 1, 0 );
+  MySpelFunctor functor( pointFunctor, K );
+
+  trace.endBlock();
+
+  trace.beginBlock( "Mean curvature: DigitalSurfaceConvolver vs SummedVolumeBallConvolver" );
+
+  MyIIMeanEstimator meanEstimator( K, functor );
+  meanEstimator.init( h, re );
+  MyIIVolumeMeanEstimator volumeMeanEstimator( K, functor );
+  volumeMeanEstimator.init( h, re );
+  trace.info() << volumeMeanEstimator << std::endl;
+
+  std::vector< Quantity > meanResults, volumeMeanResults;
+  std::back_insert_iterator< std::vector< Quantity > > meanIt( meanResults );
+  std::back_insert_iterator< std::vector< Quantity > > volumeMeanIt( volumeMeanResults );
+  {
+    VisitorRange range( new Visitor( surf, *surf.begin() ));
+    meanEstimator.eval( range.begin(), range.end(), meanIt );
+  }
+  {
+    VisitorRange range( new Visitor( surf, *surf.begin() ));
+    volumeMeanEstimator.eval( range.begin(), range.end(), volumeMeanIt );
+  }
+
+  double maxDiff = 0.0;
+  for ( unsigned int i = 0; i < meanResults.size(); ++i )
+    maxDiff = std::max( maxDiff, std::abs( meanResults[ i ] - volumeMeanResults[ i ] ));
+  trace.info() << "#surfels=" << meanResults.size() << " max |diff|=" << maxDiff << std::endl;
+  ++nb; nbok += ( meanResults.size() != 0 && meanResults.size() == volumeMeanResults.size() ) ? 1 : 0;
+  ++nb; nbok += ( maxDiff < 1e-10 ) ? 1 : 0;
+
+  {
+    VisitorRange range( new Visitor( surf, *surf.begin() ));
+    VisitorConstIterator it = range.begin();
+    double diff = std::abs( meanEstimator.eval( it ) - volumeMeanEstimator.eval( it ));
+    trace.info() << "single surfel |diff|=" << diff << std::endl;
+    ++nb; nbok += ( diff < 1e-10 ) ? 1 : 0;
+  }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Gaussian curvature: DigitalSurfaceConvolver vs SummedVolumeBallConvolver" );
+
+  MyIIGaussianEstimator gaussianEstimator( K, functor );
+  gaussianEstimator.init( h, re );
+  MyIIVolumeGaussianEstimator volumeGaussianEstimator( K, functor );
+  volumeGaussianEstimator.init( h, re );
+
+  std::vector< Quantity > gaussianResults, volumeGaussianResults;
+  std::back_insert_iterator< std::vector< Quantity > > gaussianIt( gaussianResults );
+  std::back_insert_iterator< std::vector< Quantity > > volumeGaussianIt( volumeGaussianResults );
+  {
+    VisitorRange range( new Visitor( surf, *surf.begin() ));
+    gaussianEstimator.eval( range.begin(), range.end(), gaussianIt );
+  }
+  {
+    VisitorRange range( new Visitor( surf, *surf.begin() ));
+    volumeGaussianEstimator.eval( range.begin(), range.end(), volumeGaussianIt );
+  }
+
+  maxDiff = 0.0;
+  double mean = 0.0;
+  for ( unsigned int i = 0; i < gaussianResults.size(); ++i )
+    {
+      maxDiff = std::max( maxDiff, std::abs( gaussianResults[ i ] - volumeGaussianResults[ i ] ));
+      mean += volumeGaussianResults[ i ];
+    }
+  mean /= volumeGaussianResults.size();
+  trace.info() << "#surfels=" << gaussianResults.size() << " max |diff|=" << maxDiff
+               << " mean=" << mean << " expected=" << 1.0 / ( radius * radius ) << std::endl;
+  ++nb; nbok += ( gaussianResults.size() == volumeGaussianResults.size() ) ? 1 : 0;
+  ++nb; nbok += ( maxDiff < 1e-6 ) ? 1 : 0;
+  ++nb; nbok += ( std::abs( mean - 1.0 / ( radius * radius )) < 0.01 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Principal curvatures: batched vs single surfel eigen decompositions" );
+  {
+    typedef MyIIVolumeGaussianEstimator::PrincipalCurvatures PrincipalCurvatures;
+    std::vector< PrincipalCurvatures > principalResults;
+    std::back_insert_iterator< std::vector< PrincipalCurvatures > > principalIt( principalResults );
+    VisitorRange range( new Visitor( surf, *surf.begin() ));
+    volumeGaussianEstimator.evalPrincipalCurvatures( range.begin(), range.end(), principalIt );
+
+    VisitorRange range2( new Visitor( surf, *surf.begin() ));
+    double maxCurvatureDiff = 0.0;
+    double maxNormalDiff = 0.0;
+    unsigned int i = 0;
+    for ( VisitorConstIterator it = range2.begin(), itend = range2.end(); it != itend; ++it, ++i )
+      {
+        PrincipalCurvatures single = volumeGaussianEstimator.evalPrincipalCurvatures( it );
+        maxCurvatureDiff = std::max( maxCurvatureDiff, std::abs( single.k1 - principalResults[ i ].k1 ));
+        maxCurvatureDiff = std::max( maxCurvatureDiff, std::abs( single.k2 - principalResults[ i ].k2 ));
+        // The normal direction (first eigen vector) is defined up to its sign.
+        double dot = 0.0;
+        for ( unsigned int k = 0; k < 3; ++k )
+          dot += single.vectors( k, 0 ) * principalResults[ i ].vectors( k, 0 );
+        maxNormalDiff = std::max( maxNormalDiff, 1.0 - std::abs( dot ));
+      }
+    trace.info() << "#surfels=" << principalResults.size() << " max |diff| k1,k2=" << maxCurvatureDiff
+                 << " max 1-|n.n'|=" << maxNormalDiff << std::endl;
+    ++nb; nbok += ( principalResults.size() == gaussianResults.size() ) ? 1 : 0;
+    ++nb; nbok += ( maxCurvatureDiff < 1e-8 && maxNormalDiff < 1e-10 ) ? 1 : 0;
+  }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "SummedVolumeBallConvolver vs FFTBallConvolver" );
+  {
+    typedef FFTBallConvolver< MySpelFunctor, Z3i::KSpace > MyFFTConvolver;
+    typedef IntegralInvariantVolumeMeanCurvatureEstimator< Z3i::KSpace, MySpelFunctor, MyFFTConvolver > MyFFTMeanEstimator;
+    typedef IntegralInvariantVolumeGaussianCurvatureEstimator< Z3i::KSpace, MySpelFunctor, MyFFTConvolver > MyFFTGaussianEstimator;
+
+    MyFFTMeanEstimator fftMeanEstimator( K, functor );
+    fftMeanEstimator.init( h, re );
+    trace.info() << fftMeanEstimator << std::endl;
+    MyFFTGaussianEstimator fftGaussianEstimator( K, functor );
+    fftGaussianEstimator.init( h, re );
+
+    std::vector< Quantity > fftMeanResults, fftGaussianResults;
+    std::back_insert_iterator< std::vector< Quantity > > fftMeanIt( fftMeanResults );
+    std::back_insert_iterator< std::vector< Quantity > > fftGaussianIt( fftGaussianResults );
+    {
+      VisitorRange range( new Visitor( surf, *surf.begin() ));
+      fftMeanEstimator.eval( range.begin(), range.end(), fftMeanIt );
+    }
+    {
+      VisitorRange range( new Visitor( surf, *surf.begin() ));
+      fftGaussianEstimator.eval( range.begin(), range.end(), fftGaussianIt );
+    }
+
+    double maxMeanDiff = 0.0;
+    double maxGaussianDiff = 0.0;
+    for ( unsigned int i = 0; i < fftMeanResults.size(); ++i )
+      {
+        maxMeanDiff = std::max( maxMeanDiff, std::abs( fftMeanResults[ i ] - volumeMeanResults[ i ] ));
+        maxGaussianDiff = std::max( maxGaussianDiff, std::abs( fftGaussianResults[ i ] - volumeGaussianResults[ i ] ));
+      }
+    trace.info() << "max |diff| mean=" << maxMeanDiff << " gaussian=" << maxGaussianDiff << std::endl;
+    ++nb; nbok += ( fftMeanResults.size() == volumeMeanResults.size() ) ? 1 : 0;
+    ++nb; nbok += ( maxMeanDiff < 1e-10 ) ? 1 : 0;
+    ++nb; nbok += ( maxGaussianDiff < 1e-10 ) ? 1 : 0;
+  }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Multi-scale evaluation" );
+  {
+    typedef FFTBallConvolver< MySpelFunctor, Z3i::KSpace > MyFFTConvolver;
+    typedef IntegralInvariantVolumeMeanCurvatureEstimator< Z3i::KSpace, MySpelFunctor, MyFFTConvolver > MyFFTMeanEstimator;
+    typedef IntegralInvariantVolumeGaussianCurvatureEstimator< Z3i::KSpace, MySpelFunctor, MyFFTConvolver > MyFFTGaussianEstimator;
+
+    std::vector< double > radii;
+    radii.push_back( re - 1.0 );
+    radii.push_back( re - 0.5 );
+    radii.push_back( re );
+
+    MyIIVolumeMeanEstimator scalesMeanEstimator( K, functor );
+    scalesMeanEstimator.init( h, radii );
+    MyIIVolumeGaussianEstimator scalesGaussianEstimator( K, functor );
+    scalesGaussianEstimator.init( h, radii );
+    MyFFTMeanEstimator fftScalesMeanEstimator( K, functor );
+    fftScalesMeanEstimator.init( h, radii );
+    MyFFTGaussianEstimator fftScalesGaussianEstimator( K, functor );
+    fftScalesGaussianEstimator.init( h, radii );
+    trace.info() << scalesMeanEstimator << std::endl;
+
+    std::vector< std::vector< Quantity > > meanScales, gaussianScales, fftMeanScales, fftGaussianScales;
+    std::back_insert_iterator< std::vector< std::vector< Quantity > > > meanScalesIt( meanScales );
+    std::back_insert_iterator< std::vector< std::vector< Quantity > > > gaussianScalesIt( gaussianScales );
+    std::back_insert_iterator< std::vector< std::vector< Quantity > > > fftMeanScalesIt( fftMeanScales );
+    std::back_insert_iterator< std::vector< std::vector< Quantity > > > fftGaussianScalesIt( fftGaussianScales );
+    {
+      VisitorRange range( new Visitor( surf, *surf.begin() ));
+      scalesMeanEstimator.evalScales( range.begin(), range.end(), meanScalesIt );
+    }
+    {
+      VisitorRange range( new Visitor( surf, *surf.begin() ));
+      scalesGaussianEstimator.evalScales( range.begin(), range.end(), gaussianScalesIt );
+    }
+    {
+      VisitorRange range( new Visitor( surf, *surf.begin() ));
+      fftScalesMeanEstimator.evalScales( range.begin(), range.end(), fftMeanScalesIt );
+    }
+    {
+      VisitorRange range( new Visitor( surf, *surf.begin() ));
+      fftScalesGaussianEstimator.evalScales( range.begin(), range.end(), fftGaussianScalesIt );
+    }
+    ++nb; nbok += ( meanScales.size() == meanResults.size() && gaussianScales.size() == meanResults.size()
+                    && fftMeanScales.size() == meanResults.size() && fftGaussianScales.size() == meanResults.size() ) ? 1 : 0;
+
+    // Each scale is compared with a single-radius estimation.
+    for ( unsigned int s = 0; s < radii.size(); ++s )
+      {
+        MyIIMeanEstimator singleMeanEstimator( K, functor );
+        singleMeanEstimator.init( h, radii[ s ] );
+        MyIIVolumeGaussianEstimator singleGaussianEstimator( K, functor );
+        singleGaussianEstimator.init( h, radii[ s ] );
+        std::vector< Quantity > singleMean, singleGaussian;
+        std::back_insert_iterator< std::vector< Quantity > > singleMeanIt( singleMean );
+        std::back_insert_iterator< std::vector< Quantity > > singleGaussianIt( singleGaussian );
+        {
+          VisitorRange range( new Visitor( surf, *surf.begin() ));
+          singleMeanEstimator.eval( range.begin(), range.end(), singleMeanIt );
+        }
+        {
+          VisitorRange range( new Visitor( surf, *surf.begin() ));
+          singleGaussianEstimator.eval( range.begin(), range.end(), singleGaussianIt );
+        }
+
+        double maxMeanDiff = 0.0;
+        double maxGaussianDiff = 0.0;
+        for ( unsigned int i = 0; i < singleMean.size() && i < meanScales.size(); ++i )
+          {
+            maxMeanDiff = std::max( maxMeanDiff, std::abs( meanScales[ i ][ s ] - singleMean[ i ] ));
+            maxMeanDiff = std::max( maxMeanDiff, std::abs( fftMeanScales[ i ][ s ] - singleMean[ i ] ));
+            maxGaussianDiff = std::max( maxGaussianDiff, std::abs( gaussianScales[ i ][ s ] - singleGaussian[ i ] ));
+            maxGaussianDiff = std::max( maxGaussianDiff, std::abs( fftGaussianScales[ i ][ s ] - singleGaussian[ i ] ));
+          }
+        trace.info() << "r=" << radii[ s ] << " max |diff| mean=" << maxMeanDiff
+                     << " gaussian=" << maxGaussianDiff << std::endl;
+        ++nb; nbok += ( maxMeanDiff < 1e-10 ) ? 1 : 0;
+        ++nb; nbok += ( maxGaussianDiff < 1e-10 ) ? 1 : 0;
+      }
+  }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Reinitialisation with another radius" );
+  volumeMeanEstimator.init( h, re + 1.0 );
+  MyIIMeanEstimator meanEstimator2( K, functor );
+  meanEstimator2.init( h, re + 1.0 );
+  {
+    VisitorRange range( new Visitor( surf, *surf.begin() ));
+    VisitorConstIterator it = range.begin();
+    double diff = std::abs( meanEstimator2.eval( it ) - volumeMeanEstimator.eval( it ));
+    trace.info() << "single surfel |diff|=" << diff << std::endl;
+    ++nb; nbok += ( diff < 1e-10 ) ? 1 : 0;
+  }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class IntegralInvariantVolumeCurvatureEstimator3D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << std::endl;
+
+  bool res = testIntegralInvariantVolumeCurvatureEstimator3D( 0.5 ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -68,6 +68,14 @@ using namespace Z3i;
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for testing class LocalConvolutionNormalVectorEstimator.
 ///////////////////////////////////////////////////////////////////////////////
+
+/// Convolution weights that are all null.
+struct NullConvolutionWeights
+{
+    typedef DGtal::uint64_t Distance;
+    double operator() ( const Distance & ) const { return 0.0; }
+};
+
 /**
  * Example of a test. To be completed.
  *
@@ -180,6 +188,89 @@ bool testLocalConvolutionNormalVectorEstimator ( int /*argc*/, char**/*argv*/ )
     return true;
 }
 
+/**
+ * Compares the multi-scale normals with the single scale ones.
+ *
+ */
+bool testMultiScaleLocalConvolutionNormalVectorEstimator ( int /*argc*/, char**/*argv*/ )
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock ( "Set up digital surface." );
+    std::string filename = testPath + "samples/cat10.vol";
+    typedef ImageSelector < Z3i::Domain, int>::Type Image;
+    Image image = VolReader<Image>::importVol ( filename );
+    DigitalSet set3d ( image.domain() );
+    SetFromImage<DigitalSet>::append<Image> ( set3d, image,
+            0,256 );
+    KSpace ks;
+    if ( !ks.init ( image.domain().lowerBound(),
+                    image.domain().upperBound(), true ) )
+    {
+        trace.error() << "Error in the Khamisky space construction."<<std::endl;
+        return false;
+    }
+    typedef SurfelAdjacency<KSpace::dimension> MySurfelAdjacency;
+    MySurfelAdjacency surfAdj ( true ); // interior in all directions.
+    typedef LightImplicitDigitalSurface<KSpace, DigitalSet >
+      MyDigitalSurfaceContainer;
+    typedef DigitalSurface<MyDigitalSurfaceContainer> MyDigitalSurface;
+    SCell bel = Surfaces<KSpace>::findABel ( ks, set3d, 100000 );
+    MyDigitalSurfaceContainer* ptrSurfContainer =
+        new MyDigitalSurfaceContainer ( ks, set3d, surfAdj, bel );
+    MyDigitalSurface digSurf ( ptrSurfContainer ); // acquired
+    trace.endBlock();
+
+    deprecated::GaussianConvolutionWeights < MyDigitalSurface::Size > Gkernel ( 4.0 );
+    typedef deprecated::LocalConvolutionNormalVectorEstimator  < MyDigitalSurface,
+                                                                 deprecated::GaussianConvolutionWeights< MyDigitalSurface::Size>  > MyGaussianEstimator;
+    MyGaussianEstimator myNormalEstimatorG ( digSurf, Gkernel );
+
+    trace.beginBlock ( "Multi-scale gaussian convoluted normals." );
+    std::vector<unsigned int> radii;
+    radii.push_back ( 2 );
+    radii.push_back ( 3 );
+    radii.push_back ( 5 );
+    myNormalEstimatorG.init ( 1.0, radii );
+    std::vector< std::vector<MyGaussianEstimator::Quantity> > allScales;
+    myNormalEstimatorG.evalScales ( digSurf.begin(), digSurf.end(),
+                                    std::back_inserter ( allScales ) );
+    double maxDiff = 0.0;
+    for ( unsigned int r = 0; r < radii.size(); ++r )
+    {
+        MyGaussianEstimator singleEstimator ( digSurf, Gkernel );
+        singleEstimator.init ( 1.0, radii[ r ] );
+        unsigned int j = 0;
+        for ( MyDigitalSurface::ConstIterator its = digSurf.begin(), itsend = digSurf.end();
+              its != itsend; ++its, ++j )
+            maxDiff = std::max ( maxDiff, ( singleEstimator.eval ( its ) - allScales[ j ][ r ] ).norm() );
+    }
+    trace.info() << "#surfels=" << allScales.size() << " max |diff|=" << maxDiff << std::endl;
+    nbok += ( allScales.size() == digSurf.size() && maxDiff < 1e-10 ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "evalScales() == eval() at each radius" << std::endl;
+    trace.endBlock();
+
+    trace.beginBlock ( "Null kernel." );
+    typedef deprecated::LocalConvolutionNormalVectorEstimator
+      < MyDigitalSurface, NullConvolutionWeights > MyNullEstimator;
+    NullConvolutionWeights nullKernel;
+    MyNullEstimator myNullEstimator ( digSurf, nullKernel );
+    myNullEstimator.init ( 1.0, radii );
+    std::vector<MyNullEstimator::Quantity> nullNormals;
+    myNullEstimator.evalScales ( *digSurf.begin(), std::back_inserter ( nullNormals ) );
+    nbok += ( nullNormals.size() == radii.size()
+              && nullNormals[ 0 ] == MyNullEstimator::Quantity() ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "null kernel gives null vectors " << nullNormals[ 0 ] << std::endl;
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -191,7 +282,8 @@ int main ( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testLocalConvolutionNormalVectorEstimator ( argc,argv ); // && ... other tests
+    bool res = testLocalConvolutionNormalVectorEstimator ( argc,argv )
+      && testMultiScaleLocalConvolutionNormalVectorEstimator ( argc,argv ); // && ... other tests
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
 
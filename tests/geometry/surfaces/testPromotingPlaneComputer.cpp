@@ -0,0 +1,176 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPromotingPlaneComputer.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class PromotingPlaneComputer, and plane
+ * computers with native 128-bit integers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/PromotingPlaneComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SpaceND<3, DGtal::int64_t> Space;
+typedef Space::Point Point;
+typedef Space::RealVector RealVector;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PromotingPlaneComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the point of the naive plane 0 <= a*x + b*y + c*z < c
+ * above (x,y), with c > max(|a|,|b|).
+ */
+Point naivePoint( DGtal::int64_t a, DGtal::int64_t b, DGtal::int64_t c,
+                  DGtal::int64_t x, DGtal::int64_t y )
+{
+  const DGtal::int64_t r = -( a * x + b * y );
+  const DGtal::int64_t z = ( r >= 0 ) ? ( r + c - 1 ) / c : -( -r / c );
+  return Point( x, y, z );
+}
+
+#if defined(WITH_INT128) || defined(WITH_BIGINTEGER)
+#ifdef WITH_INT128
+typedef DGtal::int128_t BigScalar;
+#else
+typedef DGtal::BigInteger BigScalar;
+#endif
+
+bool testPromotingPlaneComputer()
+{
+  typedef ChordGenericNaivePlaneComputer<Space, Point, DGtal::int64_t> FastComputer;
+  typedef ChordGenericNaivePlaneComputer<Space, Point, BigScalar> SafeComputer;
+  typedef PromotingPlaneComputer<FastComputer, SafeComputer> PlaneComputer;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Promotion of a Chord plane computer ..." );
+  FastComputer fast;
+  fast.init( 1, 1 );
+  SafeComputer safe;
+  safe.init( 1, 1 );
+  PlaneComputer plane( fast, safe, 440000000 );
+  SafeComputer reference( safe );
+
+  // A cluster of small points, then a far cluster of the same plane.
+  std::vector<Point> small, far;
+  for ( DGtal::int64_t x = -5; x <= 5; ++x )
+    for ( DGtal::int64_t y = -5; y <= 5; ++y )
+      {
+        small.push_back( naivePoint( 2, -3, 7, x, y ) );
+        far.push_back( naivePoint( 2, -3, 7, 1000000000 + 3 * x, -2000000000 + 2 * y ) );
+      }
+  bool ok = true;
+  for ( std::size_t i = 0; i < small.size(); ++i )
+    ok = ok && plane.extend( small[ i ] ) && reference.extend( small[ i ] );
+  nbok += ok && ! plane.isPromoted() && plane.size() == small.size() ? 1 : 0; nb++;
+  nbok += plane.isExtendable( far[ 0 ] ) && ! plane.isPromoted() ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "small points use int64_t" << std::endl;
+
+  nbok += plane.extend( far[ 0 ] ) && reference.extend( far[ 0 ] ) && plane.isPromoted()
+    && plane.computer().empty() && plane.size() == small.size() + 1 ? 1 : 0; nb++;
+  nbok += plane.extend( far.begin() + 1, far.end() )
+    && reference.extend( far.begin() + 1, far.end() ) && plane.isValid() ? 1 : 0; nb++;
+  const Point off = far[ 5 ] + Point( 0, 0, 1 );
+  nbok += ! plane.isExtendable( off ) && ! plane.extend( off )
+    && ! reference.isExtendable( off ) ? 1 : 0; nb++;
+  RealVector n;
+  plane.getUnitNormal( n );
+  const RealVector u( 2.0, -3.0, 7.0 );
+  nbok += std::fabs( n.dot( u ) / u.norm() ) > 1.0 - 1e-9
+    && plane.size() == reference.size() ? 1 : 0; nb++;
+  trace.info() << plane << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "far points promote the computer" << std::endl;
+
+  plane.clear();
+  nbok += ! plane.isPromoted() && plane.empty() && plane.extend( small[ 0 ] ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "clear() goes back to int64_t" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+#endif
+
+#ifdef WITH_INT128
+bool testCOBAInt128()
+{
+  typedef COBAGenericNaivePlaneComputer<Space, DGtal::int128_t> PlaneComputer;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "COBA plane computer with int128_t ..." );
+  // int64_t is limited to diameters of about 500.
+  PlaneComputer plane;
+  plane.init( 40000, 1, 1 );
+  std::vector<Point> points;
+  for ( DGtal::int64_t x = 0; x <= 20; ++x )
+    for ( DGtal::int64_t y = 0; y <= 20; ++y )
+      points.push_back( naivePoint( 97, -89, 101, 1000 * x + y, 997 * y - x ) );
+  nbok += plane.extend( points.begin(), points.end() ) ? 1 : 0; nb++;
+  nbok += ! plane.isExtendable( points[ 17 ] + Point( 0, 0, 1 ) ) ? 1 : 0; nb++;
+  RealVector n;
+  plane.getNormal( n );
+  trace.info() << plane.primitive() << " normal=" << n << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "diameter 20000" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PromotingPlaneComputer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = true
+#if defined(WITH_INT128) || defined(WITH_BIGINTEGER)
+    && testPromotingPlaneComputer()
+#endif
+#ifdef WITH_INT128
+    && testCOBAInt128()
+#endif
+    ; // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,176 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkSphericalAccumulator.cpp
+ * @ingroup Tests
+ *
+ * Benchmark of SphericalAccumulator on random unit normals: bin
+ * lookup with trigonometric functions (previous implementation,
+ * reproduced here) versus the precomputed bin bounds, and
+ * direction by direction accumulation versus addDirections.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/tools/SphericalAccumulator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+/////// Micro Bench
+
+typedef Z3i::RealVector Vector;
+typedef SphericalAccumulator<Vector> Accumulator;
+
+/**
+ * @return @a aNb random unit normals, uniformly distributed
+ * on the sphere (normalized gaussian vectors).
+ */
+std::vector<Vector> randomNormals( const unsigned int aNb )
+{
+  srand( 0 );
+  std::vector<Vector> normals( aNb );
+  for ( unsigned int i = 0; i < aNb; ++i )
+    {
+      Vector n;
+      do
+        {
+          for ( unsigned int k = 0; k < 3; ++k )
+            {
+              //Box-Muller transform
+              const double u = ( rand() + 1.0 ) / ( RAND_MAX + 2.0 );
+              const double v = rand() / ( RAND_MAX + 1.0 );
+              n[ k ] = sqrt( -2.0 * log( u ) ) * cos( 2.0 * M_PI * v );
+            }
+        }
+      while ( n.norm() == 0.0 );
+      normals[ i ] = n.getNormalized();
+    }
+  return normals;
+}
+
+/**
+ * Bin coordinates computed with trigonometric functions (previous
+ * implementation of SphericalAccumulator::binCoordinates).
+ */
+void trigBinCoordinates( const unsigned int aNphi, const Vector &aDir,
+                         unsigned int &posPhi, unsigned int &posTheta )
+{
+  double norm = aDir.norm();
+  double phi = acos( aDir[2]/norm );
+  double dphi = M_PI/(double)(aNphi-1);
+  posPhi = static_cast<unsigned int>(floor( (phi+dphi/2.) *(aNphi-1)/  M_PI));
+  if(posPhi == 0 || posPhi== (aNphi-1))
+    posTheta = 0;
+  else
+    {
+      double theta = atan2( aDir[1], aDir[0] );
+      if(aDir[1]<0)
+        theta += 2.0*M_PI;
+      double Nthetai = floor(2.0*(aNphi)*sin(posPhi*dphi));
+      double dtheta = 2.0*M_PI/(Nthetai);
+      posTheta = static_cast<unsigned int>(floor( (theta+dtheta/2.0)/dtheta));
+      if (posTheta >= Nthetai)
+        posTheta -= Nthetai;
+    }
+}
+
+static void BM_TrigBinCoordinates(benchmark::State& state)
+{
+  const std::vector<Vector> normals = randomNormals( 1 << 16 );
+  while (state.KeepRunning())
+    {
+      unsigned int sum = 0;
+      for ( unsigned int i = 0; i < normals.size(); ++i )
+        {
+          unsigned int posPhi, posTheta;
+          trigBinCoordinates( state.range_x(), normals[ i ], posPhi, posTheta );
+          sum += posPhi + posTheta;
+        }
+      benchmark::DoNotOptimize( sum );
+    }
+  state.SetItemsProcessed( state.iterations() * normals.size() );
+}
+BENCHMARK(BM_TrigBinCoordinates)->Range(1<<3 , 1 << 9);
+
+static void BM_BinCoordinates(benchmark::State& state)
+{
+  const std::vector<Vector> normals = randomNormals( 1 << 16 );
+  Accumulator accumulator( state.range_x() );
+  while (state.KeepRunning())
+    {
+      unsigned int sum = 0;
+      for ( unsigned int i = 0; i < normals.size(); ++i )
+        {
+          Accumulator::Size posPhi, posTheta;
+          accumulator.binCoordinates( normals[ i ], posPhi, posTheta );
+          sum += posPhi + posTheta;
+        }
+      benchmark::DoNotOptimize( sum );
+    }
+  state.SetItemsProcessed( state.iterations() * normals.size() );
+}
+BENCHMARK(BM_BinCoordinates)->Range(1<<3 , 1 << 9);
+
+static void BM_AddDirection(benchmark::State& state)
+{
+  const std::vector<Vector> normals = randomNormals( state.range_x() );
+  while (state.KeepRunning())
+    {
+      Accumulator accumulator( 64 );
+      for ( unsigned int i = 0; i < normals.size(); ++i )
+        accumulator.addDirection( normals[ i ] );
+      benchmark::DoNotOptimize( accumulator.samples() );
+    }
+  state.SetItemsProcessed( state.iterations() * normals.size() );
+}
+BENCHMARK(BM_AddDirection)->Range(1<<10 , 1 << 22);
+
+static void BM_AddDirections(benchmark::State& state)
+{
+  const std::vector<Vector> normals = randomNormals( state.range_x() );
+  while (state.KeepRunning())
+    {
+      Accumulator accumulator( 64 );
+      accumulator.addDirections( normals.begin(), normals.end() );
+      benchmark::DoNotOptimize( accumulator.samples() );
+    }
+  state.SetItemsProcessed( state.iterations() * normals.size() );
+}
+BENCHMARK(BM_AddDirections)->Range(1<<10 , 1 << 22);
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  const char*argv[] )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cstdlib>
+#include <list>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/tools/SphericalAccumulator.h"
@@ -199,6 +202,147 @@ bool testSphericalMoreIntegerDir()
   return nbok == nb;
 }
 
+
+/**
+ * Bin coordinates computed with trigonometric functions, as in the
+ * first implementation of SphericalAccumulator.
+ */
+template <typename Vector>
+void trigBinCoordinates( const unsigned int aNphi, const Vector &aDir,
+                         unsigned int &posPhi, unsigned int &posTheta )
+{
+  double norm = aDir.norm();
+  double phi = acos( aDir[2]/norm );
+  double dphi = M_PI/(double)(aNphi-1);
+  posPhi = static_cast<unsigned int>(floor( (phi+dphi/2.) *(aNphi-1)/  M_PI));
+  if(posPhi == 0 || posPhi== (aNphi-1))
+    posTheta = 0;
+  else
+    {
+      double theta = atan2( aDir[1], aDir[0] );
+      if(aDir[1]<0)
+        theta += 2.0*M_PI;
+      double Nthetai = floor(2.0*(aNphi)*sin(posPhi*dphi));
+      double dtheta = 2.0*M_PI/(Nthetai);
+      posTheta = static_cast<unsigned int>(floor( (theta+dtheta/2.0)/dtheta));
+      if (posTheta >= Nthetai)
+        posTheta -= Nthetai;
+    }
+}
+
+bool testSphericalBinCoordinates()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing bin coordinates without trigonometry ..." );
+  
+  typedef Z3i::RealVector Vector;
+  typedef SphericalAccumulator<Vector>::Size Size;
+  srand( 0 );
+  const unsigned int nphis[ 4 ] = { 3, 6, 10, 37 };
+  for ( unsigned int k = 0; k < 4; ++k )
+    {
+      SphericalAccumulator<Vector> accumulator( nphis[ k ] );
+      unsigned int nbEqual = 0;
+      const unsigned int nbDirs = 100000;
+      for ( unsigned int i = 0; i < nbDirs; ++i )
+        {
+          Vector dir( rand() / (double) RAND_MAX - 0.5,
+                      rand() / (double) RAND_MAX - 0.5,
+                      rand() / (double) RAND_MAX - 0.5 );
+          if ( i % 10 == 0 ) 
+            dir[ i % 3 ] = 0.0; 
+          if ( dir.norm() == 0.0 ) 
+            dir[ 2 ] = 1.0;
+          Size posPhi, posTheta;
+          unsigned int refPhi, refTheta;
+          accumulator.binCoordinates( dir, posPhi, posTheta );
+          trigBinCoordinates( nphis[ k ], dir, refPhi, refTheta );
+          if ( ( posPhi == refPhi ) && ( posTheta == refTheta ) )
+            ++nbEqual;
+        }
+      nbok += ( nbEqual == nbDirs ) ? 1 : 0; 
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "Nphi=" << nphis[ k ] << ": " << nbEqual << "/" << nbDirs 
+                   << " bins as with trigonometry" << std::endl;
+    }
+
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
+bool testSphericalMerge()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing merge and addDirections ..." );
+  
+  typedef Z3i::Vector Vector;
+  typedef SphericalAccumulator<Vector>::Size Size;
+  std::vector<Vector> directions;
+  srand( 0 );
+  for ( unsigned int i = 0; i < 50000; ++i )
+    {
+      Vector dir( rand() % 21 - 10, rand() % 21 - 10, rand() % 21 - 10 );
+      if ( dir != Vector::zero )
+        directions.push_back( dir );
+    }
+  //a peak, so that the maximal bin is unique
+  for ( unsigned int i = 0; i < 1000; ++i )
+    directions.push_back( Vector( 1, 2, 3 ) );
+
+  SphericalAccumulator<Vector> reference( 12 );
+  for ( std::vector<Vector>::const_iterator it = directions.begin(), itend = directions.end();
+        it != itend; ++it )
+    reference.addDirection( *it );
+  
+  //two halves
+  SphericalAccumulator<Vector> first( 12 ), second( 12 );
+  std::vector<Vector>::const_iterator itmid = directions.begin() + directions.size() / 3;
+  for ( std::vector<Vector>::const_iterator it = directions.begin(); it != itmid; ++it )
+    first.addDirection( *it );
+  for ( std::vector<Vector>::const_iterator it = itmid, itend = directions.end(); it != itend; ++it )
+    second.addDirection( *it );
+  first.merge( second );
+
+  //! [SphericalAccum-addDirections]
+  SphericalAccumulator<Vector> bulk( 12 );
+  bulk.addDirections( directions.begin(), directions.end() );
+  //! [SphericalAccum-addDirections]
+
+  //forward iterators
+  std::list<Vector> listDirections( directions.begin(), directions.end() );
+  SphericalAccumulator<Vector> bulkList( 12 );
+  bulkList.addDirections( listDirections.begin(), listDirections.end() );
+  
+  SphericalAccumulator<Vector>* accumulators[ 3 ] = { &first, &bulk, &bulkList };
+  for ( unsigned int k = 0; k < 3; ++k )
+    {
+      bool same = ( accumulators[ k ]->samples() == reference.samples() );
+      for ( SphericalAccumulator<Vector>::ConstIterator it = reference.begin(), 
+              it2 = accumulators[ k ]->begin(), itend = reference.end();
+            it != itend; ++it, ++it2 )
+        same = same && ( *it == *it2 ) 
+          && ( reference.representativeDirection( it ) 
+               == accumulators[ k ]->representativeDirection( it2 ) );
+      Size i, j, i2, j2;
+      reference.maxCountBin( i, j );
+      accumulators[ k ]->maxCountBin( i2, j2 );
+      nbok += ( same && ( i == i2 ) && ( j == j2 ) ) ? 1 : 0; 
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "merge, addDirections (random access and forward)" << std::endl;
+  trace.info() << bulk << std::endl;
+
+  trace.endBlock();
+  
+  return nbok == nb;
+}
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -211,7 +355,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testSphericalAccumulator() && testSphericalMore()
-    && testSphericalMoreIntegerDir();
+    && testSphericalMoreIntegerDir()
+    && testSphericalBinCoordinates() && testSphericalMerge();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,190 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreDistanceTransformation.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class OutOfCoreDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OutOfCoreDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the squared distances with the ones of
+ * DistanceTransformation, with slabs of several widths and an
+ * in-memory output image.
+ */
+template <typename Space>
+bool testOutOfCoreDistanceTransformation( const typename Space::Point & upper )
+{
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef ImageContainerBySTLVector<Domain, int> Image;
+  typedef SimpleThresholdForegroundPredicate<Image> Predicate;
+  typedef ExactPredicateLpSeparableMetric<Space, 2> L2Metric;
+  typedef DistanceTransformation<Space, Predicate, L2Metric> DT;
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint32_t> SquaredImage;
+  typedef OutOfCoreDistanceTransformation<Space, Predicate, SquaredImage> OOCDT;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing OutOfCoreDistanceTransformation against DistanceTransformation ..." );
+
+  Domain domain( Point::diagonal(0), upper );
+  Image image( domain );
+  srand( 3 );
+  for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    image.setValue( *it, ( rand() % 100 ) < 97 ? 1 : 0 );
+  Predicate predicate( image, 0 );
+
+  L2Metric l2;
+  DT dt( &domain, &predicate, &l2 );
+
+  const unsigned int widths[] = { 1, 3, 1000 };
+  for ( unsigned int w = 0; w < 3; ++w )
+    {
+      SquaredImage squared( domain );
+      OOCDT oocdt( domain, predicate, squared, widths[ w ] );
+      trace.info() << oocdt << std::endl;
+
+      bool ok = true;
+      for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+        {
+          const double d = dt( *it );
+          ok = ok && ( squared( *it ) == (DGtal::uint32_t) floor( d * d + 0.5 ) );
+        }
+      ++nb; nbok += ok ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "slab width " << widths[ w ] << ": squared DT == DT^2" << std::endl;
+    }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Computes the distances into a TiledImage with a two tiles cache, and
+ * checks the points without background.
+ */
+bool testTiledOutput()
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  typedef SimpleThresholdForegroundPredicate<Image> Predicate;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef DistanceTransformation<Z3i::Space, Predicate, L2Metric> DT;
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> SquaredImage;
+  typedef ImageFactoryFromImage<SquaredImage> MyImageFactory;
+  typedef MyImageFactory::OutputImage OutputImage;
+  typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactory> MyReadPolicy;
+  typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactory> MyWritePolicy;
+  typedef TiledImage<SquaredImage, MyImageFactory, MyReadPolicy, MyWritePolicy> MyTiledImage;
+  typedef OutOfCoreDistanceTransformation<Z3i::Space, Predicate, MyTiledImage> OOCDT;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing OutOfCoreDistanceTransformation with a TiledImage ..." );
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 15, 15 ));
+  Image image( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    image.setValue( *it, ( (*it - Z3i::Point( 5, 9, 7 )).norm() < 6.0 ) ? 0 : 1 );
+  Predicate predicate( image, 0 );
+  L2Metric l2;
+  DT dt( &domain, &predicate, &l2 );
+
+  SquaredImage storage( domain );
+  {
+    MyImageFactory factory( storage );
+    MyReadPolicy readPolicy( factory, 2 );
+    MyWritePolicy writePolicy( factory );
+    MyTiledImage tiled( factory, readPolicy, writePolicy, 4 );
+    OOCDT oocdt( domain, predicate, tiled, 4 );
+
+    bool ok = true;
+    for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+      {
+        const double d = dt( *it );
+        ok = ok && ( tiled( *it ) == (DGtal::uint32_t) floor( d * d + 0.5 ) );
+      }
+    ++nb; nbok += ok ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "tiled squared DT == DT^2, cache misses (read)=" << tiled.getCacheMissRead() << std::endl;
+  }
+
+  //A domain with no background point
+  Image full( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    full.setValue( *it, 1 );
+  Predicate fullPredicate( full, 0 );
+  {
+    typedef OutOfCoreDistanceTransformation<Z3i::Space, Predicate, SquaredImage> OOCDTVector;
+    OOCDTVector oocdt( domain, fullPredicate, storage, 2 );
+    bool ok = true;
+    for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+      ok = ok && ( storage( *it ) == OOCDTVector::infinity() );
+    ++nb; nbok += ok ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "no background point: infinity everywhere" << std::endl;
+  }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OutOfCoreDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOutOfCoreDistanceTransformation<Z2i::Space>( Z2i::Point( 40, 31 ))
+    && testOutOfCoreDistanceTransformation<Z3i::Space>( Z3i::Point( 17, 12, 20 ))
+    && testTiledOutput();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
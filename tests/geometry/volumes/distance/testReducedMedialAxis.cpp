@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <set>
+#include <limits>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
@@ -136,6 +138,95 @@ bool testReducedMedialAxis()
   return nbok == nb;
 }
 
+/**
+ * Compares the compact (parallel) extraction with the image based
+ * one on a 3D shape, and checks that the maximal balls reconstruct
+ * the shape.
+ */
+bool testReducedMedialAxisCompact()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing compact ReducedMedialAxis in 3D ..." );
+
+  Z3i::Domain domain(Z3i::Point(0,0,0),Z3i::Point(19,17,15));
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> Image;
+  Image image(domain);
+
+  //Squared distances to the complement of the union of a ball and a box
+  std::vector<Z3i::Point> outside;
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it)
+    {
+      const Z3i::Point p = *it;
+      const Z3i::Point c(8,8,7);
+      const bool inBall = (p-c).dot(p-c) < 30;
+      const bool inBox = p[0] >= 10 && p[0] <= 16 && p[1] >= 3 && p[1] <= 12 && p[2] >= 4 && p[2] <= 10;
+      if ( !inBall && !inBox )
+        outside.push_back( p );
+    }
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it)
+    {
+      DGtal::int64_t d2 = std::numeric_limits<DGtal::int64_t>::max();
+      for(std::vector<Z3i::Point>::const_iterator ito = outside.begin(), itoend = outside.end(); ito != itoend; ++ito)
+        d2 = std::min( d2, (DGtal::int64_t) (*it - *ito).dot(*it - *ito) );
+      image.setValue( *it, d2 );
+    }
+
+  typedef PowerMap<Image, Z3i::L2PowerMetric> MyPowerMap;
+  typedef ReducedMedialAxis<MyPowerMap> RDMA;
+  Z3i::L2PowerMetric l2power;
+  MyPowerMap power(&domain, &image, &l2power);
+
+  RDMA::BallVector balls;
+  RDMA::getReducedMedialAxisFromPowerMap( power, balls );
+  trace.info() << "#balls=" << balls.size() << std::endl;
+  nbok += ( ! balls.empty() ) ? 1 : 0; 
+  nb++;
+
+  //Sequential extraction, as in the image based version
+  std::set<Z3i::Point> expected;
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it)
+    {
+      Z3i::Point v = power(*it);
+      if ( l2power.powerDistance( *it, v, image(v) ) < 0 )
+        expected.insert( v );
+    }
+  bool ok = ( expected.size() == balls.size() );
+  for(RDMA::BallVector::const_iterator it = balls.begin(), itend = balls.end(); ok && it != itend; ++it)
+    ok = ( expected.count( it->first ) == 1 ) && ( it->second == image( it->first ) );
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "compact == sequential" << std::endl;
+
+  RDMA::Type rdma = RDMA::getReducedMedialAxisFromPowerMap( power );
+  ok = true;
+  for(RDMA::BallVector::const_iterator it = balls.begin(), itend = balls.end(); ok && it != itend; ++it)
+    ok = ( rdma( it->first ) == it->second );
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "compact == image" << std::endl;
+
+  //Reconstruction
+  ok = true;
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); ok && it != itend; ++it)
+    {
+      bool covered = false;
+      for(RDMA::BallVector::const_iterator itb = balls.begin(), itbend = balls.end(); !covered && itb != itbend; ++itb)
+        covered = l2power.powerDistance( *it, itb->first, itb->second ) < 0;
+      ok = ( covered == ( image( *it ) > 0 ) );
+    }
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "union of balls == shape" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -147,7 +238,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testReducedMedialAxis(); // && ... other tests
+  bool res = testReducedMedialAxis() && testReducedMedialAxisCompact(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -35,6 +35,8 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/Shapes.h"
 #include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -93,6 +95,61 @@ bool testKanungo2D()
   return nbok == nb;
 }
 
+/**
+ * Checks that the noise only depends on the seed, and compares it
+ * with the definition computed with DistanceTransformation.
+ */
+bool testKanungo3DSeed()
+{
+  typedef KanungoNoise<Z3i::DigitalSet, Z3i::Domain> Noise;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing 3D noise with a seed ..." );
+  
+  Z3i::Domain domain(Z3i::Point(0,0,0), Z3i::Point(40,33,25));
+  Z3i::DigitalSet set(domain);
+  Shapes<Z3i::Domain>::addNorm2Ball( set , Z3i::Point(20,16,12), 10);
+
+  Noise::BitImage noisy( domain ), noisy2( domain ), noisy3( domain );
+  Noise::computeNoisyImage( set, domain, 0.5, 42, noisy );
+  Noise::computeNoisyImage( set, domain, 0.5, 42, noisy2 );
+  Noise::computeNoisyImage( set, domain, 0.5, 43, noisy3 );
+  nbok += ( noisy == noisy2 ) ? 1 : 0;
+  nb++;
+  nbok += ( noisy != noisy3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same seed, same noise" << std::endl;
+
+  Noise noise( set, domain, 0.5, 42 );
+  trace.info() << noise.seed() << std::endl;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2;
+  L2 l2;
+  NotPointPredicate<Z3i::DigitalSet> negPred( set );
+  DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2> DTin( domain, set, l2 );
+  DistanceTransformation<Z3i::Space, NotPointPredicate<Z3i::DigitalSet>, L2> DTout( domain, negPred, l2 );
+  bool ok = true;
+  unsigned int nbFlips = 0;
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend=domain.end(); it != itend; ++it)
+    {
+      const double p = Noise::uniformRandom( *it, 42 );
+      const bool expected = set( *it )
+        ? ( p >= std::pow( 0.5, 1.0 + DTin( *it ) ) )
+        : ( p < std::pow( 0.5, 1.0 + DTout( *it ) ) );
+      ok = ok && ( noisy( *it ) == expected ) && ( noise( *it ) == expected );
+      nbFlips += ( expected != set( *it ) ) ? 1 : 0;
+    }
+  trace.info() << "#flips=" << nbFlips << std::endl;
+  nbok += ( ok && nbFlips > 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "noise == definition" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 bool CheckingConcept()
 {
   BOOST_CONCEPT_ASSERT(( CPointPredicate < KanungoNoise<Z2i::DigitalSet, Z2i::Domain> > ));
@@ -111,7 +168,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = CheckingConcept() && testKanungo2D(); // && ... other tests
+  bool res = CheckingConcept() && testKanungo2D() && testKanungo3DSeed(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
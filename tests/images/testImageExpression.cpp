@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageExpression.cpp
+ * @ingroup Tests
+ *
+ * @brief A test file for image expressions (ImageExpression.h).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <functional>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageExpression.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/**
+ * A small affine functor on integers.
+ */
+struct AffineFunctor
+{
+  AffineFunctor( int a, int b ) : myA( a ), myB( b ) {}
+  int operator()( int v ) const { return myA * v + myB; }
+  int myA;
+  int myB;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing image expressions.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testImageExpression()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, bool> BinaryImage;
+  typedef ImageTermExpression<Image> Term;
+  typedef UnaryImageExpression<Term, AffineFunctor, int> Affine;
+  typedef BinaryImageExpression<Affine, Term, std::plus<int>, int> Sum;
+  typedef Thresholder<int, false, false> Threshold;
+  typedef UnaryImageExpression<Sum, Threshold, bool> Binarized;
+
+  BOOST_CONCEPT_ASSERT(( CConstImage<Term> ));
+  BOOST_CONCEPT_ASSERT(( CConstImage<Sum> ));
+  BOOST_CONCEPT_ASSERT(( CConstImage<Binarized> ));
+
+  trace.beginBlock ( "Testing fused expressions ..." );
+
+  //Odd extents, so that the last block is incomplete
+  Z3i::Domain domain( Z3i::Point( -3, 0, 2 ), Z3i::Point( 27, 18, 23 ) );
+  Image image1( domain );
+  Image image2( domain );
+  srand( 7 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    {
+      image1.setValue( *it, rand() % 256 );
+      image2.setValue( *it, rand() % 256 );
+    }
+
+  AffineFunctor affine( 2, -100 );
+  Threshold threshold( 300 );
+  Sum sum = combineExpressions<int>( transformExpression<int>( makeImageExpression( image1 ), affine ),
+                                     makeImageExpression( image2 ),
+                                     std::plus<int>() );
+  Binarized binarized = transformExpression<bool>( sum, threshold );
+  trace.info() << binarized << std::endl;
+
+  //Point-wise evaluation
+  bool ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    ok = ok && ( sum( *it ) == affine( image1( *it ) ) + image2( *it ) )
+      && ( binarized( *it ) == ( affine( image1( *it ) ) + image2( *it ) > 300 ) );
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "point-wise evaluation" << std::endl;
+
+  //Range
+  ok = true;
+  Sum::ConstRange range = sum.constRange();
+  Z3i::Domain::ConstIterator itd = domain.begin();
+  for ( Sum::ConstRange::ConstIterator it = range.begin(), itend = range.end(); it != itend; ++it, ++itd )
+    ok = ok && ( *it == sum( *itd ) );
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "range" << std::endl;
+
+  //Materialization
+  Image result( domain );
+  imageFromExpression( result, sum );
+  BinaryImage binaryResult( domain );
+  imageFromExpression( binaryResult, binarized );
+  ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    ok = ok && ( result( *it ) == sum( *it ) ) && ( binaryResult( *it ) == binarized( *it ) );
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "imageFromExpression (int and bool images)" << std::endl;
+
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing ConstImageAdapter fusion ..." );
+
+  typedef ConstImageAdapter<Image, Z3i::Domain, DefaultFunctor, int, AffineFunctor> Adapter;
+  DefaultFunctor idD;
+  Adapter adapter( image1, domain, idD, affine );
+  ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    ok = ok && ( makeImageExpression( adapter )( *it ) == adapter( *it ) );
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fused adapter == adapter" << std::endl;
+
+  BinaryImage fused( domain );
+  imageFromExpression( fused, transformExpression<bool>( combineExpressions<int>( makeImageExpression( adapter ),
+                                                                                 makeImageExpression( image2 ),
+                                                                                 std::plus<int>() ),
+                                                         threshold ) );
+  ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    ok = ok && ( fused( *it ) == binarized( *it ) );
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fused pipeline == expression" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing image expressions" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testImageExpression();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageFactoryFromBlockVol.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class ImageFactoryFromBlockVol.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromBlockVol.h"
+#include "DGtal/images/ImageCachePolicies.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/io/readers/BlockVolReader.h"
+#include "DGtal/io/writers/BlockVolWriter.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageFactoryFromBlockVol.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+
+int valueAt( const Z3i::Point & p )
+{
+  return ( p[ 0 ] / 10 ) + 7 * ( p[ 1 ] / 13 ) + 100 * p[ 2 ];
+}
+
+bool testFactory()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Testing ImageFactoryFromBlockVol" );
+
+  Image image( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 63, 47, 39 ) ) );
+  for ( Image::Domain::ConstIterator it = image.domain().begin(),
+          itend = image.domain().end(); it != itend; ++it )
+    image.setValue( *it, valueAt( *it ) );
+  BlockVolWriter<Image>::exportBlockVol( "testImageFactoryFromBlockVol.bvol", image, 16, 2 );
+
+  typedef ImageFactoryFromBlockVol<Image> MyImageFactory;
+  BOOST_CONCEPT_ASSERT(( CImageFactory< MyImageFactory > ));
+  {
+    MyImageFactory factory( "testImageFactoryFromBlockVol.bvol", true );
+    trace.info() << factory << endl;
+    nbok += ( factory.isValid() && factory.domain().upperBound() == Z3i::Point( 63, 47, 39 ) ) ? 1 : 0;
+    nb++;
+
+    // A domain which is not aligned on the bricks.
+    Image * part = factory.requestImage( Z3i::Domain( Z3i::Point( 5, 14, 3 ), Z3i::Point( 37, 40, 33 ) ) );
+    bool ok = true;
+    for ( Image::Domain::ConstIterator it = part->domain().begin(),
+            itend = part->domain().end(); it != itend; ++it )
+      ok = ok && ( (*part)( *it ) == valueAt( *it ) );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "requestImage" << endl;
+
+    part->setValue( Z3i::Point( 5, 14, 3 ), 1234 );
+    part->setValue( Z3i::Point( 37, 40, 33 ), 4321 );
+    factory.flushImage( part );
+    factory.detachImage( part );
+  }
+  Image imageRead = BlockVolReader<Image>::importBlockVol( "testImageFactoryFromBlockVol.bvol" );
+  nbok += ( imageRead( Z3i::Point( 5, 14, 3 ) ) == 1234 && imageRead( Z3i::Point( 37, 40, 33 ) ) == 4321
+            && imageRead( Z3i::Point( 4, 14, 3 ) ) == valueAt( Z3i::Point( 4, 14, 3 ) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "flushImage" << endl;
+
+  bool flushed = false;
+  bool error = false;
+  try
+    {
+      // Read-only by default: flushing is a no-op.
+      MyImageFactory factory( "testImageFactoryFromBlockVol.bvol" );
+      Image * part = factory.requestImage( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 3, 3, 3 ) ) );
+      factory.flushImage( part );
+      factory.detachImage( part );
+      flushed = true;
+      factory.requestImage( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 3, 3, 40 ) ) );
+    }
+  catch ( DGtal::IOException & )
+    {
+      error = true;
+    }
+  nbok += ( flushed && error ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "read only file and invalid domain" << endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testTiledImage()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock( "Testing TiledImage with ImageFactoryFromBlockVol" );
+
+  Image image( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 63, 63, 63 ) ) );
+  for ( Image::Domain::ConstIterator it = image.domain().begin(),
+          itend = image.domain().end(); it != itend; ++it )
+    image.setValue( *it, valueAt( *it ) );
+  BlockVolWriter<Image>::exportBlockVol( "testImageFactoryFromBlockVol-tiled.bvol", image, 16 );
+
+  typedef ImageFactoryFromBlockVol<Image> MyImageFactory;
+  typedef MyImageFactory::OutputImage OutputImage;
+  MyImageFactory factory( "testImageFactoryFromBlockVol-tiled.bvol", true );
+
+  typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactory> MyReadPolicy;
+  typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactory> MyWritePolicy;
+  MyReadPolicy readPolicy( factory, 4 );
+  MyWritePolicy writePolicy( factory );
+
+  typedef TiledImage<Image, MyImageFactory, MyReadPolicy, MyWritePolicy> MyTiledImage;
+  BOOST_CONCEPT_ASSERT(( CImage< MyTiledImage > ));
+  // 4 tiles per dimension: one tile per brick.
+  MyTiledImage tiledImage( factory, readPolicy, writePolicy, 4 );
+
+  bool ok = true;
+  for ( Image::Domain::ConstIterator it = image.domain().begin(),
+          itend = image.domain().end(); it != itend; ++it )
+    ok = ok && ( tiledImage( *it ) == valueAt( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "read values" << endl;
+
+  tiledImage.setValue( Z3i::Point( 20, 30, 40 ), -5 );
+  tiledImage.setValue( Z3i::Point( 63, 0, 63 ), 77 );
+  nbok += ( tiledImage( Z3i::Point( 20, 30, 40 ) ) == -5 ) ? 1 : 0;
+  nb++;
+
+  const Image imageRead = BlockVolReader<Image>::importBlockVol( "testImageFactoryFromBlockVol-tiled.bvol" );
+  nbok += ( imageRead( Z3i::Point( 20, 30, 40 ) ) == -5 && imageRead( Z3i::Point( 63, 0, 63 ) ) == 77
+            && imageRead( Z3i::Point( 21, 30, 40 ) ) == valueAt( Z3i::Point( 21, 30, 40 ) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "written values" << endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageFactoryFromBlockVol" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testFactory() && testTiledImage(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
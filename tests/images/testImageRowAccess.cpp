@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageRowAccess.cpp
+ * @ingroup Tests
+ *
+ * @brief A test file for the row access of image containers
+ * (rowFromImage, imageFromRow).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <string>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerByHashTree.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageCache.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/Image.h"
+#include "DGtal/images/ConstImageAdapter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the row access of images.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return a value depending on @a p and @a seed.
+ */
+int valueAt( const Z3i::Point & p, int seed )
+{
+  return ( ( p[0] + 3 ) * 7 + ( p[1] + 3 ) * 13 + ( p[2] + 3 ) * 31 + seed ) % 97;
+}
+
+/**
+ * Reads all the rows of @a anImage along each dimension and compares
+ * them with the values at each point, then writes all the rows and
+ * checks the values point by point.
+ */
+template <typename Image>
+bool testRows( Image & anImage, const Z3i::Domain & domain, const std::string & label )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing row access of " + label + " ..." );
+
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    anImage.setValue( *it, valueAt( *it, 0 ) );
+
+  for ( Dimension d = 0; d < 3; ++d )
+    {
+      Z3i::Point upper = domain.upperBound();
+      upper[ d ] = domain.lowerBound()[ d ];
+      const Z3i::Domain starts( domain.lowerBound(), upper );
+      const Z3i::Domain::Size n = domain.upperBound()[ d ] - domain.lowerBound()[ d ] + 1;
+
+      //Reading
+      bool ok = true;
+      std::vector<int> row;
+      for ( Z3i::Domain::ConstIterator it = starts.begin(), itend = starts.end(); it != itend; ++it )
+        {
+          row.clear();
+          rowFromImage( anImage, *it, d, n, std::back_inserter( row ) );
+          Z3i::Point p = *it;
+          ok = ok && ( row.size() == n );
+          for ( unsigned int i = 0; i < row.size(); ++i, ++p[ d ] )
+            ok = ok && ( row[ i ] == anImage( p ) );
+        }
+      ++nb; nbok += ok ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "rowFromImage along " << d << std::endl;
+
+      //Writing
+      row.resize( n );
+      for ( Z3i::Domain::ConstIterator it = starts.begin(), itend = starts.end(); it != itend; ++it )
+        {
+          Z3i::Point p = *it;
+          for ( unsigned int i = 0; i < n; ++i, ++p[ d ] )
+            row[ i ] = valueAt( p, d + 1 );
+          std::vector<int>::const_iterator last = imageFromRow( anImage, *it, d, n, row.begin() );
+          ok = ok && ( last == row.end() );
+        }
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+        ok = ok && ( anImage( *it ) == valueAt( *it, d + 1 ) );
+      ++nb; nbok += ok ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "imageFromRow along " << d << std::endl;
+    }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks the generic row access on a ConstImageAdapter and a short
+ * row in the middle of the domain.
+ */
+bool testGenericRows( const Z3i::Domain & domain )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+  typedef ConstImageAdapter<VImage, Z3i::Domain, DefaultFunctor, int, DefaultFunctor> Adapter;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing generic row access ..." );
+
+  VImage image( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    image.setValue( *it, valueAt( *it, 0 ) );
+  DefaultFunctor id;
+  Adapter adapter( image, domain, id, id );
+
+  const Z3i::Point start( 1, 3, 2 );
+  for ( Dimension d = 0; d < 3; ++d )
+    {
+      std::vector<int> row1, row2;
+      rowFromImage( adapter, start, d, 4, std::back_inserter( row1 ) );
+      rowFromImage( image, start, d, 4, std::back_inserter( row2 ) );
+      ++nb; nbok += ( row1 == row2 && row1.size() == 4 ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "adapter row == container row along " << d << std::endl;
+    }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing row access of images" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const Z3i::Domain domain( Z3i::Point( -2, 1, 0 ), Z3i::Point( 9, 8, 12 ) );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+  typedef ImageContainerBySTLMap<Z3i::Domain, int> MImage;
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int, DGtal::uint64_t> HImage;
+  typedef ImageFactoryFromImage<VImage> MyImageFactory;
+  typedef MyImageFactory::OutputImage OutputImage;
+  typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactory> MyReadPolicy;
+  typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactory> MyWritePolicy;
+  typedef TiledImage<VImage, MyImageFactory, MyReadPolicy, MyWritePolicy> MyTiledImage;
+
+  VImage vImage( domain );
+  MImage mImage( domain );
+  HImage hImage( domain );
+  Image<VImage> image( new VImage( domain ) );
+
+  VImage storage( domain );
+  MyImageFactory factory( storage );
+  MyReadPolicy readPolicy( factory, 2 );
+  MyWritePolicy writePolicy( factory );
+  MyTiledImage tiled( factory, readPolicy, writePolicy, 3 );
+
+  bool res = testRows( vImage, domain, "ImageContainerBySTLVector" )
+    && testRows( mImage, domain, "ImageContainerBySTLMap" )
+    && testRows( hImage, domain, "ImageContainerByHashTree" )
+    && testRows( image, domain, "Image" )
+    && testRows( tiled, domain, "TiledImage" )
+    && testGenericRows( domain );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,188 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkNetPBM.cpp
+ * @ingroup Tests
+ *
+ * Benchmark of the PGM3D import and export: value by value stream
+ * operations (previous implementation, reproduced here) versus the
+ * bulk reading and writing of PGMReader and PGMWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/writers/PGMWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+/////// Micro Bench
+
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char> Image8;
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned int> Image16;
+
+/**
+ * Value by value import of a binary PGM3D (8 bits).
+ */
+Image8 importPGM3DByValue( const std::string & aFilename )
+{
+  std::ifstream infile( aFilename.c_str(), std::ifstream::in );
+  std::string str;
+  getline( infile, str );
+  do
+    getline( infile, str );
+  while ( str[ 0 ] == '#' || str == "" );
+  std::istringstream str_in( str );
+  unsigned int w, h, e;
+  str_in >> w >> h >> e;
+  getline( infile, str );
+  Image8 image( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( w-1, h-1, e-1 ) ) );
+  infile >> std::noskipws;
+  for ( unsigned int z = 0; z < e; z++ )
+    for ( unsigned int y = 0; y < h; y++ )
+      for ( unsigned int x = 0; x < w; x++ )
+        {
+          unsigned char c;
+          infile >> c;
+          image.setValue( Z3i::Point( x, y, z ), c );
+        }
+  return image;
+}
+
+/**
+ * Value by value export of a binary PGM3D (8 bits).
+ */
+void exportPGM3DByValue( const std::string & aFilename, const Image8 & anImage )
+{
+  std::ofstream out( aFilename.c_str() );
+  const Z3i::Vector size = anImage.domain().upperBound() - anImage.domain().lowerBound()
+    + Z3i::Point::diagonal( 1 );
+  out << "P5-3D" << std::endl << "#DGtal PNM Writer" << std::endl << std::endl;
+  out << size[ 0 ] << " " << size[ 1 ] << " " << size[ 2 ] << std::endl << "255" << std::endl;
+  for ( Z3i::Domain::ConstIterator it = anImage.domain().begin(), itend = anImage.domain().end();
+        it != itend; ++it )
+    out << ( (char) anImage( *it ) );
+}
+
+Image8 makeImage( const int aSize )
+{
+  Image8 image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( aSize - 1 ) ) );
+  for ( Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+        it != itend; ++it )
+    image.setValue( *it, (unsigned char)( (*it)[ 0 ] * 3 + (*it)[ 1 ] * 5 + (*it)[ 2 ] * 7 ) );
+  return image;
+}
+
+static void BM_ImportByValue(benchmark::State& state)
+{
+  PGMWriter<Image8>::exportPGM3D( "benchmarkNetPBM.pgm3d", makeImage( state.range_x() ) );
+  while (state.KeepRunning())
+    {
+      Image8 image = importPGM3DByValue( "benchmarkNetPBM.pgm3d" );
+      benchmark::DoNotOptimize( image( Z3i::Point::diagonal( 0 ) ) );
+    }
+  state.SetBytesProcessed( state.iterations() * state.range_x() * state.range_x() * state.range_x() );
+}
+BENCHMARK(BM_ImportByValue)->Range(1<<4 , 1 << 8);
+
+static void BM_ImportBulk(benchmark::State& state)
+{
+  PGMWriter<Image8>::exportPGM3D( "benchmarkNetPBM.pgm3d", makeImage( state.range_x() ) );
+  while (state.KeepRunning())
+    {
+      Image8 image = PGMReader<Image8>::importPGM3D( "benchmarkNetPBM.pgm3d" );
+      benchmark::DoNotOptimize( image( Z3i::Point::diagonal( 0 ) ) );
+    }
+  state.SetBytesProcessed( state.iterations() * state.range_x() * state.range_x() * state.range_x() );
+}
+BENCHMARK(BM_ImportBulk)->Range(1<<4 , 1 << 8);
+
+static void BM_Import16Bulk(benchmark::State& state)
+{
+  const unsigned int n = state.range_x();
+  {
+    std::ofstream out( "benchmarkNetPBM-16.pgm3d", std::ofstream::out | std::ofstream::binary );
+    out << "P5-3D\n" << n << " " << n << " " << n << "\n65535\n";
+    for ( unsigned int i = 0; i < n * n * n; ++i )
+      {
+        out.put( (char)( ( i >> 8 ) & 0xff ) );
+        out.put( (char)( i & 0xff ) );
+      }
+  }
+  while (state.KeepRunning())
+    {
+      Image16 image = PGMReader<Image16>::importPGM3D( "benchmarkNetPBM-16.pgm3d" );
+      benchmark::DoNotOptimize( image( Z3i::Point::diagonal( 0 ) ) );
+    }
+  state.SetBytesProcessed( state.iterations() * 2 * n * n * n );
+}
+BENCHMARK(BM_Import16Bulk)->Range(1<<4 , 1 << 8);
+
+static void BM_ImportASCIIBulk(benchmark::State& state)
+{
+  PGMWriter<Image8>::exportPGM3D( "benchmarkNetPBM-ascii.pgm3d", makeImage( state.range_x() ),
+                                  DefaultFunctor(), true );
+  while (state.KeepRunning())
+    {
+      Image8 image = PGMReader<Image8>::importPGM3D( "benchmarkNetPBM-ascii.pgm3d" );
+      benchmark::DoNotOptimize( image( Z3i::Point::diagonal( 0 ) ) );
+    }
+  state.SetItemsProcessed( state.iterations() * state.range_x() * state.range_x() * state.range_x() );
+}
+BENCHMARK(BM_ImportASCIIBulk)->Range(1<<4 , 1 << 7);
+
+static void BM_ExportByValue(benchmark::State& state)
+{
+  const Image8 image = makeImage( state.range_x() );
+  while (state.KeepRunning())
+    exportPGM3DByValue( "benchmarkNetPBM-out.pgm3d", image );
+  state.SetBytesProcessed( state.iterations() * state.range_x() * state.range_x() * state.range_x() );
+}
+BENCHMARK(BM_ExportByValue)->Range(1<<4 , 1 << 8);
+
+static void BM_ExportBulk(benchmark::State& state)
+{
+  const Image8 image = makeImage( state.range_x() );
+  while (state.KeepRunning())
+    PGMWriter<Image8>::exportPGM3D( "benchmarkNetPBM-out.pgm3d", image );
+  state.SetBytesProcessed( state.iterations() * state.range_x() * state.range_x() * state.range_x() );
+}
+BENCHMARK(BM_ExportBulk)->Range(1<<4 , 1 << 8);
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  const char*argv[] )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,209 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTabulatedColorMap.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class TabulatedColorMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/io/Color.h"
+#include "DGtal/io/colormaps/CColorMap.h"
+#include "DGtal/io/colormaps/GrayscaleColorMap.h"
+#include "DGtal/io/colormaps/HueShadeColorMap.h"
+#include "DGtal/io/colormaps/GradientColorMap.h"
+#include "DGtal/io/colormaps/TabulatedColorMap.h"
+#include "DGtal/io/writers/PPMWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class TabulatedColorMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+   Checks that \a lut gives the colors of \a cmap on [lo,up], one by
+   one and by batches.
+*/
+template <typename TColorMap>
+bool
+sameColors( const TColorMap & cmap,
+            const TabulatedColorMap<TColorMap> & lut,
+            typename TColorMap::Value lo, typename TColorMap::Value up )
+{
+  typedef typename TColorMap::Value Value;
+  std::vector<Value> values;
+  for ( Value v = lo; ; ++v )
+    {
+      values.push_back( v );
+      if ( v == up ) break;
+    }
+  std::vector<unsigned char> rgb( 3 * values.size() );
+  std::vector<unsigned char> rgba( 4 * values.size() );
+  std::vector<Color> colors( values.size() );
+  bool ok = colorizeRGB( lut, values.begin(), values.end(), &rgb[ 0 ] )
+    == &rgb[ 0 ] + rgb.size();
+  ok = ok && ( colorizeRGBA( lut, values.begin(), values.end(), &rgba[ 0 ] )
+               == &rgba[ 0 ] + rgba.size() );
+  lut.colorize( values.begin(), values.end(), colors.begin() );
+  std::vector<unsigned char> refRGB( 3 * values.size() );
+  colorizeRGB( cmap, values.begin(), values.end(), &refRGB[ 0 ] );
+  ok = ok && ( rgb == refRGB );
+  for ( std::size_t i = 0; ok && ( i < values.size() ); ++i )
+    {
+      const Color ref = cmap( values[ i ] );
+      ok = ( lut( values[ i ] ) == ref ) && ( colors[ i ] == ref )
+        && ( rgba[ 4 * i ] == ref.red() ) && ( rgba[ 4 * i + 1 ] == ref.green() )
+        && ( rgba[ 4 * i + 2 ] == ref.blue() ) && ( rgba[ 4 * i + 3 ] == ref.alpha() );
+      if ( ! ok )
+        trace.error() << "value " << values[ i ] << " " << lut( values[ i ] )
+                      << " != " << ref << std::endl;
+    }
+  return ok;
+}
+
+/**
+   Compares tabulated color maps with the color maps they tabulate.
+*/
+bool testTabulatedColorMap()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing TabulatedColorMap ..." );
+  typedef GradientColorMap<int> Gradient;
+  Gradient jet( 0, 4095, CMAP_JET );
+  TabulatedColorMap<Gradient> lutJet( jet );
+  trace.info() << lutJet << std::endl;
+  nbok += ( lutJet.isValid() && ( lutJet.size() == 4096 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "4096 tabulated colors" << std::endl;
+  nbok += sameColors( jet, lutJet, 0, 4095 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same jet colors" << std::endl;
+
+  Gradient custom( -50, 50 );
+  custom.addColor( Color::Blue );
+  custom.addColor( Color( 20, 200, 30, 128 ) );
+  custom.addColor( Color::Red );
+  // Values out of [-20,20] are given to the gradient.
+  TabulatedColorMap<Gradient> lutCustom( custom, -20, 20 );
+  nbok += sameColors( custom, lutCustom, -50, 50 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same custom gradient colors" << std::endl;
+
+  typedef HueShadeColorMap<unsigned char> Hue;
+  TabulatedColorMap<Hue> lutHue( 0, 255 );
+  nbok += sameColors( Hue( 0, 255 ), lutHue, 0, 255 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same hue shade colors" << std::endl;
+
+  typedef GrayscaleColorMap<short> Gray;
+  TabulatedColorMap<Gray> lutGray( -1000, 1000 );
+  nbok += sameColors( Gray( -1000, 1000 ), lutGray, -1000, 1000 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same grayscale colors" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+   Checks that PPM files written with a tabulated color map are the
+   same as with the original color map, and compares their speeds.
+*/
+bool testTabulatedPPMWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing PPMWriter with TabulatedColorMap ..." );
+  typedef ImageSelector<Z2i::Domain, int>::Type Image;
+  typedef GradientColorMap<int> Gradient;
+  typedef TabulatedColorMap<Gradient> Tabulated;
+  Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 1023, 767 ) );
+  Image image( domain );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itE = domain.end();
+        it != itE; ++it )
+    image.setValue( *it, ( (*it)[ 0 ] * 7 + (*it)[ 1 ] * 13 ) % 4096 );
+
+  Gradient jet( 0, 4095, CMAP_JET );
+  trace.beginBlock ( "Tabulation" );
+  Tabulated lut( jet );
+  trace.endBlock();
+  for ( int ascii = 0; ascii < 2; ++ascii )
+    {
+      trace.beginBlock ( "Export with GradientColorMap" );
+      PPMWriter<Image, Gradient>::exportPPM( "testTabulatedColorMap-ref.ppm",
+                                             image, jet, true, ascii == 1 );
+      trace.endBlock();
+      trace.beginBlock ( "Export with TabulatedColorMap" );
+      PPMWriter<Image, Tabulated>::exportPPM( "testTabulatedColorMap-lut.ppm",
+                                              image, lut, true, ascii == 1 );
+      trace.endBlock();
+      std::ifstream ref( "testTabulatedColorMap-ref.ppm", std::ios::binary );
+      std::ifstream tab( "testTabulatedColorMap-lut.ppm", std::ios::binary );
+      std::stringstream refData, tabData;
+      refData << ref.rdbuf();
+      tabData << tab.rdbuf();
+      nbok += ( ! refData.str().empty() && ( refData.str() == tabData.str() ) ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "same " << ( ascii ? "P3" : "P6" ) << " files" << std::endl;
+    }
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class TabulatedColorMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  BOOST_CONCEPT_ASSERT(( CColorMap< TabulatedColorMap< GradientColorMap<int> > > ));
+  bool res = testTabulatedColorMap() && testTabulatedPPMWriter();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,254 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testNetPBMStream.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing the bulk reading and writing of Netpbm files
+ * (NetPBMStream, PGMReader, PPMReader, PGMWriter, PPMWriter).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/NetPBMStream.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/readers/PPMReader.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/PGMWriter.h"
+#include "DGtal/io/writers/PPMWriter.h"
+#include "DGtal/io/colormaps/BasicColorToScalarFunctors.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class NetPBMStream.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Inverse of BasicColorToScalarFunctors::ColorRGBEncoder.
+struct Decoder
+{
+  Color operator()( const unsigned int aValue ) const
+  {
+    return Color( aValue );
+  }
+};
+
+template <typename Image>
+bool sameImages( const Image & image1, const Image & image2 )
+{
+  if ( image1.domain().lowerBound() != image2.domain().lowerBound()
+       || image1.domain().upperBound() != image2.domain().upperBound() )
+    return false;
+  for ( typename Image::Domain::ConstIterator it = image1.domain().begin(),
+          itend = image1.domain().end(); it != itend; ++it )
+    if ( image1( *it ) != image2( *it ) )
+      return false;
+  return true;
+}
+
+/**
+ * Header tokens, ASCII values and 16 bits samples.
+ */
+bool testNetPBMInputStream()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing NetPBMInputStream ..." );
+
+  std::string data( "P5 # comment\n# other comment\n3 1\n65535\n" );
+  const unsigned char samples[] = { 0x01, 0x02, 0xff, 0xfe, 0x00, 0x07 };
+  data.append( reinterpret_cast<const char*>( samples ), 6 );
+  std::istringstream input( data );
+  NetPBMInputStream in( input );
+  std::string magic;
+  unsigned int w = 0, h = 0, maxValue = 0;
+  nbok += ( in.readHeaderToken( magic ) && magic == "P5" ) ? 1 : 0;
+  nb++;
+  nbok += ( in.readHeaderValue( w ) && in.readHeaderValue( h )
+            && in.readHeaderValue( maxValue )
+            && w == 3 && h == 1 && maxValue == 65535 ) ? 1 : 0;
+  nb++;
+  in.skipHeaderEnd();
+  unsigned int values[ 4 ];
+  nbok += ( in.readSamples( values, 4, false, maxValue ) == 3 ) ? 1 : 0;
+  nb++;
+  nbok += ( values[ 0 ] == 0x0102 && values[ 1 ] == 0xfffe && values[ 2 ] == 7 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "16 bits samples " << values[ 0 ] << " " << values[ 1 ]
+               << " " << values[ 2 ] << std::endl;
+
+  std::istringstream inputASCII( "P2\n2 2 255 \n  12\n3\t456 7890123 x" );
+  NetPBMInputStream inASCII( inputASCII );
+  inASCII.readHeaderToken( magic );
+  inASCII.readHeaderValue( w );
+  inASCII.readHeaderValue( h );
+  inASCII.readHeaderValue( maxValue );
+  inASCII.skipHeaderEnd();
+  nbok += ( inASCII.readSamples( values, 4, true, maxValue ) == 4 ) ? 1 : 0;
+  nb++;
+  nbok += ( values[ 0 ] == 12 && values[ 1 ] == 3 && values[ 2 ] == 456
+            && values[ 3 ] == 7890123 ) ? 1 : 0;
+  nb++;
+  nbok += ( inASCII.readSamples( values, 1, true, maxValue ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "ASCII samples" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Round trips through the 2D and 3D writers and readers.
+ */
+bool testRoundTrips()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing PGM/PPM round trips ..." );
+
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image2D;
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image3D;
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned int> ImageColor;
+
+  Image2D image2D( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 36, 20 ) ) );
+  for ( Z2i::Domain::ConstIterator it = image2D.domain().begin(),
+          itend = image2D.domain().end(); it != itend; ++it )
+    image2D.setValue( *it, (unsigned char)( 7 * (*it)[ 0 ] + 13 * (*it)[ 1 ] ) );
+
+  PGMWriter<Image2D>::exportPGM( "testNetPBMStream.pgm", image2D );
+  nbok += sameImages( image2D, PGMReader<Image2D>::importPGM( "testNetPBMStream.pgm" ) ) ? 1 : 0;
+  nb++;
+  PGMWriter<Image2D>::exportPGM( "testNetPBMStream-ascii.pgm", image2D, DefaultFunctor(), true );
+  nbok += sameImages( image2D, PGMReader<Image2D>::importPGM( "testNetPBMStream-ascii.pgm" ) ) ? 1 : 0;
+  nb++;
+  PGMWriter<Image2D>::exportPGM( "testNetPBMStream-tb.pgm", image2D, DefaultFunctor(), false, false );
+  nbok += sameImages( image2D, PGMReader<Image2D>::importPGM( "testNetPBMStream-tb.pgm",
+                                                               CastFunctor<unsigned char>(), false ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "PGM binary, ASCII and top-bottom order" << std::endl;
+
+  Image3D image3D( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 9, 6, 4 ) ) );
+  for ( Z3i::Domain::ConstIterator it = image3D.domain().begin(),
+          itend = image3D.domain().end(); it != itend; ++it )
+    image3D.setValue( *it, (unsigned char)( (*it)[ 0 ] + 11 * (*it)[ 1 ] + 41 * (*it)[ 2 ] ) );
+  PGMWriter<Image3D>::exportPGM3D( "testNetPBMStream.pgm3d", image3D );
+  nbok += sameImages( image3D, PGMReader<Image3D>::importPGM3D( "testNetPBMStream.pgm3d" ) ) ? 1 : 0;
+  nb++;
+  PGMWriter<Image3D>::exportPGM3D( "testNetPBMStream-ascii.pgm3d", image3D, DefaultFunctor(), true );
+  nbok += sameImages( image3D, PGMReader<Image3D>::importPGM3D( "testNetPBMStream-ascii.pgm3d" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "PGM3D binary and ASCII" << std::endl;
+
+  ImageColor imageColor( image2D.domain() );
+  for ( Z2i::Domain::ConstIterator it = imageColor.domain().begin(),
+          itend = imageColor.domain().end(); it != itend; ++it )
+    imageColor.setValue( *it, ( (*it)[ 0 ] << 16 ) + ( (*it)[ 1 ] << 8 ) + image2D( *it ) );
+  PPMWriter<ImageColor, Decoder>::exportPPM( "testNetPBMStream.ppm", imageColor, Decoder(), true, false );
+  nbok += sameImages( imageColor, PPMReader<ImageColor>::importPPM( "testNetPBMStream.ppm" ) ) ? 1 : 0;
+  nb++;
+  PPMWriter<ImageColor, Decoder>::exportPPM( "testNetPBMStream-ascii.ppm", imageColor, Decoder() );
+  nbok += sameImages( imageColor, PPMReader<ImageColor>::importPPM( "testNetPBMStream-ascii.ppm" ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "PPM binary and ASCII" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * 16 bits PGM3D and sample file.
+ */
+bool testPGM16AndSample()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 16 bits PGM3D and cat10.pgm3d ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned int> Image16;
+  {
+    std::ofstream out( "testNetPBMStream-16.pgm3d", std::ofstream::out | std::ofstream::binary );
+    out << "P5-3D\n# 16 bits\n4 3 2\n4095\n";
+    for ( unsigned int i = 0; i < 24; ++i )
+      {
+        const unsigned int v = 170 * i + 3;
+        out.put( (char)( v >> 8 ) );
+        out.put( (char)( v & 0xff ) );
+      }
+  }
+  Image16 image16 = PGMReader<Image16>::importPGM3D( "testNetPBMStream-16.pgm3d" );
+  bool ok = true;
+  for ( unsigned int i = 0; i < 24; ++i )
+    ok = ok && ( image16( Z3i::Point( i % 4, ( i / 4 ) % 3, i / 12 ) ) == 170 * i + 3 );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "16 bits values" << std::endl;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image3D;
+  Image3D imagePGM = PGMReader<Image3D>::importPGM3D( testPath + "samples/cat10.pgm3d" );
+  Image3D imageVol = VolReader<Image3D>::importVol( testPath + "samples/cat10.vol" );
+  unsigned int nbDiff = 0;
+  for ( Z3i::Domain::ConstIterator it = imageVol.domain().begin(),
+          itend = imageVol.domain().end(); it != itend; ++it )
+    nbDiff += ( ( imagePGM( *it ) != 0 ) != ( imageVol( *it ) != 0 ) ) ? 1 : 0;
+  nbok += ( nbDiff == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "cat10.pgm3d == cat10.vol, nbDiff=" << nbDiff << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class NetPBMStream" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testNetPBMInputStream() && testRoundTrips()
+    && testPGM16AndSample(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
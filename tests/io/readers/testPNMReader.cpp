@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/io/boards/Board2D.h"
@@ -124,6 +125,32 @@ bool testPNM3DReader()
   return nbok == nb;
 }
 
+/**
+ * A binary PGM whose first samples are white space bytes: only the
+ * single white space after the maximal value belongs to the header.
+ */
+bool testPNMHeaderEnd()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;  
+  trace.beginBlock ( "Testing pgm header end ..." );
+  {
+    std::ofstream out( "testPNMReaderHeaderEnd.pgm", std::ofstream::out | std::ofstream::binary );
+    out << "P5\n4 1\n255 ";
+    const char samples[ 4 ] = { ' ', '\t', '\r', '\n' };
+    out.write( samples, 4 );
+  }
+  typedef ImageSelector < Z2i::Domain, unsigned int>::Type Image;
+  Image image = PGMReader<Image>::importPGM( "testPNMReaderHeaderEnd.pgm" ); 
+  nbok += ( ( image( Z2i::Point( 0, 0 ) ) == ' ' ) && ( image( Z2i::Point( 1, 0 ) ) == '\t' )
+            && ( image( Z2i::Point( 2, 0 ) ) == '\r' ) && ( image( Z2i::Point( 3, 0 ) ) == '\n' ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "blank samples are read" << std::endl;
+  trace.endBlock();  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -135,7 +162,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testPNMReader() && testPNM3DReader(); // && ... other tests
+  bool res = testPNMReader() && testPNM3DReader() && testPNMHeaderEnd(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
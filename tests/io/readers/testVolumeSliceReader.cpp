@@ -0,0 +1,254 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVolumeSliceReader.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class VolumeSliceReader.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/VolumeSliceReader.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/readers/PGMReader.h"
+#include "DGtal/io/readers/RawReader.h"
+#ifdef WITH_HDF5
+#include "DGtal/io/readers/HDF5Reader.h"
+#endif
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class VolumeSliceReader.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the slices read by @a reader with the image @a image.
+ */
+template <typename Image3D, typename Image2D>
+unsigned int nbDifferences( VolumeSliceReader & reader, const Image3D & image,
+                            Image2D & slice )
+{
+  unsigned int nbDiff = 0;
+  while ( reader.nextSlice( slice ) )
+    {
+      const int z = reader.currentSlice() - 1;
+      for ( typename Image2D::Domain::ConstIterator it = slice.domain().begin(),
+              itend = slice.domain().end(); it != itend; ++it )
+        if ( slice( *it ) != image( Z3i::Point( (*it)[ 0 ], (*it)[ 1 ], z ) ) )
+          ++nbDiff;
+    }
+  return ( reader.currentSlice() == reader.depth() ) ? nbDiff : nbDiff + 1;
+}
+
+/**
+ * Slice by slice import of the sample files, compared to the whole
+ * volume imports.
+ */
+bool testSlices()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing slice by slice import ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image3D;
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image2D;
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> ImageLong3D;
+  typedef ImageContainerBySTLVector<Z2i::Domain, DGtal::uint64_t> ImageLong2D;
+
+  VolumeSliceReader reader;
+  const Image3D imageVol = VolReader<Image3D>::importVol( testPath + "samples/cat10.vol" );
+  reader.open( testPath + "samples/cat10.vol" );
+  trace.info() << reader << std::endl;
+  Image2D slice( Z2i::Domain( Z2i::Point( 0, 0 ),
+                              Z2i::Point( reader.width() - 1, reader.height() - 1 ) ) );
+  nbok += ( reader.format() == VolumeSliceReader::VOL && reader.width() == 40
+            && reader.height() == 40 && reader.depth() == 40 ) ? 1 : 0;
+  nb++;
+  nbok += ( nbDifferences( reader, imageVol, slice ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "cat10.vol" << std::endl;
+
+  const Image3D imagePGM = PGMReader<Image3D>::importPGM3D( testPath + "samples/cat10.pgm3d" );
+  reader.open( testPath + "samples/cat10.pgm3d" );
+  trace.info() << reader << std::endl;
+  nbok += ( reader.format() == VolumeSliceReader::PGM3D
+            && nbDifferences( reader, imagePGM, slice ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "cat10.pgm3d" << std::endl;
+
+  const ImageLong3D imageLong = LongvolReader<ImageLong3D>::importLongvol( testPath + "samples/test.longvol" );
+  reader.open( testPath + "samples/test.longvol" );
+  trace.info() << reader << std::endl;
+  ImageLong2D sliceLong( Z2i::Domain( Z2i::Point( 0, 0 ),
+                                      Z2i::Point( reader.width() - 1, reader.height() - 1 ) ) );
+  nbok += ( reader.format() == VolumeSliceReader::LONGVOL
+            && nbDifferences( reader, imageLong, sliceLong ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "test.longvol" << std::endl;
+
+  {
+    std::ofstream out( "testVolumeSliceReader.raw", std::ofstream::out | std::ofstream::binary );
+    for ( Z3i::Domain::ConstIterator it = imageVol.domain().begin(),
+            itend = imageVol.domain().end(); it != itend; ++it )
+      out.put( (char) imageVol( *it ) );
+  }
+  reader.openRaw8( "testVolumeSliceReader.raw", 40, 40, 40 );
+  nbok += ( reader.format() == VolumeSliceReader::RAW8
+            && nbDifferences( reader, imageVol, slice ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "raw 8 bits" << std::endl;
+
+#ifdef WITH_HDF5
+  reader.openHDF5( testPath + "samples/cat10.h5", "/UInt8Array3D" );
+  trace.info() << reader << std::endl;
+  nbok += ( reader.format() == VolumeSliceReader::HDF5
+            && nbDifferences( reader, imageVol, slice ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "cat10.h5 (hyperslabs)" << std::endl;
+#endif
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Random access, slabs and errors.
+ */
+bool testSlabs()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing slabs ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image3D;
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image2D;
+
+  const Image3D imageVol = VolReader<Image3D>::importVol( testPath + "samples/cat10.vol" );
+  VolumeSliceReader reader;
+  reader.openVol( testPath + "samples/cat10.vol" );
+
+  // Slices in reverse order, in an image with a translated domain.
+  Image2D slice( Z2i::Domain( Z2i::Point( -5, 3 ), Z2i::Point( 34, 42 ) ) );
+  unsigned int nbDiff = 0;
+  for ( int z = 39; z >= 0; --z )
+    {
+      reader.readSlice( z, slice );
+      for ( Z2i::Domain::ConstIterator it = slice.domain().begin(),
+              itend = slice.domain().end(); it != itend; ++it )
+        nbDiff += ( slice( *it ) != imageVol( Z3i::Point( (*it)[ 0 ] + 5, (*it)[ 1 ] - 3, z ) ) ) ? 1 : 0;
+    }
+  nbok += ( nbDiff == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "random access, nbDiff=" << nbDiff << std::endl;
+
+  // Slabs of 16 slices, thresholded.
+  typedef ImageContainerBySTLVector<Z3i::Domain, bool> ImageBool;
+  unsigned int nbVoxels = 0, nbExpected = 0;
+  nbDiff = 0;
+  for ( int z0 = 0; z0 < 40; z0 += 16 )
+    {
+      const int z1 = std::min( z0 + 15, 39 );
+      ImageBool slab( Z3i::Domain( Z3i::Point( 0, 0, z0 ), Z3i::Point( 39, 39, z1 ) ) );
+      reader.readSlab( slab );
+      for ( Z3i::Domain::ConstIterator it = slab.domain().begin(),
+              itend = slab.domain().end(); it != itend; ++it )
+        {
+          nbVoxels += slab( *it ) ? 1 : 0;
+          nbDiff += ( slab( *it ) != ( imageVol( *it ) != 0 ) ) ? 1 : 0;
+        }
+    }
+  for ( Z3i::Domain::ConstIterator it = imageVol.domain().begin(),
+          itend = imageVol.domain().end(); it != itend; ++it )
+    nbExpected += ( imageVol( *it ) != 0 ) ? 1 : 0;
+  nbok += ( nbDiff == 0 && nbVoxels == nbExpected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "slabs, nbVoxels=" << nbVoxels << " (" << nbExpected << ")" << std::endl;
+
+  bool error = false;
+  try
+    {
+      reader.readSliceValues( 40 );
+    }
+  catch ( DGtal::IOException & )
+    {
+      error = true;
+    }
+  try
+    {
+      ImageBool slab( Z3i::Domain( Z3i::Point( 0, 0, 30 ), Z3i::Point( 39, 39, 40 ) ) );
+      reader.readSlab( slab );
+      error = false;
+    }
+  catch ( DGtal::IOException & )
+    {
+    }
+  try
+    {
+      reader.openRaw8( "testVolumeSliceReader.raw", 40, 40, 41 );
+      error = false;
+    }
+  catch ( DGtal::IOException & )
+    {
+    }
+  nbok += ( error && ! reader.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "invalid slices, slabs and sizes" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class VolumeSliceReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSlices() && testSlabs(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
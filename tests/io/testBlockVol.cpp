@@ -0,0 +1,312 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBlockVol.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing the block compressed volume format
+ * (BlockVolume, BlockVolReader and BlockVolWriter).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/BlockVolume.h"
+#include "DGtal/io/readers/BlockVolReader.h"
+#include "DGtal/io/writers/BlockVolWriter.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/GenericReader.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the bvol format.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Image>
+bool sameValues( const Image & image1, const Image & image2 )
+{
+  typename Image::Domain::ConstIterator it1 = image1.domain().begin();
+  typename Image::Domain::ConstIterator it2 = image2.domain().begin();
+  for ( ; it1 != image1.domain().end() && it2 != image2.domain().end(); ++it1, ++it2 )
+    if ( image1( *it1 ) != image2( *it2 ) )
+      return false;
+  return ( it1 == image1.domain().end() ) && ( it2 == image2.domain().end() );
+}
+
+std::streamoff fileSize( const std::string & aFilename )
+{
+  std::ifstream in( aFilename.c_str(), std::ifstream::in | std::ifstream::binary );
+  in.seekg( 0, std::ios::end );
+  return in.tellg();
+}
+
+/**
+ * Compression and decompression of random bytes, runs and patterns.
+ */
+bool testCodec()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing LZ codec ..." );
+
+  srand( 0 );
+  std::vector<unsigned char> data, compressed, result;
+  for ( unsigned int test = 0; test < 6; ++test )
+    {
+      data.clear();
+      if ( test == 1 )
+        data.assign( 100000, 7 );
+      else if ( test == 2 )
+        for ( unsigned int i = 0; i < 3; ++i )
+          data.push_back( (unsigned char) i );
+      else if ( test == 3 )
+        for ( unsigned int i = 0; i < 100000; ++i )
+          data.push_back( (unsigned char) ( rand() % 256 ) );
+      else if ( test == 4 )
+        for ( unsigned int i = 0; i < 200000; ++i )
+          data.push_back( (unsigned char) ( ( i / 1000 ) % 3 ) );
+      else if ( test == 5 )
+        for ( unsigned int i = 0; i < 100000; ++i )
+          data.push_back( (unsigned char) ( ( rand() % 8 == 0 ) ? rand() % 4 : 0 ) );
+      details::lzCompress( data.empty() ? NULL : &data[ 0 ], data.size(), compressed );
+      result.assign( data.size() + 1, 0 );
+      const bool ok = details::lzDecompress( &compressed[ 0 ], compressed.size(),
+                                             &result[ 0 ], data.size() );
+      result.resize( data.size() );
+      nbok += ( ok && result == data ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << data.size() << " bytes -> " << compressed.size() << std::endl;
+    }
+
+  // Corrupted data and wrong sizes are detected.
+  data.assign( 1000, 3 );
+  details::lzCompress( &data[ 0 ], data.size(), compressed );
+  result.resize( 2000 );
+  nbok += ( ! details::lzDecompress( &compressed[ 0 ], compressed.size(), &result[ 0 ], 999 )
+            && ! details::lzDecompress( &compressed[ 0 ], compressed.size(), &result[ 0 ], 1001 )
+            && ! details::lzDecompress( &compressed[ 0 ], compressed.size() - 2, &result[ 0 ], 1000 ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "corrupted data" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Round trips through BlockVolWriter and BlockVolReader.
+ */
+bool testRoundTrips()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing bvol round trips ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image3D;
+  const Image3D imageVol = VolReader<Image3D>::importVol( testPath + "samples/cat10.vol" );
+  BlockVolWriter<Image3D>::exportBlockVol( "testBlockVol-cat10.bvol", imageVol, 16 );
+  const Image3D image = BlockVolReader<Image3D>::importBlockVol( "testBlockVol-cat10.bvol" );
+  nbok += ( image.domain().upperBound() == Z3i::Point( 39, 39, 39 )
+            && sameValues( imageVol, image ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "cat10: " << fileSize( "testBlockVol-cat10.bvol" ) << " bytes instead of "
+               << fileSize( testPath + "samples/cat10.vol" ) << std::endl;
+
+  const Image3D imageGeneric = GenericReader<Image3D>::import( "testBlockVol-cat10.bvol" );
+  nbok += sameValues( imageVol, imageGeneric ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "GenericReader" << std::endl;
+
+  // 2D, 16 bits values, partial bricks, translated domain.
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned int> Image2D;
+  Image2D image2D( Z2i::Domain( Z2i::Point( -10, 5 ), Z2i::Point( 90, 47 ) ) );
+  for ( Z2i::Domain::ConstIterator it = image2D.domain().begin(),
+          itend = image2D.domain().end(); it != itend; ++it )
+    image2D.setValue( *it, ( (*it)[ 0 ] * (*it)[ 0 ] + 300 * (*it)[ 1 ] ) % 65536 );
+  BlockVolWriter<Image2D>::exportBlockVol( "testBlockVol-2D.bvol", image2D, 7, 2 );
+  const Image2D image2DRead = BlockVolReader<Image2D>::importBlockVol( "testBlockVol-2D.bvol" );
+  nbok += ( image2DRead.domain().upperBound() == Z2i::Point( 100, 42 )
+            && sameValues( image2D, image2DRead ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D, 16 bits values" << std::endl;
+
+  // Label volume: a few balls in a 128^3 volume.
+  typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> ImageLabel;
+  ImageLabel labels( Z3i::Domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 127, 127, 127 ) ) );
+  for ( Z3i::Domain::ConstIterator it = labels.domain().begin(),
+          itend = labels.domain().end(); it != itend; ++it )
+    {
+      DGtal::uint32_t label = 0;
+      for ( unsigned int i = 0; i < 5; ++i )
+        {
+          const Z3i::Vector v = *it - Z3i::Point( 20 + 20 * i, 64, 30 + 15 * i );
+          if ( v.dot( v ) < 400 )
+            label = 1000 * ( i + 1 );
+        }
+      labels.setValue( *it, label );
+    }
+  BlockVolWriter<ImageLabel>::exportBlockVol( "testBlockVol-labels.bvol", labels );
+  const ImageLabel labelsRead = BlockVolReader<ImageLabel>::importBlockVol( "testBlockVol-labels.bvol" );
+  const double ratio = 128.0 * 128.0 * 128.0 * 4.0 / fileSize( "testBlockVol-labels.bvol" );
+  nbok += ( sameValues( labels, labelsRead ) && ratio > 50 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "labels, compression ratio=" << ratio << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+std::streamoff fileLength( const std::string & aFilename )
+{
+  std::ifstream in( aFilename.c_str(), std::ifstream::in | std::ifstream::binary );
+  in.seekg( 0, std::ios::end );
+  return in.tellg();
+}
+
+/**
+ * Brick access and update with BlockVolume.
+ */
+bool testBricks()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing BlockVolume bricks ..." );
+
+  std::vector<unsigned int> extent( 3 );
+  extent[ 0 ] = 20; extent[ 1 ] = 10; extent[ 2 ] = 5;
+  BlockVolume volume;
+  volume.create( "testBlockVol-bricks.bvol", extent, 8, 8 );
+  trace.info() << volume << std::endl;
+  nbok += ( volume.nbBricks() == 3 * 2 * 1 && volume.gridExtent()[ 0 ] == 3 ) ? 1 : 0;
+  nb++;
+
+  std::vector<unsigned int> lower, size, coordinates( 3, 0 );
+  coordinates[ 0 ] = 2; coordinates[ 1 ] = 1;
+  const std::size_t index = volume.brickIndex( coordinates );
+  volume.brickBounds( index, lower, size );
+  nbok += ( index == 5 && lower[ 0 ] == 16 && lower[ 1 ] == 8 && size[ 0 ] == 4
+            && size[ 1 ] == 2 && size[ 2 ] == 5 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "grid of bricks" << std::endl;
+
+  std::vector<BlockVolume::RawValue> values( 4 * 2 * 5 ), read;
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    values[ i ] = 0x0123456789abcdefULL * i;
+  volume.writeBrick( index, values );
+  // Grown brick: written at the end of the file.
+  values[ 3 ] = 17;
+  volume.writeBrick( 0, std::vector<BlockVolume::RawValue>( 8 * 8 * 5, 3 ) );
+  volume.writeBrick( index, values );
+  volume.close();
+
+  volume.open( "testBlockVol-bricks.bvol" );
+  volume.readBrick( index, read );
+  bool ok = ( read == values );
+  volume.readBrick( 0, read );
+  ok = ok && ( read == std::vector<BlockVolume::RawValue>( 8 * 8 * 5, 3 ) );
+  volume.readBrick( 1, read );
+  ok = ok && ( read == std::vector<BlockVolume::RawValue>( 8 * 8 * 5, 0 ) );
+  nbok += ( ok && volume.brickStoredSize( 1 ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "64 bits values, rewritten and empty bricks" << std::endl;
+
+  bool error = false;
+  try
+    {
+      volume.writeBrick( 1, read );
+    }
+  catch ( DGtal::IOException & )
+    {
+      error = true;
+    }
+  nbok += error ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "read only file" << std::endl;
+
+  // The space of grown, zero or shrunk bricks is reused.
+  volume.open( "testBlockVol-bricks.bvol", true );
+  volume.writeBrick( 1, std::vector<BlockVolume::RawValue>( 8 * 8 * 5, 5 ) );
+  std::streamoff fileSize = 0;
+  std::vector<BlockVolume::RawValue> other( 4 * 8 * 5 );
+  for ( unsigned int i = 0; i < 10; ++i )
+    {
+      values[ i ] = i;
+      for ( unsigned int k = 0; k < other.size(); ++k )
+        other[ k ] = 0x0123456789abcdefULL * ( k + i );
+      volume.writeBrick( index, std::vector<BlockVolume::RawValue>( values.size(), 0 ) );
+      volume.writeBrick( 2, other );
+      volume.writeBrick( 2, std::vector<BlockVolume::RawValue>( 4 * 8 * 5, 0 ) );
+      volume.writeBrick( index, values );
+      if ( i == 0 )
+        fileSize = fileLength( "testBlockVol-bricks.bvol" );
+    }
+  volume.close();
+  volume.open( "testBlockVol-bricks.bvol" );
+  volume.readBrick( index, read );
+  ok = ( read == values );
+  volume.readBrick( 1, read );
+  ok = ok && ( read == std::vector<BlockVolume::RawValue>( 8 * 8 * 5, 5 ) );
+  nbok += ( ok && fileLength( "testBlockVol-bricks.bvol" ) == fileSize ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "free space reused, file size=" << fileSize << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing bvol format" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCodec() && testRoundTrips() && testBricks(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
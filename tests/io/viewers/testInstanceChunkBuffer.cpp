@@ -0,0 +1,248 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testInstanceChunkBuffer.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class InstanceChunkBuffer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/io/Color.h"
+#include "DGtal/io/viewers/InstanceChunkBuffer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// Same fields as Display3D::CubeD3D.
+struct CubeD3D
+{
+  Z3i::RealPoint center;
+  Color color;
+  double width;
+};
+
+/// Same fields as Display3D::QuadD3D.
+struct QuadD3D
+{
+  Z3i::RealPoint point1, point2, point3, point4;
+  double nx, ny, nz;
+  Color color;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class InstanceChunkBuffer.
+///////////////////////////////////////////////////////////////////////////////
+
+CubeD3D makeCube( int x, int y, int z )
+{
+  CubeD3D cube;
+  cube.center = Z3i::RealPoint( x, y, z );
+  cube.color = Color( x & 255, y & 255, z & 255 );
+  cube.width = 0.5;
+  return cube;
+}
+
+/**
+   Checks that only the chunks that have changed are marked dirty.
+*/
+bool testDirtyChunks()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing dirty chunks ..." );
+  std::vector< CubeD3D > cubes;
+  for ( int x = 0; x < 10; ++x )
+    for ( int y = 0; y < 10; ++y )
+      for ( int z = 0; z < 10; ++z )
+        cubes.push_back( makeCube( x, y, z ) );
+
+  InstanceChunkBuffer< CubeInstance3D > buffer( 64 );
+  nbok += ( buffer.update( &cubes[ 0 ], &cubes[ 0 ] + cubes.size() ) == 16 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << buffer << " all chunks dirty" << std::endl;
+  buffer.clearDirty();
+  nbok += ( buffer.update( cubes.begin(), cubes.end() ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same cubes, no dirty chunk" << std::endl;
+
+  cubes[ 130 ].color = Color::Red;
+  nbok += ( ( buffer.update( cubes.begin(), cubes.end() ) == 1 )
+            && buffer.chunks()[ 2 ].dirty ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "one cube changed, one dirty chunk" << std::endl;
+  buffer.clearDirty();
+
+  // Appending cubes changes the last (partial) chunk and adds new ones.
+  for ( int x = 0; x < 100; ++x )
+    cubes.push_back( makeCube( x, 20, 0 ) );
+  nbok += ( ( buffer.update( cubes.begin(), cubes.end() ) == 3 )
+            && ( buffer.size() == 1100 ) && ( buffer.chunks().size() == 18 )
+            && ! buffer.chunks()[ 14 ].dirty && buffer.chunks()[ 15 ].dirty
+            && buffer.chunks()[ 16 ].dirty && buffer.chunks()[ 17 ].dirty ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << buffer << " appended cubes" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+   Checks the bit reversed order: each chunk is a permutation of its
+   cubes, and prefixes are spread over the whole chunk.
+*/
+bool testChunkOrder()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing chunk order ..." );
+  std::vector< CubeD3D > cubes;
+  for ( int x = 0; x < 200; ++x )
+    cubes.push_back( makeCube( x, 0, 0 ) );
+  InstanceChunkBuffer< CubeInstance3D > buffer( 128 );
+  buffer.update( cubes.begin(), cubes.end() );
+
+  bool permutation = true;
+  const std::vector< InstanceChunkBuffer< CubeInstance3D >::Chunk > & chunks
+    = buffer.chunks();
+  for ( std::size_t c = 0; c < chunks.size(); ++c )
+    {
+      std::vector< bool > seen( chunks[ c ].count, false );
+      for ( std::size_t k = 0; k < chunks[ c ].count; ++k )
+        {
+          const int x = int( buffer.data()[ chunks[ c ].first + k ].center[ 0 ] )
+            - int( chunks[ c ].first );
+          permutation = permutation && ( x >= 0 )
+            && ( x < int( chunks[ c ].count ) ) && ! seen[ x ];
+          if ( permutation ) seen[ x ] = true;
+        }
+    }
+  nbok += ( permutation && ( chunks.size() == 2 ) && ( chunks[ 1 ].count == 72 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "chunks are permutations" << std::endl;
+
+  // The first 16 cubes of the first chunk are one every 8 cubes.
+  std::vector< bool > bucket( 16, false );
+  for ( std::size_t k = 0; k < 16; ++k )
+    bucket[ int( buffer.data()[ k ].center[ 0 ] ) / 8 ] = true;
+  bool spread = true;
+  for ( std::size_t k = 0; k < 16; ++k )
+    spread = spread && bucket[ k ];
+  nbok += spread ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "prefixes are spread" << std::endl;
+
+  const CubeInstance3D & first = buffer.data()[ 0 ];
+  nbok += ( ( chunks[ 0 ].lo[ 0 ] == -0.5f ) && ( chunks[ 0 ].up[ 0 ] == 127.5f )
+            && ( chunks[ 0 ].size == 1.0f ) && ( first.width == 0.5f )
+            && ( first.color[ 0 ] == ( int( first.center[ 0 ] ) & 255 ) )
+            && ( first.color[ 3 ] == 255 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bounding box and packed cube" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+   Checks frustum culling and levels of detail.
+*/
+bool testCullingAndLOD()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing culling and levels of detail ..." );
+  typedef InstanceChunkBuffer< QuadInstance3D > QuadBuffer;
+  std::vector< QuadD3D > quads( 1 );
+  quads[ 0 ].point1 = Z3i::RealPoint( 10, 0, 0 );
+  quads[ 0 ].point2 = Z3i::RealPoint( 11, 0, 0 );
+  quads[ 0 ].point3 = Z3i::RealPoint( 11, 1, 0 );
+  quads[ 0 ].point4 = Z3i::RealPoint( 10, 1, 0 );
+  quads[ 0 ].color = Color::Blue;
+  QuadBuffer buffer;
+  buffer.update( quads.begin(), quads.end() );
+  const QuadBuffer::Chunk & chunk = buffer.chunks()[ 0 ];
+
+  // The box [-5,5]^3.
+  double planes[ 6 ][ 4 ] = { { 1, 0, 0, 5 }, { -1, 0, 0, 5 },
+                              { 0, 1, 0, 5 }, { 0, -1, 0, 5 },
+                              { 0, 0, 1, 5 }, { 0, 0, -1, 5 } };
+  const bool culled = ! QuadBuffer::isVisible( chunk, planes );
+  planes[ 1 ][ 3 ] = 10.5;
+  nbok += ( culled && QuadBuffer::isVisible( chunk, planes ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "frustum culling" << std::endl;
+
+  // Size 1, seen at distance 10 with 100 pixels per unit: 10 pixels.
+  const double eye[ 3 ] = { 10.5, 0.5, 10.0 };
+  nbok += ( ( QuadBuffer::lodLevel( chunk, eye, 100.0, 10.0, 4 ) == 0 )
+            && ( QuadBuffer::lodLevel( chunk, eye, 100.0, 20.0, 4 ) == 1 )
+            && ( QuadBuffer::lodLevel( chunk, eye, 100.0, 30.0, 4 ) == 2 )
+            && ( QuadBuffer::lodLevel( chunk, eye, 100.0, 1000.0, 4 ) == 4 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "levels of detail" << std::endl;
+
+  nbok += ( ( QuadBuffer::lodCount( 100, 0 ) == 100 )
+            && ( QuadBuffer::lodCount( 100, 1 ) == 25 )
+            && ( QuadBuffer::lodCount( 101, 1 ) == 26 )
+            && ( InstanceChunkBuffer< CubeInstance3D >::lodCount( 100, 2 ) == 2 )
+            && ( QuadBuffer::lodCount( 0, 3 ) == 0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "instances per level" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class InstanceChunkBuffer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testDirtyChunks() && testChunkOrder() && testCullingAndLOD();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,154 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshStreamWriter.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class MeshStreamWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CanonicCellEmbedder.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/io/readers/MeshReader.h"
+#include "DGtal/io/writers/MeshStreamWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MeshStreamWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the signed volume enclosed by a closed mesh.
+ */
+double signedVolume( const Mesh<RealPoint> & aMesh )
+{
+  double volume = 0.0;
+  for ( unsigned int i = 0; i < aMesh.nbFaces(); ++i )
+    {
+      const unsigned int * f = aMesh.getFaceIndices( i );
+      const RealPoint & p0 = aMesh.getVertex( f[ 0 ] );
+      for ( unsigned int j = 1; j + 1 < aMesh.getFaceSize( i ); ++j )
+        {
+          const RealPoint & p1 = aMesh.getVertex( f[ j ] );
+          const RealPoint & p2 = aMesh.getVertex( f[ j + 1 ] );
+          volume += ( p0[ 0 ] * ( p1[ 1 ] * p2[ 2 ] - p1[ 2 ] * p2[ 1 ] )
+                      - p0[ 1 ] * ( p1[ 0 ] * p2[ 2 ] - p1[ 2 ] * p2[ 0 ] )
+                      + p0[ 2 ] * ( p1[ 0 ] * p2[ 1 ] - p1[ 1 ] * p2[ 0 ] ) ) / 6.0;
+        }
+    }
+  return volume;
+}
+
+bool testMeshStreamWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Streaming faces ..." );
+  {
+    MeshStreamWriter<Point> writer( "testMeshStreamWriter-quad.off", 
+                                    MeshStreamWriter<Point>::OFF, true );
+    writer.addVertex( Point( 0, 0, 0 ) );
+    writer.addVertex( Point( 1, 0, 0 ) );
+    writer.addVertex( Point( 1, 1, 0 ) );
+    writer.addVertex( Point( 0, 1, 0 ) );
+    writer.addQuadFace( 0, 1, 2, 3, Color( 255, 0, 0 ) );
+    writer.addTriangularFace( 0, 1, 2 );
+    trace.info() << writer << std::endl;
+  } // closed by the destructor
+  Mesh<Point> aMesh( true );
+  aMesh << "testMeshStreamWriter-quad.off";
+  nbok += aMesh.nbVertex() == 4 && aMesh.nbFaces() == 2 
+    && aMesh.getFaceSize( 0 ) == 4 && aMesh.getFaceIndices( 1 )[ 2 ] == 2
+    && aMesh.getVertex( 2 ) == Point( 1, 1, 0 ) 
+    && aMesh.getFaceColor( 0 ) == Color( 255, 0, 0 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "OFF streaming" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Streaming a digital surface ..." );
+  Domain domain( Point::diagonal( -10 ), Point::diagonal( 10 ) );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 7 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( 1, 0, 0 ), 3 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  typedef DigitalSetBoundary<KSpace, DigitalSet> Boundary;
+  typedef DigitalSurface<Boundary> MyDigitalSurface;
+  MyDigitalSurface aSurface( new Boundary( K, aSet ) );
+  CanonicCellEmbedder<KSpace> embedder( K );
+
+  const std::string names[ 3 ] = { "testMeshStreamWriter.ply", 
+                                   "testMeshStreamWriter-ascii.ply",
+                                   "testMeshStreamWriter.off" };
+  const MeshStreamWriter<RealPoint>::Format formats[ 3 ] = 
+    { MeshStreamWriter<RealPoint>::PLY_BINARY, MeshStreamWriter<RealPoint>::PLY_ASCII,
+      MeshStreamWriter<RealPoint>::OFF };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      MeshStreamWriter<RealPoint> writer( names[ i ], formats[ i ] );
+      writer.addDigitalSurface( aSurface, embedder );
+      nbok += writer.nbFaces() == aSurface.size() ? 1 : 0; nb++;
+      writer.close();
+
+      Mesh<RealPoint> aSurfaceMesh( false, true );
+      aSurfaceMesh << names[ i ];
+      // Two closed surfaces (sphere-like), with quads only: V - F = 4.
+      nbok += aSurfaceMesh.nbFaces() == aSurface.size() 
+        && aSurfaceMesh.nbVertex() == aSurfaceMesh.nbFaces() + 4 ? 1 : 0; nb++;
+      // The quads are oriented outward: they enclose the voxels.
+      const double volume = signedVolume( aSurfaceMesh );
+      nbok += std::abs( volume - (double) aSet.size() ) < 1e-6 ? 1 : 0; nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << names[ i ] 
+                   << " #V=" << aSurfaceMesh.nbVertex() << " #F=" << aSurfaceMesh.nbFaces()
+                   << " volume=" << volume << " #voxels=" << aSet.size() << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MeshStreamWriter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMeshStreamWriter(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
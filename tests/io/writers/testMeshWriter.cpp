@@ -35,6 +35,8 @@
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/io/writers/MeshWriter.h"
 //! [MeshWriterUseIncludes]
+#include "DGtal/io/readers/MeshReader.h"
+#include <fstream>
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -89,6 +91,124 @@ bool testMeshWriter()
   return nbok == nb;
 }
 
+/**
+ * Checks that two meshes have the same vertices, faces and colors.
+ */
+template <typename TPoint>
+bool sameMeshes( const Mesh<TPoint> & m1, const Mesh<TPoint> & m2, bool withColors )
+{
+  if ( m1.nbVertex() != m2.nbVertex() || m1.nbFaces() != m2.nbFaces() )
+    return false;
+  for ( unsigned int i = 0; i < m1.nbVertex(); ++i )
+    if ( m1.getVertex( i ) != m2.getVertex( i ) )
+      return false;
+  for ( unsigned int i = 0; i < m1.nbFaces(); ++i )
+    {
+      if ( m1.getFaceSize( i ) != m2.getFaceSize( i ) )
+        return false;
+      for ( unsigned int j = 0; j < m1.getFaceSize( i ); ++j )
+        if ( m1.getFaceIndices( i )[ j ] != m2.getFaceIndices( i )[ j ] )
+          return false;
+      if ( withColors && m1.getFaceColor( i ) != m2.getFaceColor( i ) )
+        return false;
+    }
+  return true;
+}
+
+bool testMeshWriterPLY()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing flat face storage ..." );
+  // A cube, with both face layouts.
+  Mesh<Point> aMesh(true);  
+  Mesh<Point> aFlatMesh(true, true);  
+  for ( unsigned int i = 0; i < 8; ++i )
+    {
+      Point p( i & 1, ( i >> 1 ) & 1, ( i >> 2 ) & 1 );
+      aMesh.addVertex( p );
+      aFlatMesh.addVertex( p );
+    }
+  const unsigned int quads[ 6 ][ 4 ] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 },
+                                         { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+  for ( unsigned int f = 0; f < 6; ++f )
+    {
+      DGtal::Color col( 40 * f, 255 - 40 * f, 7, 128 + f );
+      aMesh.addQuadFace( quads[ f ][ 0 ], quads[ f ][ 1 ], quads[ f ][ 2 ], quads[ f ][ 3 ], col );
+      aFlatMesh.addFace( quads[ f ], 4, col );
+    }
+  aMesh.addTriangularFace( 0, 1, 2 );
+  aFlatMesh.addTriangularFace( 0, 1, 2 );
+  nbok += aFlatMesh.isStoringFlatFaces() && ! aMesh.isStoringFlatFaces() ? 1 : 0; nb++;
+  nbok += sameMeshes( aMesh, aFlatMesh, true ) ? 1 : 0; nb++;
+  nbok += aFlatMesh.getFace( 3 ).size() == 4 && aFlatMesh.getFace( 3 )[ 1 ] == 6 ? 1 : 0; nb++;
+  aMesh.invertVertexFaceOrder();
+  aFlatMesh.invertVertexFaceOrder();
+  nbok += sameMeshes( aMesh, aFlatMesh, true ) && aFlatMesh.getFaceIndices( 6 )[ 0 ] == 2 ? 1 : 0; nb++;
+  // An empty last face has no indices.
+  Mesh<Point> anEmptyFaceMesh(false, true);
+  anEmptyFaceMesh.addTriangularFace( 0, 1, 2 );
+  anEmptyFaceMesh.addFace( static_cast<const unsigned int*>( 0 ), 0 );
+  nbok += anEmptyFaceMesh.getFaceSize( 1 ) == 0 && anEmptyFaceMesh.getFaceIndices( 1 ) == 0 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "flat faces == vector faces" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing PLY export/import ..." );
+  nbok += aMesh >> "testMeshWriter.ply" ? 1 : 0; nb++;
+  Mesh<Point> aBinaryMesh(true);
+  nbok += aBinaryMesh << "testMeshWriter.ply" ? 1 : 0; nb++;
+  nbok += sameMeshes( aMesh, aBinaryMesh, true ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "binary PLY export/import" << std::endl;
+
+  std::ofstream out( "testMeshWriter-ascii.ply" );
+  nbok += MeshWriter<Point>::export2PLY( out, aFlatMesh, false, true ) ? 1 : 0; nb++;
+  out.close();
+  Mesh<Point> anAsciiMesh(true, true);
+  nbok += MeshReader<Point>::importPLYFile( "testMeshWriter-ascii.ply", anAsciiMesh ) ? 1 : 0; nb++;
+  nbok += sameMeshes( aMesh, anAsciiMesh, true ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "ascii PLY export/import" << std::endl;
+
+  // Real coordinates, without colors, inverted at import.
+  Mesh<RealPoint> aRealMesh;
+  aRealMesh.addVertex( RealPoint( 0.1, -2.5, 1e-7 ) );
+  aRealMesh.addVertex( RealPoint( 3.25, 1.0 / 3.0, -1e12 ) );
+  aRealMesh.addVertex( RealPoint( 0.0, 0.0, 42.0 ) );
+  aRealMesh.addTriangularFace( 0, 1, 2 );
+  nbok += aRealMesh >> "testMeshWriter-real.ply" ? 1 : 0; nb++;
+  Mesh<RealPoint> aRealMesh2;
+  MeshReader<RealPoint>::importPLYFile( "testMeshWriter-real.ply", aRealMesh2, true );
+  aRealMesh.invertVertexFaceOrder();
+  nbok += sameMeshes( aRealMesh, aRealMesh2, false ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "real coordinates are exact in binary PLY" << std::endl;
+
+  std::ofstream outInvalid( "testMeshWriter-invalid.ply" );
+  outInvalid << "ply\nformat ascii 1.0\nelement vertex 3\nproperty float x\n"
+             << "property float y\nproperty float z\nelement face 1\n"
+             << "property list uchar int vertex_indices\nend_header\n"
+             << "0 0 0\n1 0 0\n0 1 0\n3 0 1 3\n";
+  outInvalid.close();
+  bool invalid = false;
+  try
+    {
+      Mesh<RealPoint> anInvalidMesh;
+      MeshReader<RealPoint>::importPLYFile( "testMeshWriter-invalid.ply", anInvalidMesh );
+    }
+  catch ( DGtal::IOException & )
+    {
+      invalid = true;
+    }
+  nbok += invalid ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "out of range vertex index is rejected" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -100,7 +220,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMeshWriter(); // && ... other tests
+  bool res = testMeshWriter() && testMeshWriterPLY(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,302 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByRuns.cpp
+ * @ingroup Tests
+ *
+ * @brief A test file for run-length encoded sets and images
+ * (DigitalSetByRuns, ImageContainerByRuns) and the extraction of their
+ * boundary (Surfaces::sMakeBoundaryFromRuns).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ImageContainerByRuns.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DigitalSetByRuns<Z3i::Domain> RunSet;
+
+/**
+ * Fills @a aSet and @a aRunSet with the same random balls.
+ */
+void randomBalls( Z3i::DigitalSet & aSet, RunSet & aRunSet, unsigned int nb )
+{
+  const Z3i::Domain & domain = aSet.domain();
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      const Z3i::Point c( domain.lowerBound()[ 0 ] + rand() % 20,
+                          domain.lowerBound()[ 1 ] + rand() % 16,
+                          domain.lowerBound()[ 2 ] + rand() % 12 );
+      const int r = 1 + rand() % 5;
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+        if ( ( *it - c ).dot( *it - c ) <= r * r )
+          {
+            aSet.insert( *it );
+            aRunSet.insert( *it );
+          }
+    }
+}
+
+/**
+ * @return 'true' iff @a aSet and @a aRunSet have the same points on
+ * the domain.
+ */
+bool sameSet( const Z3i::DigitalSet & aSet, const RunSet & aRunSet )
+{
+  bool ok = aRunSet.isValid() && ( aSet.size() == aRunSet.size() );
+  for ( Z3i::Domain::ConstIterator it = aSet.domain().begin(), itend = aSet.domain().end(); it != itend; ++it )
+    ok = ok && ( aSet( *it ) == aRunSet( *it ) );
+  return ok;
+}
+
+bool testDigitalSetByRuns()
+{
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< RunSet > ));
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByRuns ..." );
+
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 0 ), Z3i::Point( 21, 19, 13 ) );
+  srand( 11 );
+  Z3i::DigitalSet setA( domain ), setB( domain );
+  RunSet runsA( domain ), runsB( domain );
+  randomBalls( setA, runsA, 6 );
+  randomBalls( setB, runsB, 6 );
+  trace.info() << runsA << " " << runsB << std::endl;
+
+  ++nb; nbok += ( sameSet( setA, runsA ) && sameSet( setB, runsB ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "insertion and membership" << std::endl;
+
+  //Iteration in the domain order
+  std::vector<Z3i::Point> points;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    if ( setA( *it ) ) points.push_back( *it );
+  bool ok = std::equal( points.begin(), points.end(), runsA.begin() );
+  std::vector<Z3i::Point> reversed;
+  RunSet::ConstIterator it = runsA.end();
+  while ( it != runsA.begin() ) reversed.push_back( *--it );
+  ok = ok && ( reversed.size() == points.size() )
+    && std::equal( reversed.rbegin(), reversed.rend(), points.begin() );
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "iteration (forward and backward)" << std::endl;
+
+  //Range insertion (in any order)
+  RunSet runsC( domain );
+  std::random_shuffle( points.begin(), points.end() );
+  runsC.insert( points.begin(), points.end() );
+  ++nb; nbok += ( sameSet( setA, runsC ) && ( runsC.nbRuns() == runsA.nbRuns() ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "range insertion" << std::endl;
+
+  //Set algebra
+  Z3i::DigitalSet uSet( setA ), iSet( domain ), dSet( domain ), cSet( domain );
+  uSet += setB;
+  for ( Z3i::Domain::ConstIterator p = domain.begin(), pend = domain.end(); p != pend; ++p )
+    {
+      if ( setA( *p ) && setB( *p ) ) iSet.insert( *p );
+      if ( setA( *p ) && ! setB( *p ) ) dSet.insert( *p );
+      if ( ! setA( *p ) ) cSet.insert( *p );
+    }
+  RunSet uRuns( runsA ), iRuns( runsA ), dRuns( runsA ), cRuns( domain );
+  uRuns += runsB;
+  iRuns *= runsB;
+  dRuns -= runsB;
+  cRuns.assignFromComplement( runsA );
+  ++nb; nbok += ( sameSet( uSet, uRuns ) && sameSet( iSet, iRuns )
+                  && sameSet( dSet, dRuns ) && sameSet( cSet, cRuns ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "union, intersection, difference, complement" << std::endl;
+
+  RunSet cRuns2( domain );
+  DigitalSetInserter<RunSet> inserter( cRuns2 );
+  runsA.computeComplement( inserter );
+  ++nb; nbok += sameSet( cSet, cRuns2 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "computeComplement" << std::endl;
+
+  //Erasure: points, runs and iterator ranges
+  RunSet eRuns( runsA );
+  Z3i::DigitalSet eSet( setA );
+  for ( Z3i::Domain::ConstIterator p = domain.begin(), pend = domain.end(); p != pend; ++p )
+    if ( ( (*p)[ 0 ] + (*p)[ 1 ] ) % 3 == 0 )
+      {
+        eSet.erase( *p );
+        eRuns.erase( *p );
+      }
+  ok = sameSet( eSet, eRuns );
+  RunSet::ConstIterator first = eRuns.begin(), last = eRuns.end();
+  for ( unsigned int i = 0; i < eRuns.size() / 3; ++i ) ++first;
+  for ( unsigned int i = 0; i < eRuns.size() / 3; ++i ) --last;
+  std::vector<Z3i::Point> erased( first, last );
+  eRuns.erase( first, last );
+  for ( unsigned int i = 0; i < erased.size(); ++i ) eSet.erase( erased[ i ] );
+  ok = ok && sameSet( eSet, eRuns );
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "erasure" << std::endl;
+
+  //Bounding box
+  Z3i::Point l1, u1, l2, u2;
+  setA.computeBoundingBox( l1, u1 );
+  runsA.computeBoundingBox( l2, u2 );
+  ++nb; nbok += ( ( l1 == l2 ) && ( u1 == u2 ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bounding box" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testImageContainerByRuns()
+{
+  typedef ImageContainerByRuns<Z3i::Domain> Image;
+  BOOST_CONCEPT_ASSERT(( CImage< Image > ));
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageContainerByRuns ..." );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 9, 7 ) );
+  Image image( domain );
+  std::vector<bool> values;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it )
+    {
+      values.push_back( ( rand() % 4 ) != 0 );
+      image.setValue( *it, values.back() );
+    }
+  bool ok = image.isValid();
+  unsigned int i = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it, ++i )
+    ok = ok && ( image( *it ) == values[ i ] );
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "setValue " << image << std::endl;
+
+  //Rows along each axis
+  ok = true;
+  for ( Dimension d = 0; d < 3; ++d )
+    {
+      Z3i::Point upper = domain.upperBound();
+      upper[ d ] = 0;
+      const Z3i::Domain starts( domain.lowerBound(), upper );
+      const Z3i::Domain::Size n = domain.upperBound()[ d ] + 1;
+      for ( Z3i::Domain::ConstIterator it = starts.begin(), itend = starts.end(); it != itend; ++it )
+        {
+          std::vector<bool> row;
+          rowFromImage( image, *it, d, n, std::back_inserter( row ) );
+          Z3i::Point p = *it;
+          for ( unsigned int j = 0; j < n; ++j, ++p[ d ] )
+            ok = ok && ( row[ j ] == image( p ) );
+          for ( unsigned int j = 0; j < n; ++j )
+            row[ j ] = ( j % 3 != 1 ) && ( ( (*it)[ 1 ] + j ) % 5 != 0 );
+          imageFromRow( image, *it, d, n, row.begin() );
+          p = *it;
+          for ( unsigned int j = 0; j < n; ++j, ++p[ d ] )
+            ok = ok && ( row[ j ] == image( p ) );
+        }
+    }
+  ok = ok && image.isValid();
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "rowFromImage / imageFromRow" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testBoundaryFromRuns()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Surfaces::sMakeBoundaryFromRuns ..." );
+
+  //Balls touching the domain bounds as well
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 19, 15, 11 ) );
+  Z3i::DigitalSet set( domain );
+  RunSet runs( domain );
+  randomBalls( set, runs, 5 );
+
+  Z3i::KSpace K;
+  K.init( domain.lowerBound() - Z3i::Point::diagonal( 1 ),
+          domain.upperBound() + Z3i::Point::diagonal( 1 ), true );
+  std::set<Z3i::SCell> reference, boundary;
+  Surfaces<Z3i::KSpace>::sMakeBoundary( reference, K, set,
+                                        domain.lowerBound() - Z3i::Point::diagonal( 1 ),
+                                        domain.upperBound() + Z3i::Point::diagonal( 1 ) );
+  Surfaces<Z3i::KSpace>::sMakeBoundaryFromRuns( boundary, K, runs );
+  trace.info() << "Boundary: " << boundary.size() << " surfels, "
+               << reference.size() << " expected." << std::endl;
+  ++nb; nbok += ( boundary == reference ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "signed boundary" << std::endl;
+
+  std::set<Z3i::Cell> uReference, uBoundary;
+  Surfaces<Z3i::KSpace>::uMakeBoundary( uReference, K, set,
+                                        domain.lowerBound() - Z3i::Point::diagonal( 1 ),
+                                        domain.upperBound() + Z3i::Point::diagonal( 1 ) );
+  Surfaces<Z3i::KSpace>::uMakeBoundaryFromRuns( uBoundary, K, runs );
+  ++nb; nbok += ( uBoundary == uReference ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "unsigned boundary" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing run-length encoded sets and images" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testDigitalSetByRuns() && testImageContainerByRuns()
+    && testBoundaryFromRuns();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
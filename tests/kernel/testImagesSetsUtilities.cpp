@@ -34,6 +34,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/images/imagesSetsUtils/ImageFromSet.h"
@@ -221,6 +224,79 @@ bool testSetFromImage()
   return nbok == nb;
 }
 
+bool testSetFromImageParallel()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing parallel SetFromImage ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain, bool> BitImage;
+  Z3i::Domain d( Z3i::Point( -3, 0, 2 ), Z3i::Point( 20, 17, 25 ) );
+  Image image( d );
+  srand( 3 );
+  for ( Z3i::Domain::ConstIterator it = d.begin(), itend = d.end(); it != itend; ++it )
+    image.setValue( *it, rand() % 10 );
+
+  //Reference: sequential iterator-based version
+  IntervalForegroundPredicate<Image> interval( image, 2, 6 );
+  Z3i::DigitalSet reference( d );
+  SetFromImage<Z3i::DigitalSet>::append<Image>( reference, interval, d.begin(), d.end() );
+
+  //Row-based version
+  Z3i::DigitalSet aSet( d );
+  SetFromImage<Z3i::DigitalSet>::append<Image>( aSet, image, 2, 6 );
+  nbok += ( aSet.size() == reference.size()
+            && std::equal( aSet.begin(), aSet.end(), reference.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "interval (by rows) == sequential" << std::endl;
+
+  //Generic predicate version
+  typedef std::binder2nd< std::greater<int> > ValuePredicate;
+  ValuePredicate greaterThan4( std::greater<int>(), 4 );
+  PointFunctorPredicate<Image, ValuePredicate> generic( image, greaterThan4 );
+  Z3i::DigitalSet aSet2( d );
+  SetFromImage<Z3i::DigitalSet>::append( aSet2, image, generic );
+  SimpleThresholdForegroundPredicate<Image> threshold( image, 4 );
+  Z3i::DigitalSet aSet3( d );
+  SetFromImage<Z3i::DigitalSet>::append( aSet3, image, threshold );
+  bool ok = ( aSet2.size() == aSet3.size() );
+  for ( Z3i::Domain::ConstIterator it = d.begin(), itend = d.end(); it != itend; ++it )
+    ok = ok && ( ( image( *it ) > 4 ) == ( aSet2.find( *it ) != aSet2.end() ) )
+      && ( ( image( *it ) > 4 ) == ( aSet3.find( *it ) != aSet3.end() ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "generic and threshold predicates" << std::endl;
+
+  //Non-empty set
+  Z3i::DigitalSet aSet4( aSet3 );
+  SetFromImage<Z3i::DigitalSet>::append<Image>( aSet4, image, 2, 6 );
+  ok = true;
+  for ( Z3i::Domain::ConstIterator it = d.begin(), itend = d.end(); it != itend; ++it )
+    ok = ok && ( ( aSet3( *it ) || reference( *it ) ) == aSet4( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "append to a non-empty set" << std::endl;
+
+  //Dense output
+  BitImage bits( d );
+  SetFromImage<Z3i::DigitalSet>::appendToBitImage( bits, image, interval );
+  ok = true;
+  for ( Z3i::Domain::ConstIterator it = d.begin(), itend = d.end(); it != itend; ++it )
+    ok = ok && ( bits( *it ) == interval( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "appendToBitImage" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -232,7 +308,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImageFromSet() && testSetFromImage();
+  bool res = testImageFromSet() && testSetFromImage() && testSetFromImageParallel();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
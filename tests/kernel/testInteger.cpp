@@ -33,6 +33,8 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CUnsignedNumber.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include <sstream>
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -118,6 +120,62 @@ bool testInteger()
   return nbok == nb;
 }
 
+#ifdef WITH_INT128
+/**
+ * Checks the native 128-bit integers against 64-bit computations.
+ */
+bool testInt128()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Checking int128_t ..." );
+  BOOST_CONCEPT_ASSERT(( CInteger<DGtal::int128_t> ));
+  BOOST_CONCEPT_ASSERT(( CUnsignedNumber<DGtal::uint128_t> ));
+  trace.info() << "  - max int128 = " << NumberTraits<DGtal::int128_t>::max()
+         << std::endl;
+  trace.info() << "  - min int128 = " << NumberTraits<DGtal::int128_t>::min()
+         << std::endl;
+  std::ostringstream out;
+  out << NumberTraits<DGtal::int128_t>::min() << " " << NumberTraits<DGtal::uint128_t>::max()
+      << " " << (DGtal::int128_t) 0;
+  nbok += out.str() == "-170141183460469231731687303715884105728 "
+    "340282366920938463463374607431768211455 0" ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "operator<<" << std::endl;
+
+  // gcd, floor and ceil divisions, compared with int64_t.
+  IntegerComputer<DGtal::int128_t> ic128;
+  IntegerComputer<DGtal::int64_t> ic64;
+  DGtal::uint64_t x = 1;
+  unsigned int nbSame = 0;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+      const DGtal::int64_t a = (DGtal::int64_t) ( x >> 16 );
+      const DGtal::int64_t b = ( ( a >> 7 ) - 1000000 ) | 1;
+      const DGtal::int64_t c = ( i % 2 == 0 ) ? -a : a;
+      nbSame += ic128.gcd( c, b ) == ic64.gcd( c, b )
+        && ic128.floorDiv( c, b ) == ic64.floorDiv( c, b )
+        && ic128.ceilDiv( c, b ) == ic64.ceilDiv( c, b ) ? 1 : 0;
+    }
+  nbok += nbSame == 1000 ? 1 : 0;
+  nb++;
+  // Products of 64-bit integers.
+  const DGtal::int128_t big = (DGtal::int128_t) NumberTraits<DGtal::int64_t>::max() * 6;
+  nbok += ic128.gcd( big, (DGtal::int128_t) NumberTraits<DGtal::int64_t>::max() * 4 )
+    == (DGtal::int128_t) NumberTraits<DGtal::int64_t>::max() * 2
+    && ic128.floorDiv( -big, 11 ) == -( big / 11 ) - 1
+    && ic128.ceilDiv( big, 11 ) == big / 11 + 1 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "gcd, floorDiv, ceilDiv" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -129,7 +187,11 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testInteger(); // && ... other tests
+  bool res = testInteger()
+#ifdef WITH_INT128
+    && testInt128()
+#endif
+    ; // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,284 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testEigenValues3D.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class EigenValues3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/EigenValues3D.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef EigenValues3D< double > Eigen;
+typedef Eigen::Matrix33 Matrix33;
+typedef Eigen::Vector3 Vector3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class EigenValues3D.
+///////////////////////////////////////////////////////////////////////////////
+
+double getRandomNumber( double first, double last )
+{
+  double v = ((double)rand()) / (double) RAND_MAX;
+  return v * ( last - first ) + first;
+}
+
+/**
+ * @return a random symmetric matrix R diag(l0,l1,l2) R^t, with R a
+ * random rotation.
+ */
+Matrix33 randomSymmetricMatrix( double l0, double l1, double l2 )
+{
+  double r[ 3 ][ 3 ];
+  for ( unsigned int c = 0; c < 3; ++c )
+    {
+      for ( unsigned int k = 0; k < 3; ++k )
+        r[ c ][ k ] = getRandomNumber( -1.0, 1.0 );
+      // Gram-Schmidt
+      for ( unsigned int d = 0; d < c; ++d )
+        {
+          double dot = r[ c ][ 0 ] * r[ d ][ 0 ] + r[ c ][ 1 ] * r[ d ][ 1 ] + r[ c ][ 2 ] * r[ d ][ 2 ];
+          for ( unsigned int k = 0; k < 3; ++k )
+            r[ c ][ k ] -= dot * r[ d ][ k ];
+        }
+      double n = std::sqrt( r[ c ][ 0 ] * r[ c ][ 0 ] + r[ c ][ 1 ] * r[ c ][ 1 ] + r[ c ][ 2 ] * r[ c ][ 2 ] );
+      for ( unsigned int k = 0; k < 3; ++k )
+        r[ c ][ k ] /= n;
+    }
+  const double l[ 3 ] = { l0, l1, l2 };
+  Matrix33 m;
+  for ( unsigned int i = 0; i < 3; ++i )
+    for ( unsigned int j = 0; j < 3; ++j )
+      {
+        double v = 0.0;
+        for ( unsigned int c = 0; c < 3; ++c )
+          v += l[ c ] * r[ c ][ i ] * r[ c ][ j ];
+        m.setComponent( i, j, v );
+      }
+  // Exactly symmetric.
+  for ( unsigned int i = 0; i < 3; ++i )
+    for ( unsigned int j = 0; j < i; ++j )
+      m.setComponent( i, j, m( j, i ) );
+  return m;
+}
+
+/**
+ * Builds a set of symmetric matrices with distinct, double and
+ * triple eigen values, null or nearly multiple of the identity, at
+ * various scales.
+ */
+std::vector< Matrix33 > testMatrices()
+{
+  std::vector< Matrix33 > matrices;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      const double scale = std::pow( 10.0, getRandomNumber( -8.0, 8.0 ) );
+      const double a = getRandomNumber( -1.0, 1.0 ) * scale;
+      const double b = getRandomNumber( -1.0, 1.0 ) * scale;
+      const double d = getRandomNumber( -1.0, 1.0 ) * scale;
+      matrices.push_back( randomSymmetricMatrix( a, b, d ) );
+      matrices.push_back( randomSymmetricMatrix( a, b, b ) );
+      matrices.push_back( randomSymmetricMatrix( a, a, b ) );
+      matrices.push_back( randomSymmetricMatrix( a, a, a ) );
+      matrices.push_back( randomSymmetricMatrix( a, a * ( 1.0 + 1e-9 ), a * ( 1.0 - 1e-12 ) ) );
+      matrices.push_back( randomSymmetricMatrix( 0.0, 0.0, a ) );
+      matrices.push_back( randomSymmetricMatrix( a, a * ( 1.0 + 1e-7 ), b ) );
+      Matrix33 m;
+      for ( unsigned int r = 0; r < 3; ++r )
+        for ( unsigned int c = r; c < 3; ++c )
+          {
+            m.setComponent( r, c, getRandomNumber( -1.0, 1.0 ) * scale );
+            m.setComponent( c, r, m( r, c ) );
+          }
+      matrices.push_back( m );
+    }
+  matrices.push_back( Matrix33() );
+  Matrix33 diagonal;
+  diagonal.setComponent( 0, 0, 3.0 );
+  diagonal.setComponent( 1, 1, -1.0 );
+  diagonal.setComponent( 2, 2, 2.0 );
+  matrices.push_back( diagonal );
+  return matrices;
+}
+
+/**
+ * Splits the matrices into structure-of-arrays.
+ */
+void toArrays( const std::vector< Matrix33 > & matrices, std::vector< double > & coefficients )
+{
+  const std::size_t n = matrices.size();
+  coefficients.resize( 6 * n );
+  for ( std::size_t i = 0; i < n; ++i )
+    {
+      coefficients[ i ] = matrices[ i ]( 0, 0 );
+      coefficients[ n + i ] = matrices[ i ]( 0, 1 );
+      coefficients[ 2 * n + i ] = matrices[ i ]( 0, 2 );
+      coefficients[ 3 * n + i ] = matrices[ i ]( 1, 1 );
+      coefficients[ 4 * n + i ] = matrices[ i ]( 1, 2 );
+      coefficients[ 5 * n + i ] = matrices[ i ]( 2, 2 );
+    }
+}
+
+bool testBatchedEigenDecompositions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  srand( 1 );
+  std::vector< Matrix33 > matrices = testMatrices();
+  const std::size_t n = matrices.size();
+  std::vector< double > coefficients, outputs( 15 * n );
+  toArrays( matrices, coefficients );
+  const double * const input[ 6 ] = { &coefficients[ 0 ], &coefficients[ n ], &coefficients[ 2 * n ],
+                                      &coefficients[ 3 * n ], &coefficients[ 4 * n ], &coefficients[ 5 * n ] };
+  double * const values[ 3 ] = { &outputs[ 0 ], &outputs[ n ], &outputs[ 2 * n ] };
+  double * const onlyValues[ 3 ] = { &outputs[ 3 * n ], &outputs[ 4 * n ], &outputs[ 5 * n ] };
+  double * vectors[ 9 ];
+  for ( unsigned int k = 0; k < 9; ++k )
+    vectors[ k ] = &outputs[ ( 6 + k ) * n ];
+
+  trace.beginBlock ( "Testing batched eigen decompositions ..." );
+  Eigen::getEigenDecompositions( n, input, vectors, values );
+  Eigen::getEigenValues( n, input, onlyValues );
+  unsigned int nbValuesOk = 0, nbSortedOk = 0, nbOrthoOk = 0, nbResidualOk = 0;
+  for ( std::size_t i = 0; i < n; ++i )
+    {
+      const Matrix33 & m = matrices[ i ];
+      double norm = 0.0;
+      for ( unsigned int r = 0; r < 3; ++r )
+        for ( unsigned int c = 0; c < 3; ++c )
+          norm += m( r, c ) * m( r, c );
+      norm = std::sqrt( norm );
+      const double tolerance = 1e-10 * norm;
+
+      Matrix33 refVectors;
+      Vector3 refValues;
+      Eigen::getEigenDecomposition( m, refVectors, refValues );
+      bool valuesOk = true, orthoOk = true, residualOk = true;
+      for ( unsigned int k = 0; k < 3; ++k )
+        valuesOk = valuesOk && std::fabs( values[ k ][ i ] - refValues[ k ] ) <= tolerance
+          && std::fabs( onlyValues[ k ][ i ] - refValues[ k ] ) <= tolerance;
+      for ( unsigned int c = 0; c < 3; ++c )
+        {
+          for ( unsigned int d = 0; d < 3; ++d )
+            {
+              double dot = 0.0;
+              for ( unsigned int r = 0; r < 3; ++r )
+                dot += vectors[ 3 * r + c ][ i ] * vectors[ 3 * r + d ][ i ];
+              orthoOk = orthoOk && std::fabs( dot - ( c == d ? 1.0 : 0.0 ) ) <= 1e-10;
+            }
+          for ( unsigned int r = 0; r < 3; ++r )
+            {
+              double mv = 0.0;
+              for ( unsigned int k = 0; k < 3; ++k )
+                mv += m( r, k ) * vectors[ 3 * k + c ][ i ];
+              residualOk = residualOk
+                && std::fabs( mv - values[ c ][ i ] * vectors[ 3 * r + c ][ i ] ) <= tolerance;
+            }
+        }
+      nbValuesOk += valuesOk ? 1 : 0;
+      nbSortedOk += values[ 0 ][ i ] <= values[ 1 ][ i ] && values[ 1 ][ i ] <= values[ 2 ][ i ] ? 1 : 0;
+      nbOrthoOk += orthoOk ? 1 : 0;
+      nbResidualOk += residualOk ? 1 : 0;
+    }
+  nbok += nbValuesOk == n ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbValuesOk << "/" << n << " eigen values == tql2 eigen values" << std::endl;
+  nbok += nbSortedOk == n ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbSortedOk << "/" << n << " eigen values are sorted" << std::endl;
+  nbok += nbOrthoOk == n ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbOrthoOk << "/" << n << " eigen vectors are orthonormal" << std::endl;
+  nbok += nbResidualOk == n ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbResidualOk << "/" << n << " M v == lambda v" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testBatchedEigenDecompositionsTiming()
+{
+  srand( 2 );
+  const std::size_t n = 200000;
+  std::vector< Matrix33 > matrices;
+  for ( std::size_t i = 0; i < n; ++i )
+    matrices.push_back( randomSymmetricMatrix( getRandomNumber( 0.0, 1.0 ),
+                                               getRandomNumber( 0.0, 1.0 ),
+                                               getRandomNumber( 0.0, 1.0 ) ) );
+  std::vector< double > coefficients, outputs( 12 * n );
+  toArrays( matrices, coefficients );
+  const double * const input[ 6 ] = { &coefficients[ 0 ], &coefficients[ n ], &coefficients[ 2 * n ],
+                                      &coefficients[ 3 * n ], &coefficients[ 4 * n ], &coefficients[ 5 * n ] };
+  double * const values[ 3 ] = { &outputs[ 0 ], &outputs[ n ], &outputs[ 2 * n ] };
+  double * vectors[ 9 ];
+  for ( unsigned int k = 0; k < 9; ++k )
+    vectors[ k ] = &outputs[ ( 3 + k ) * n ];
+
+  trace.beginBlock ( "Eigen decompositions with tql2 ..." );
+  Matrix33 eigenVectors;
+  Vector3 eigenValues;
+  double sum = 0.0;
+  for ( std::size_t i = 0; i < n; ++i )
+    {
+      Eigen::getEigenDecomposition( matrices[ i ], eigenVectors, eigenValues );
+      sum += eigenValues[ 0 ];
+    }
+  trace.info() << n << " matrices, sum l0 = " << sum << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Batched eigen decompositions ..." );
+  Eigen::getEigenDecompositions( n, input, vectors, values );
+  sum = 0.0;
+  for ( std::size_t i = 0; i < n; ++i )
+    sum += values[ 0 ][ i ];
+  trace.info() << n << " matrices, sum l0 = " << sum << std::endl;
+  trace.endBlock();
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class EigenValues3D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBatchedEigenDecompositions()
+    && testBatchedEigenDecompositionsTiming(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 #include <vector>
 #include "DGtal/math/Statistic.h"
 #include "DGtal/math/Histogram.h"
+#include "DGtal/math/StreamingHistogram.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -110,6 +111,72 @@ bool testHistogramGaussian2()
 }
 
 
+bool testStreamingHistogram()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing single-pass histogram ..." );
+  // Integer values, the range grows on both sides.
+  std::vector<int> values;
+  for(unsigned int k=0; k < 20000; k++)
+    values.push_back( (int) ( k % 97 ) * (int) ( k % 13 ) - (int) ( k / 10 ) );
+  StreamingHistogram<int> hist( 32 );
+  hist.addValues( values.begin(), values.end() );
+  hist.terminate();
+  trace.info() << hist << std::endl;
+  // Same counts as a histogram with the final bins.
+  Histogram<int> reference;
+  reference.init( hist.binner() );
+  reference.addValues( values.begin(), values.end() );
+  reference.terminate();
+  bool same = hist.area() == values.size() && reference.size() == hist.size();
+  for ( unsigned int i = 0; same && i < hist.size(); ++i )
+    same = hist.nb( i ) == reference.nb( i );
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same counts as Histogram" << std::endl;
+
+  // Merge of partial histograms with the same initial range is exact.
+  std::vector< StreamingHistogram<int> > partials( 3, StreamingHistogram<int>( 32 ) );
+  StreamingHistogram<int> whole( 32 ), merged( 32 );
+  whole.init( -2000, 1200 );
+  for ( unsigned int i = 0; i < partials.size(); ++i )
+    partials[ i ].init( -2000, 1200 );
+  for(unsigned int k=0; k < values.size(); k++)
+    partials[ k % 3 ].addValue( values[ k ] );
+  whole.addValues( values.begin(), values.end() );
+  for ( unsigned int i = 0; i < partials.size(); ++i )
+    merged.merge( partials[ i ] );
+  whole.terminate();
+  merged.terminate();
+  same = merged.area() == whole.area();
+  for ( unsigned int i = 0; same && i < whole.size(); ++i )
+    same = merged.nb( i ) == whole.nb( i );
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "merged == whole" << std::endl;
+
+  // Quantiles of a continuous variable.
+  StreamingHistogram<double> dhist( 256 );
+  Statistic<double> stat( true );
+  for(unsigned int k=0; k < 100000; k++)
+    {
+      double v = getRandomNumber( -1.0, 1.0 ) + getRandomNumber( -1.0, 1.0 );
+      dhist.addValue( v );
+      stat.addValue( v );
+    }
+  dhist.terminate();
+  double error = std::max( std::abs( dhist.quantile( 0.5 ) - stat.quantile( 0.5 ) ),
+                           std::abs( dhist.quantile( 0.9 ) - stat.quantile( 0.9 ) ) );
+  nbok += dhist.cdf( dhist.size() - 1 ) > 0.9999 && error < 0.02 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "median=" << dhist.quantile( 0.5 ) << " (" << stat.quantile( 0.5 ) << ")"
+               << " quantile error=" << error << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -119,7 +186,8 @@ int main( int, char** )
 
   bool res = testHistogramUniform()
     && testHistogramGaussian()
-    && testHistogramGaussian2();
+    && testHistogramGaussian2()
+    && testStreamingHistogram();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
 
   trace.endBlock();
@@ -31,8 +31,13 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/CompiledMPolynomial3.h"
 #include "DGtal/io/readers/MPolynomialReader.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -188,6 +193,104 @@ bool testMPolynomial()
   return nbok == nb;
 }
 
+/**
+   Compares the compiled evaluation of polynomials (single points,
+   batches, gradients) with the evaluation of MPolynomial.
+*/
+bool testCompiledMPolynomial3()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing block ... Compiled evaluation of 3-polynomials" );
+  // A dense polynomial of degree 10, with non normalized coefficients.
+  srand( 0 );
+  MPolynomial<3, double> D;
+  for ( int i = 0; i <= 10; ++i )
+    for ( int j = 0; i + j <= 10; ++j )
+      for ( int k = 0; i + j + k <= 10; ++k )
+        D += ( (double) rand() / RAND_MAX - 0.5 ) * mmonomial<double>( i, j, k );
+  D[ 1 ][ 2 ][ 7 ] = 0.0;
+  std::vector< MPolynomial<3, double> > polys;
+  polys.push_back( durchblick<double>() );
+  polys.push_back( D );
+  polys.push_back( MPolynomial<3, double>( 2.5 ) );
+  polys.push_back( MPolynomial<3, double>() );
+  const std::size_t n = 1003;
+  std::vector<double> x( n ), y( n ), z( n ), v( n ), gx( n ), gy( n ), gz( n );
+  for ( std::size_t i = 0; i < n; ++i )
+    {
+      x[ i ] = 2.0 * rand() / RAND_MAX - 1.0;
+      y[ i ] = 2.0 * rand() / RAND_MAX - 1.0;
+      z[ i ] = 2.0 * rand() / RAND_MAX - 1.0;
+    }
+  for ( unsigned int p = 0; p < polys.size(); ++p )
+    {
+      const MPolynomial<3, double> & P = polys[ p ];
+      MPolynomial<3, double> Px = derivative<0>( P );
+      MPolynomial<3, double> Py = derivative<1>( P );
+      MPolynomial<3, double> Pz = derivative<2>( P );
+      CompiledMPolynomial3<double> cP( P );
+      trace.info() << cP << std::endl;
+      cP.eval( n, &x[ 0 ], &y[ 0 ], &z[ 0 ], &v[ 0 ] );
+      cP.evalGradient( n, &x[ 0 ], &y[ 0 ], &z[ 0 ], &gx[ 0 ], &gy[ 0 ], &gz[ 0 ] );
+      double errSingle = 0.0, errBatch = 0.0, errGrad = 0.0;
+      for ( std::size_t i = 0; i < n; ++i )
+        {
+          const double ref = P( x[ i ] )( y[ i ] )( z[ i ] );
+          double sx, sy, sz;
+          cP.gradient( x[ i ], y[ i ], z[ i ], sx, sy, sz );
+          errSingle = std::max( errSingle, fabs( cP( x[ i ], y[ i ], z[ i ] ) - ref ) );
+          errBatch = std::max( errBatch, fabs( v[ i ] - ref ) );
+          errGrad = std::max( errGrad, fabs( gx[ i ] - Px( x[ i ] )( y[ i ] )( z[ i ] ) ) );
+          errGrad = std::max( errGrad, fabs( gy[ i ] - Py( x[ i ] )( y[ i ] )( z[ i ] ) ) );
+          errGrad = std::max( errGrad, fabs( gz[ i ] - Pz( x[ i ] )( y[ i ] )( z[ i ] ) ) );
+          errGrad = std::max( errGrad, fabs( sx - gx[ i ] ) + fabs( sy - gy[ i ] ) + fabs( sz - gz[ i ] ) );
+        }
+      nbok += errSingle < 1e-12 ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "single point error " << errSingle << " < 1e-12" << std::endl;
+      nbok += errBatch < 1e-12 ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "batch error " << errBatch << " < 1e-12" << std::endl;
+      nbok += errGrad < 1e-11 ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "gradient error " << errGrad << " < 1e-11" << std::endl;
+    }
+  nbok += CompiledMPolynomial3<double>( durchblick<double>() ).degree() == 3 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "degree() == 3" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing block ... Evaluation speed of degree 10 polynomial (MPolynomial)" );
+  double total = 0.0;
+  for ( unsigned int r = 0; r < 20; ++r )
+    for ( std::size_t i = 0; i < n; ++i )
+      total += D( x[ i ] )( y[ i ] )( z[ i ] );
+  trace.info() << "Total = " << total << std::endl;
+  trace.endBlock();
+
+  CompiledMPolynomial3<double> cD( D );
+  trace.beginBlock ( "Testing block ... Evaluation speed of degree 10 polynomial (compiled, batch)" );
+  double total1 = 0.0;
+  for ( unsigned int r = 0; r < 20; ++r )
+    {
+      cD.eval( n, &x[ 0 ], &y[ 0 ], &z[ 0 ], &v[ 0 ] );
+      for ( std::size_t i = 0; i < n; ++i )
+        total1 += v[ i ];
+    }
+  trace.info() << "Total1 = " << total1 << std::endl;
+  trace.endBlock();
+  nbok += fabs( total1 - total ) < 1e-8 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fabs( total1 - total ) < 1e-8" << std::endl;
+  return nbok == nb;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -197,7 +300,8 @@ int main( int /*argc*/, char** /*argv*/ )
   trace.beginBlock ( "Testing class MPolynomial" );
 
   bool res = testMPolynomial()
-    && testMPolynomialSpeed( 0.05 );
+    && testMPolynomialSpeed( 0.05 )
+    && testCompiledMPolynomial3();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
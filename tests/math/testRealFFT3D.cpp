@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testRealFFT3D.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class RealFFT3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/RealFFT3D.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class RealFFT3D.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the half-spectrum with a naive discrete Fourier transform,
+ * then checks that the backward transform gives back the image.
+ */
+bool testRealFFT3D( std::size_t nx, std::size_t ny, std::size_t nz )
+{
+  typedef RealFFT3D::Complex Complex;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  const double pi = 3.14159265358979323846;
+
+  trace.beginBlock ( "Testing RealFFT3D against a naive DFT ..." );
+  RealFFT3D fft( nx, ny, nz );
+  trace.info() << fft << std::endl;
+  ++nb; nbok += fft.isValid() ? 1 : 0;
+
+  std::vector< double > image( fft.size() );
+  srand( 12 );
+  for ( std::size_t i = 0; i < image.size(); ++i )
+    image[ i ] = (double)( rand() % 1000 ) / 100.0 - 5.0;
+
+  std::vector< Complex > spectrum;
+  fft.forward( image, spectrum );
+  ++nb; nbok += ( spectrum.size() == ( nx / 2 + 1 ) * ny * nz ) ? 1 : 0;
+
+  double maxError = 0.0;
+  for ( std::size_t kz = 0; kz < nz; ++kz )
+    for ( std::size_t ky = 0; ky < ny; ++ky )
+      for ( std::size_t kx = 0; kx <= nx / 2; ++kx )
+        {
+          Complex sum( 0.0, 0.0 );
+          for ( std::size_t z = 0; z < nz; ++z )
+            for ( std::size_t y = 0; y < ny; ++y )
+              for ( std::size_t x = 0; x < nx; ++x )
+                {
+                  const double angle = -2.0 * pi * ( (double)( kx * x ) / nx
+                                                     + (double)( ky * y ) / ny
+                                                     + (double)( kz * z ) / nz );
+                  sum += image[ ( z * ny + y ) * nx + x ] * std::polar( 1.0, angle );
+                }
+          maxError = std::max( maxError, std::abs( sum - spectrum[ ( kz * ny + ky ) * ( nx / 2 + 1 ) + kx ] ));
+        }
+  trace.info() << "max |FFT - DFT| = " << maxError << std::endl;
+  ++nb; nbok += ( maxError < 1e-9 ) ? 1 : 0;
+
+  std::vector< double > back;
+  fft.backward( spectrum, back );
+  maxError = 0.0;
+  for ( std::size_t i = 0; i < image.size(); ++i )
+    maxError = std::max( maxError, std::abs( back[ i ] - image[ i ] ));
+  trace.info() << "max |backward(forward(f)) - f| = " << maxError << std::endl;
+  ++nb; nbok += ( maxError < 1e-12 ) ? 1 : 0;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Circular convolution of two images by product of their spectra.
+ */
+bool testConvolution()
+{
+  typedef RealFFT3D::Complex Complex;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing convolution with RealFFT3D ..." );
+  const std::size_t n = RealFFT3D::goodSize( 13 );
+  ++nb; nbok += ( n >= 13 ) ? 1 : 0;
+  RealFFT3D fft( n, n, n );
+
+  // a box of 3x3x3 ones convolved with a Dirac at (1,2,3).
+  std::vector< double > box( fft.size(), 0.0 ), dirac( fft.size(), 0.0 );
+  for ( std::size_t z = 0; z < 3; ++z )
+    for ( std::size_t y = 0; y < 3; ++y )
+      for ( std::size_t x = 0; x < 3; ++x )
+        box[ ( z * n + y ) * n + x ] = 1.0;
+  dirac[ ( 3 * n + 2 ) * n + 1 ] = 1.0;
+
+  std::vector< Complex > F, G;
+  fft.forward( box, F );
+  fft.forward( dirac, G );
+  for ( std::size_t i = 0; i < F.size(); ++i )
+    F[ i ] *= G[ i ];
+  std::vector< double > result;
+  fft.backward( F, result );
+
+  double sum = 0.0;
+  bool ok = true;
+  for ( std::size_t z = 0; z < n; ++z )
+    for ( std::size_t y = 0; y < n; ++y )
+      for ( std::size_t x = 0; x < n; ++x )
+        {
+          const double v = result[ ( z * n + y ) * n + x ];
+          const bool inside = x >= 1 && x < 4 && y >= 2 && y < 5 && z >= 3 && z < 6;
+          ok = ok && std::abs( v - ( inside ? 1.0 : 0.0 )) < 1e-9;
+          sum += v;
+        }
+  trace.info() << "sum = " << sum << std::endl;
+  ++nb; nbok += ok ? 1 : 0;
+  ++nb; nbok += ( std::abs( sum - 27.0 ) < 1e-9 ) ? 1 : 0;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class RealFFT3D" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testRealFFT3D( 8, 4, 2 )
+    && testRealFFT3D( 2, 8, 16 )
+    && testRealFFT3D( 16, 1, 4 )
+    && testConvolution();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
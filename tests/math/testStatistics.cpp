@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <vector>
+#include <cstdlib>
+#include <algorithm>
 #include "DGtal/math/Statistic.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -112,6 +114,74 @@ bool testStatisticsSaving()
   return nbok == nb;
 }
 
+/**
+ * Streaming mode: median and quantiles from a quantile sketch,
+ * merge of partial statistics.
+ */
+bool testStatisticsStreaming()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Statistics in streaming mode ..." );
+
+  // Small samples are summarized exactly.
+  Statistic<double> small( false, 256 );
+  for(unsigned int k=0; k < 100; k++)
+    small.addValue(99);
+  small.addValue(88);
+  for(unsigned int k=0; k < 100; k++)
+    small.addValue(77);
+  nbok += ( small.isStreaming() && small.median() == 88
+            && small.quantile( 0.0 ) == 77 && small.quantile( 1.0 ) == 99 ) ? 1 : 0; nb++;
+  small.terminate();
+  nbok += ( small.median() == 88 && small.quantile( 0.75 ) == 99 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "exact median = " << small.median() << std::endl;
+
+  // Large samples, split into partial statistics.
+  srand( 0 );
+  const unsigned int n = 400000;
+  std::vector<double> values( n );
+  for(unsigned int k=0; k < n; k++)
+    values[ k ] = ( (double) rand() / (double) RAND_MAX ) * ( (double) rand() / (double) RAND_MAX );
+  Statistic<double> exact( true );
+  Statistic<double> streaming( false, 200 );
+  exact.addValues( values.begin(), values.end() );
+  streaming.addValues( values.begin(), values.end() );
+  std::vector< Statistic<double> > partials( 4, Statistic<double>( false, 200 ) );
+  for(unsigned int k=0; k < n; k++)
+    partials[ k % 4 ].addValue( values[ k ] );
+  Statistic<double> merged( false, 200 );
+  for(unsigned int i=0; i < partials.size(); i++)
+    merged.merge( partials[ i ] );
+  nbok += ( merged.samples() == n && merged.min() == exact.min() && merged.max() == exact.max()
+            && std::abs( merged.mean() - exact.mean() ) < 1e-9 ) ? 1 : 0; nb++;
+
+  // Rank error of the sketch quantiles (about 1% for k=200).
+  std::vector<double> sorted( values );
+  std::sort( sorted.begin(), sorted.end() );
+  double maxError = 0.0;
+  const double orders[ 5 ] = { 0.01, 0.25, 0.5, 0.75, 0.99 };
+  for(unsigned int i=0; i < 5; i++)
+    {
+      const double q = orders[ i ];
+      const double vs = streaming.quantile( q );
+      const double vm = merged.quantile( q );
+      const double rs = (double) ( std::upper_bound( sorted.begin(), sorted.end(), vs ) - sorted.begin() ) / n;
+      const double rm = (double) ( std::upper_bound( sorted.begin(), sorted.end(), vm ) - sorted.begin() ) / n;
+      maxError = std::max( maxError, std::max( std::abs( rs - q ), std::abs( rm - q ) ) );
+      trace.info() << "q=" << q << " exact=" << exact.quantile( q )
+                   << " streaming=" << vs << " merged=" << vm << std::endl;
+    }
+  nbok += maxError < 0.02 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "max rank error = " << maxError << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -132,7 +202,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res2 = testStatisticsSaving(); // && ... other tests
+  bool res2 = testStatisticsSaving() && testStatisticsStreaming(); // && ... other tests
   trace.emphase() << ( res2 ? "Passed." : "Error." ) << endl;
 
 
@@ -0,0 +1,189 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOctreeGaussDigitizer.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class OctreeGaussDigitizer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/math/MPolynomial.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/OctreeGaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitHyperCube.h"
+#include "DGtal/shapes/implicit/ImplicitRoundedHyperCube.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OctreeGaussDigitizer.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+   Digitizes \a shape with GaussDigitizer and with OctreeGaussDigitizer
+   and checks that both digital sets are equal.
+*/
+template <typename TSpace, typename TShape>
+bool
+testSameDigitization( const TShape & shape,
+                      const typename TSpace::RealPoint & xLow,
+                      const typename TSpace::RealPoint & xUp,
+                      double h, const std::string & name )
+{
+  typedef HyperRectDomain<TSpace> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+
+  trace.beginBlock ( "Digitization of " + name );
+  GaussDigitizer<TSpace, TShape> dig;
+  dig.attach( shape );
+  dig.init( xLow, xUp, h );
+  DigitalSet ref( dig.getDomain() );
+  trace.beginBlock ( "GaussDigitizer" );
+  Shapes<Domain>::digitalShaper( ref, dig );
+  trace.endBlock();
+
+  OctreeGaussDigitizer<TSpace, TShape> odig;
+  odig.attach( shape );
+  odig.init( xLow, xUp, h );
+  DigitalSet set( odig.getDomain() );
+  trace.beginBlock ( "OctreeGaussDigitizer" );
+  odig.digitize( set );
+  trace.endBlock();
+  trace.info() << odig << std::endl;
+  trace.info() << "domain=" << odig.getDomain().size()
+               << " ref=" << ref.size() << " set=" << set.size() << std::endl;
+
+  bool same = ( ref.size() == set.size() );
+  for ( typename DigitalSet::ConstIterator it = ref.begin(), itE = ref.end();
+        same && ( it != itE ); ++it )
+    same = ( set.find( *it ) != set.end() );
+  trace.endBlock();
+  return same;
+}
+
+/**
+   Checks the octree digitization against the Gauss digitization of
+   several implicit shapes, and that it prunes most evaluations.
+*/
+bool testOctreeGaussDigitizer()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing OctreeGaussDigitizer ..." );
+  typedef Z3i::Space Space;
+  typedef Space::RealPoint RealPoint;
+  typedef MPolynomial<3, double> Polynomial3;
+
+  ImplicitBall<Space> ball( RealPoint( 0.1, 0.2, 0.3 ), 7.3 );
+  nbok += testSameDigitization<Space>
+    ( ball, RealPoint( -8, -8, -8 ), RealPoint( 8, 8, 8 ), 0.25, "ball" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same ball digitization" << std::endl;
+
+  ImplicitRoundedHyperCube<Space> rcube( RealPoint( 0.0, 0.0, 0.0 ), 5.0, 3.5 );
+  nbok += testSameDigitization<Space>
+    ( rcube, RealPoint( -6, -6, -6 ), RealPoint( 6, 6, 6 ), 0.2, "rounded cube" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same rounded cube digitization" << std::endl;
+
+  // Not specialized: every point is evaluated.
+  ImplicitHyperCube<Space> cube( RealPoint( 0.0, 0.0, 0.0 ), 2.0 );
+  nbok += testSameDigitization<Space>
+    ( cube, RealPoint( -3, -3, -3 ), RealPoint( 3, 3, 3 ), 0.25, "cube" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same cube digitization" << std::endl;
+
+  // Torus (x^2+y^2+z^2+R^2-r^2)^2 - 4 R^2 (x^2+y^2), R=2, r=0.7
+  Polynomial3 s2 = mmonomial<double>( 2, 0, 0 ) + mmonomial<double>( 0, 2, 0 )
+    + mmonomial<double>( 0, 0, 2 );
+  Polynomial3 q = s2 + ( 4.0 - 0.49 ) * mmonomial<double>( 0, 0, 0 );
+  Polynomial3 torus = q * q
+    - 16.0 * ( mmonomial<double>( 2, 0, 0 ) + mmonomial<double>( 0, 2, 0 ) );
+  ImplicitPolynomial3Shape<Space> torusShape( torus );
+  nbok += testSameDigitization<Space>
+    ( torusShape, RealPoint( -3, -3, -1 ), RealPoint( 3, 3, 1 ), 0.05, "torus" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same torus digitization" << std::endl;
+
+  // Degree 10: (x^2+y^2+z^2)^5 + x^3 y z - 1
+  Polynomial3 s10 = s2 * s2 * s2 * s2 * s2 + mmonomial<double>( 3, 1, 1 )
+    - mmonomial<double>( 0, 0, 0 );
+  ImplicitPolynomial3Shape<Space> s10Shape( s10 );
+  OctreeGaussDigitizer<Space, ImplicitPolynomial3Shape<Space> > odig;
+  odig.attach( s10Shape );
+  odig.init( RealPoint( -1.5, -1.5, -1.5 ), RealPoint( 1.5, 1.5, 1.5 ), 0.03 );
+  nbok += testSameDigitization<Space>
+    ( s10Shape, RealPoint( -1.5, -1.5, -1.5 ), RealPoint( 1.5, 1.5, 1.5 ), 0.03,
+      "degree 10 polynomial" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same degree 10 digitization" << std::endl;
+  Z3i::DigitalSet set( odig.getDomain() );
+  odig.digitize( set );
+  nbok += odig.nbEvaluations() * 10 < odig.getDomain().size() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "evaluations=" << odig.nbEvaluations()
+               << " < domain/10=" << odig.getDomain().size() / 10 << std::endl;
+
+  ImplicitBall<Z2i::Space> disk( Z2i::RealPoint( 0.5, -0.25 ), 11.1 );
+  nbok += testSameDigitization<Z2i::Space>
+    ( disk, Z2i::RealPoint( -12, -12 ), Z2i::RealPoint( 12, 12 ), 0.1, "disk" ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same disk digitization" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OctreeGaussDigitizer" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOctreeGaussDigitizer(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
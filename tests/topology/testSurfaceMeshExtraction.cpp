@@ -0,0 +1,208 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaceMeshExtraction.cpp
+ * @ingroup Tests
+ *
+ * Functions for testing class SurfaceMeshExtraction.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CanonicCellEmbedder.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/topology/helpers/SurfaceMeshExtraction.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DigitalSetBoundary<KSpace, DigitalSet> Boundary;
+typedef DigitalSurface<Boundary> MyDigitalSurface;
+
+/**
+ * Trivial normal vector estimator: the outward normal of the surfels.
+ */
+struct TrivialNormalEstimator
+{
+  const KSpace & K;
+  TrivialNormalEstimator( const KSpace & aK ) : K( aK ) {}
+  RealVector eval( const SCell & s ) const
+  {
+    RealVector n = RealVector::zero;
+    const Dimension k = K.sOrthDir( s );
+    n[ k ] = K.sDirect( s, k ) ? -1.0 : 1.0;
+    return n;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfaceMeshExtraction.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the signed volume enclosed by a closed mesh.
+ */
+double signedVolume( const Mesh<RealPoint> & aMesh )
+{
+  double volume = 0.0;
+  for ( unsigned int i = 0; i < aMesh.nbFaces(); ++i )
+    {
+      const unsigned int * f = aMesh.getFaceIndices( i );
+      const RealPoint & p0 = aMesh.getVertex( f[ 0 ] );
+      for ( unsigned int j = 1; j + 1 < aMesh.getFaceSize( i ); ++j )
+        {
+          const RealPoint & p1 = aMesh.getVertex( f[ j ] );
+          const RealPoint & p2 = aMesh.getVertex( f[ j + 1 ] );
+          volume += ( p0[ 0 ] * ( p1[ 1 ] * p2[ 2 ] - p1[ 2 ] * p2[ 1 ] )
+                      - p0[ 1 ] * ( p1[ 0 ] * p2[ 2 ] - p1[ 2 ] * p2[ 0 ] )
+                      + p0[ 2 ] * ( p1[ 0 ] * p2[ 1 ] - p1[ 1 ] * p2[ 0 ] ) ) / 6.0;
+        }
+    }
+  return volume;
+}
+
+bool testSurfaceMeshExtraction()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Domain domain( Point::diagonal( -12 ), Point::diagonal( 12 ) );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 0, 0, 0 ), 9 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( 2, 1, 0 ), 4 );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  MyDigitalSurface aSurface( new Boundary( K, aSet ) );
+  SurfaceMeshExtraction<MyDigitalSurface> extraction( aSurface );
+  trace.info() << extraction << std::endl;
+
+  trace.beginBlock ( "Primal mesh ..." );
+  Mesh<RealPoint> primal( false, true );
+  std::vector<RealVector> normals;
+  extraction.primalMesh( primal, CanonicCellEmbedder<KSpace>( K ),
+                         TrivialNormalEstimator( K ), normals );
+  // Two closed surfaces (sphere-like), with quads only: V - F = 4.
+  nbok += primal.nbFaces() == aSurface.size()
+    && primal.nbVertex() == primal.nbFaces() + 4 ? 1 : 0; nb++;
+  // Each pointel is used 3 to 6 times, no pointel is duplicated.
+  std::vector<unsigned int> valence( primal.nbVertex(), 0 );
+  for ( unsigned int f = 0; f < primal.nbFaces(); ++f )
+    for ( unsigned int q = 0; q < 4; ++q )
+      ++valence[ primal.getFaceIndices( f )[ q ] ];
+  std::vector<RealPoint> vertices( primal.VertexBegin(), primal.VertexEnd() );
+  std::sort( vertices.begin(), vertices.end() );
+  nbok += *std::min_element( valence.begin(), valence.end() ) >= 3
+    && *std::max_element( valence.begin(), valence.end() ) <= 6
+    && std::adjacent_find( vertices.begin(), vertices.end() ) == vertices.end() ? 1 : 0; nb++;
+  // The quads are oriented outward: they enclose the voxels.
+  const double volume = signedVolume( primal );
+  nbok += std::abs( volume - (double) aSet.size() ) < 1e-6 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << " #V=" << primal.nbVertex() << " #F=" << primal.nbFaces()
+               << " volume=" << volume << " #voxels=" << aSet.size() << std::endl;
+  // Normals of the vertices of the outer sphere point outside.
+  bool normalsOk = normals.size() == primal.nbVertex();
+  for ( unsigned int i = 0; normalsOk && i < normals.size(); ++i )
+    {
+      const RealPoint & p = primal.getVertex( i );
+      normalsOk = std::abs( normals[ i ].norm() - 1.0 ) < 1e-9
+        && ( p.norm() < 8.0 || normals[ i ].dot( p ) > 0.0 );
+    }
+  nbok += normalsOk ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vertex normals" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Dual mesh ..." );
+  Mesh<RealPoint> dual;
+  extraction.dualMesh( dual, CanonicSCellEmbedder<KSpace>( K ),
+                       TrivialNormalEstimator( K ), normals );
+  MyDigitalSurface::FaceSet faces = aSurface.allClosedFaces();
+  unsigned int nbIndices = 0;
+  for ( MyDigitalSurface::FaceSet::const_iterator it = faces.begin(), itend = faces.end();
+        it != itend; ++it )
+    nbIndices += it->nbVertices;
+  unsigned int nbDualIndices = 0;
+  for ( unsigned int f = 0; f < dual.nbFaces(); ++f )
+    nbDualIndices += dual.getFaceSize( f );
+  nbok += dual.nbVertex() == aSurface.size() && normals.size() == aSurface.size()
+    && dual.nbFaces() == faces.size() && nbDualIndices == nbIndices ? 1 : 0; nb++;
+  // The faces are those of the digital surface (same first vertex
+  // and size, in the same order for the same pivot).
+  std::vector< std::vector<unsigned int> > dualFaces, surfaceFaces;
+  for ( unsigned int f = 0; f < dual.nbFaces(); ++f )
+    {
+      std::vector<unsigned int> face( dual.getFaceIndices( f ),
+                                      dual.getFaceIndices( f ) + dual.getFaceSize( f ) );
+      std::sort( face.begin(), face.end() );
+      dualFaces.push_back( face );
+    }
+  std::map<SCell, unsigned int> index;
+  unsigned int i = 0;
+  for ( MyDigitalSurface::ConstIterator it = aSurface.begin(), itend = aSurface.end();
+        it != itend; ++it, ++i )
+    index[ *it ] = i;
+  for ( MyDigitalSurface::FaceSet::const_iterator it = faces.begin(), itend = faces.end();
+        it != itend; ++it )
+    {
+      MyDigitalSurface::VertexRange vtcs = aSurface.verticesAroundFace( *it );
+      std::vector<unsigned int> face;
+      for ( unsigned int v = 0; v < vtcs.size(); ++v )
+        face.push_back( index[ vtcs[ v ] ] );
+      std::sort( face.begin(), face.end() );
+      surfaceFaces.push_back( face );
+    }
+  std::sort( dualFaces.begin(), dualFaces.end() );
+  std::sort( surfaceFaces.begin(), surfaceFaces.end() );
+  nbok += dualFaces == surfaceFaces ? 1 : 0; nb++;
+  // The faces are oriented outward.
+  nbok += signedVolume( dual ) > 0.0 ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << " #V=" << dual.nbVertex() << " #F=" << dual.nbFaces()
+               << " volume=" << signedVolume( dual ) << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SurfaceMeshExtraction" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSurfaceMeshExtraction(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////